@@ -33,6 +33,21 @@ static long long currentTimeMillis()
     return ms.count();
 }
 
+static idle_strategy_t conductorIdleStrategy(const Context& context)
+{
+    if (context.conductorIdleStrategy())
+    {
+        return context.conductorIdleStrategy();
+    }
+
+    SleepingIdleStrategy sleepingIdleStrategy(IDLE_SLEEP_MS);
+
+    return [sleepingIdleStrategy](int workCount) mutable
+    {
+        sleepingIdleStrategy.idle(workCount);
+    };
+}
+
 Aeron::Aeron(Context &context) :
     m_randomEngine(m_randomDevice()),
     m_sessionIdDistribution(-INT_MAX, INT_MAX),
@@ -56,16 +71,32 @@ Aeron::Aeron(Context &context) :
         context.m_mediaDriverTimeout,
         context.m_resourceLingerTimeout,
         CncFileDescriptor::clientLivenessTimeout(m_cncBuffer),
-        context.m_publicationConnectionTimeout),
-    m_idleStrategy(IDLE_SLEEP_MS),
-    m_conductorRunner(m_conductor, m_idleStrategy, m_context.m_exceptionHandler)
+        context.m_publicationConnectionTimeout,
+        context.useConductorAgentInvoker()),
+    m_idleStrategy(conductorIdleStrategy(context)),
+    m_conductorRunner(m_conductor, m_idleStrategy, m_context.m_exceptionHandler),
+    m_conductorInvoker(m_conductor, m_context.m_exceptionHandler)
 {
-    m_conductorRunner.start();
+    if (m_context.useConductorAgentInvoker())
+    {
+        m_conductorInvoker.start();
+    }
+    else
+    {
+        m_conductorRunner.start();
+    }
 }
 
 Aeron::~Aeron()
 {
-    m_conductorRunner.close();
+    if (m_context.useConductorAgentInvoker())
+    {
+        m_conductorInvoker.close();
+    }
+    else
+    {
+        m_conductorRunner.close();
+    }
 
     // memory mapped files should be free'd by the destructor of the shared_ptr
 }
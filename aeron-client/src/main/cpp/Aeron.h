@@ -27,6 +27,7 @@
 #include "ClientConductor.h"
 #include "concurrent/SleepingIdleStrategy.h"
 #include "concurrent/AgentRunner.h"
+#include "concurrent/AgentInvoker.h"
 #include "Publication.h"
 #include "Subscription.h"
 #include "Context.h"
@@ -115,6 +116,23 @@ public:
         return m_conductor.findPublication(registrationId);
     }
 
+    /**
+     * Add a batch of {@link Publication}s for publishing messages to subscribers.
+     *
+     * This function returns immediately and does not wait for the response from the media driver. The commands are
+     * written to the media driver in as few writes as possible and the handler is called on the conductor thread as
+     * each add completes, so there is no need to poll Aeron::findPublication for each of the registration ids.
+     *
+     * @param requests for the channel and stream of each Publication.
+     * @param handler  called as the add for each request completes.
+     * @return registration ids for the publications in the order of the requests.
+     */
+    inline std::vector<std::int64_t> addPublications(
+        const std::vector<RegistrationRequest>& requests, const on_add_publication_t& handler)
+    {
+        return m_conductor.addPublications(requests, handler);
+    }
+
     /**
      * Add an {@link ExclusivePublication} for publishing messages to subscribers from a single thread.
      *
@@ -149,6 +167,22 @@ public:
         return m_conductor.findExclusivePublication(registrationId);
     }
 
+    /**
+     * Add a batch of {@link ExclusivePublication}s for publishing messages to subscribers from a single thread.
+     *
+     * This function returns immediately and does not wait for the response from the media driver. The handler is
+     * called on the conductor thread as each add completes.
+     *
+     * @param requests for the channel and stream of each ExclusivePublication.
+     * @param handler  called as the add for each request completes.
+     * @return registration ids for the publications in the order of the requests.
+     */
+    inline std::vector<std::int64_t> addExclusivePublications(
+        const std::vector<RegistrationRequest>& requests, const on_add_exclusive_publication_t& handler)
+    {
+        return m_conductor.addExclusivePublications(requests, handler);
+    }
+
     /**
      * Add a new {@link Subscription} for subscribing to messages from publishers.
      *
@@ -185,6 +219,24 @@ public:
         return m_conductor.addSubscription(channel, streamId, onAvailableImageHandler, onUnavailableImageHandler);
     }
 
+    /**
+     * Add a batch of {@link Subscription}s for subscribing to messages from publishers.
+     *
+     * This function returns immediately and does not wait for the response from the media driver. The handler is
+     * called on the conductor thread as each add completes. The image handlers are the defaults from the
+     * {@link Context}.
+     *
+     * @param requests for the channel and stream of each Subscription.
+     * @param handler  called as the add for each request completes.
+     * @return registration ids for the subscriptions in the order of the requests.
+     */
+    inline std::vector<std::int64_t> addSubscriptions(
+        const std::vector<RegistrationRequest>& requests, const on_add_subscription_t& handler)
+    {
+        return m_conductor.addSubscriptions(
+            requests, m_context.m_onAvailableImageHandler, m_context.m_onUnavailableImageHandler, handler);
+    }
+
     /**
      * Retrieve the Subscription associated with the given registrationId.
      *
@@ -222,7 +274,36 @@ public:
         return m_toDriverRingBuffer.nextCorrelationId();
     }
 
+    /**
+     * Return the AgentInvoker for the client conductor.
+     *
+     * This is only started when {@link Context::useConductorAgentInvoker} is set, in which case the application is
+     * responsible for calling AgentInvoker::invoke to run the duty cycle of the client conductor.
+     *
+     * @return AgentInvoker for the client conductor.
+     */
+    inline AgentInvoker<ClientConductor>& conductorAgentInvoker()
+    {
+        return m_conductorInvoker;
+    }
+
 private:
+    class ConductorIdleStrategy
+    {
+    public:
+        ConductorIdleStrategy(const idle_strategy_t& idleStrategy) : m_idleStrategy(idleStrategy)
+        {
+        }
+
+        inline void idle(int workCount)
+        {
+            m_idleStrategy(workCount);
+        }
+
+    private:
+        idle_strategy_t m_idleStrategy;
+    };
+
     std::random_device m_randomDevice;
     std::default_random_engine m_randomEngine;
     std::uniform_int_distribution<std::int32_t> m_sessionIdDistribution;
@@ -242,8 +323,9 @@ private:
     CopyBroadcastReceiver m_toClientsCopyReceiver;
 
     ClientConductor m_conductor;
-    SleepingIdleStrategy m_idleStrategy;
-    AgentRunner<ClientConductor, SleepingIdleStrategy> m_conductorRunner;
+    ConductorIdleStrategy m_idleStrategy;
+    AgentRunner<ClientConductor, ConductorIdleStrategy> m_conductorRunner;
+    AgentInvoker<ClientConductor> m_conductorInvoker;
 
     MemoryMappedFile::ptr_t mapCncFile(Context& context);
 };
@@ -14,20 +14,38 @@
  * limitations under the License.
  */
 
+#include <map>
+
 #include "ClientConductor.h"
 
 namespace aeron {
 
 ClientConductor::~ClientConductor()
 {
-    std::vector<std::shared_ptr<Subscription>> subscriptions;
+    {
+        std::vector<std::shared_ptr<Publication>> publications;
+        std::vector<std::shared_ptr<ExclusivePublication>> exclusivePublications;
+        std::vector<std::shared_ptr<Subscription>> subscriptions;
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&subscriptions](SubscriptionStateDefn& entry)
+        for (const std::shared_ptr<PublicationStateDefn>& entry : *std::atomic_load(&m_publications))
         {
-            subscriptions.push_back(entry.m_subscriptionCache);
-            entry.m_subscriptionCache.reset();
-        });
+            publications.push_back(std::atomic_exchange(&entry->m_publicationCache, std::shared_ptr<Publication>()));
+        }
+
+        for (const std::shared_ptr<ExclusivePublicationStateDefn>& entry : *std::atomic_load(&m_exclusivePublications))
+        {
+            exclusivePublications.push_back(
+                std::atomic_exchange(&entry->m_publicationCache, std::shared_ptr<ExclusivePublication>()));
+        }
+
+        for (const std::shared_ptr<SubscriptionStateDefn>& entry : *std::atomic_load(&m_subscriptions))
+        {
+            subscriptions.push_back(std::atomic_exchange(&entry->m_subscriptionCache, std::shared_ptr<Subscription>()));
+        }
+    }
+
+    // releases of the cached resources above hand their images to the conductor
+    m_commandQueue.read(m_commandHandler);
 
     std::for_each(m_lingeringImageArrays.begin(), m_lingeringImageArrays.end(),
         [](ImageArrayLingerDefn & entry)
@@ -41,75 +59,145 @@ std::int64_t ClientConductor::addPublication(const std::string &channel, std::in
 {
     verifyDriverIsActive();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    std::int64_t id;
-
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [channel, streamId](const PublicationStateDefn &entry)
+    auto matches = [&channel, streamId](const std::shared_ptr<PublicationStateDefn> &entry)
         {
-            return (streamId == entry.m_streamId && channel == entry.m_channel);
-        });
+            return (streamId == entry->m_streamId && channel == entry->m_channel);
+        };
 
-    if (it == m_publications.end())
-    {
-        std::int64_t registrationId = m_driverProxy.addPublication(channel, streamId);
+    const registry_t<PublicationStateDefn> publications = std::atomic_load(&m_publications);
+    auto it = std::find_if(publications->begin(), publications->end(), matches);
 
-        m_publications.emplace_back(channel, registrationId, streamId, m_epochClock());
-        id = registrationId;
+    if (it != publications->end())
+    {
+        return (*it)->m_registrationId;
     }
-    else
+
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+    std::shared_ptr<PublicationStateDefn> state =
+        std::make_shared<PublicationStateDefn>(channel, registrationId, streamId, m_epochClock());
+    std::int64_t id = registrationId;
+
+    // register before sending so the response from the driver always finds the registration
+    updateRegistry(m_publications,
+        [&](std::vector<std::shared_ptr<PublicationStateDefn>>& entries)
+        {
+            auto existing = std::find_if(entries.begin(), entries.end(), matches);
+
+            if (existing != entries.end())
+            {
+                id = (*existing)->m_registrationId;
+                return false;
+            }
+
+            id = registrationId;
+            entries.push_back(state);
+            return true;
+        });
+
+    if (id == registrationId)
     {
-        id = (*it).m_registrationId;
+        sendToDriver(m_publications, registrationId,
+            [&]()
+            {
+                m_driverProxy.addPublication(registrationId, channel, streamId);
+            });
     }
 
     return id;
 }
 
-std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
+std::vector<std::int64_t> ClientConductor::addPublications(
+    const std::vector<RegistrationRequest>& requests, const on_add_publication_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    verifyDriverIsActive();
+    verifyCommandQueueHasCapacity();
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    const long long now = m_epochClock();
+    std::vector<std::int64_t> correlationIds;
+    std::vector<std::int64_t> registrationIds(requests.size());
+    std::vector<std::int64_t> sendIds;
+    std::vector<RegistrationRequest> sendRequests;
 
-    if (it == m_publications.end())
+    for (std::size_t i = 0; i < requests.size(); i++)
     {
-        return std::shared_ptr<Publication>();
+        correlationIds.push_back(m_driverProxy.nextCorrelationId());
     }
 
-    PublicationStateDefn& state = (*it);
-    std::shared_ptr<Publication> pub(state.m_publication.lock());
-
-    if (!pub)
-    {
-        switch (state.m_status)
+    updateRegistry(m_publications,
+        [&](std::vector<std::shared_ptr<PublicationStateDefn>>& entries)
         {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistration + m_driverTimeoutMs))
+            std::map<std::pair<std::int32_t, std::string>, std::int64_t> idByChannelStream;
+
+            for (const std::shared_ptr<PublicationStateDefn>& entry : entries)
+            {
+                idByChannelStream.emplace(std::make_pair(entry->m_streamId, entry->m_channel), entry->m_registrationId);
+            }
+
+            sendIds.clear();
+            sendRequests.clear();
+
+            for (std::size_t i = 0; i < requests.size(); i++)
+            {
+                const RegistrationRequest& request = requests[i];
+                auto result = idByChannelStream.emplace(
+                    std::make_pair(request.streamId, request.channel), correlationIds[i]);
+
+                registrationIds[i] = result.first->second;
+
+                if (result.second)
                 {
-                    throw DriverTimeoutException(
-                        strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
+                    entries.push_back(std::make_shared<PublicationStateDefn>(
+                        request.channel, correlationIds[i], request.streamId, now));
+                    sendIds.push_back(correlationIds[i]);
+                    sendRequests.push_back(request);
                 }
-                break;
+            }
 
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
-                {
-                    UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_positionLimitCounterId);
+            return !sendIds.empty();
+        });
 
-                    pub = std::make_shared<Publication>(
-                        *this, state.m_channel, state.m_registrationId, state.m_originalRegistrationId, state.m_streamId,
-                        state.m_sessionId, publicationLimit, *(state.m_buffers));
+    const std::size_t sent = m_driverProxy.addPublications(sendIds, sendRequests);
+    std::unique_ptr<AsyncRegistrationDefn> registration(new AsyncRegistrationDefn(now, registrationIds));
 
-                    state.m_publication = std::weak_ptr<Publication>(pub);
-                }
-                break;
+    registration->m_onAddPublication = handler;
 
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
-                throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-        }
+    for (std::size_t i = sent; i < sendIds.size(); i++)
+    {
+        removeRegistration(m_publications, sendIds[i]);
+        registration->m_unsentRegistrationIds.push_back(sendIds[i]);
+    }
+
+    enqueueAsyncRegistration(std::move(registration));
+
+    return registrationIds;
+}
+
+std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
+{
+    std::shared_ptr<PublicationStateDefn> state = findRegistration(m_publications, registrationId);
+    std::shared_ptr<Publication> pub;
+
+    if (!state)
+    {
+        return pub;
+    }
+
+    switch (state->m_status.load(std::memory_order_acquire))
+    {
+        case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+            if (m_epochClock() > (state->m_timeOfRegistration + m_driverTimeoutMs))
+            {
+                throw DriverTimeoutException(
+                    strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
+            }
+            break;
+
+        case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+            pub = takeResource(*state);
+            break;
+
+        case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+            throw RegistrationException(state->m_errorCode, state->m_errorMessage, SOURCEINFO);
     }
 
     return pub;
@@ -119,18 +207,9 @@ void ClientConductor::releasePublication(std::int64_t registrationId)
 {
     verifyDriverIsActiveViaErrorHandler();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
-
-    if (it != m_publications.end())
+    if (removeRegistration(m_publications, registrationId))
     {
         m_driverProxy.removePublication(registrationId);
-        m_publications.erase(it);
     }
 }
 
@@ -138,59 +217,94 @@ std::int64_t ClientConductor::addExclusivePublication(const std::string& channel
 {
     verifyDriverIsActive();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-    std::int64_t registrationId = m_driverProxy.addExclusivePublication(channel, streamId);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+    std::shared_ptr<ExclusivePublicationStateDefn> state =
+        std::make_shared<ExclusivePublicationStateDefn>(channel, registrationId, streamId, m_epochClock());
 
-    m_exclusivePublications.emplace_back(channel, registrationId, streamId, m_epochClock());
+    updateRegistry(m_exclusivePublications,
+        [&](std::vector<std::shared_ptr<ExclusivePublicationStateDefn>>& entries)
+        {
+            entries.push_back(state);
+            return true;
+        });
+
+    sendToDriver(m_exclusivePublications, registrationId,
+        [&]()
+        {
+            m_driverProxy.addExclusivePublication(registrationId, channel, streamId);
+        });
 
     return registrationId;
 }
 
-std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
+std::vector<std::int64_t> ClientConductor::addExclusivePublications(
+    const std::vector<RegistrationRequest>& requests, const on_add_exclusive_publication_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    verifyDriverIsActive();
+    verifyCommandQueueHasCapacity();
+
+    const long long now = m_epochClock();
+    std::vector<std::int64_t> registrationIds;
+    std::vector<std::shared_ptr<ExclusivePublicationStateDefn>> states;
+
+    for (const RegistrationRequest& request : requests)
+    {
+        const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+        registrationIds.push_back(registrationId);
+        states.push_back(
+            std::make_shared<ExclusivePublicationStateDefn>(request.channel, registrationId, request.streamId, now));
+    }
 
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
+    updateRegistry(m_exclusivePublications,
+        [&](std::vector<std::shared_ptr<ExclusivePublicationStateDefn>>& entries)
         {
-            return (registrationId == entry.m_registrationId);
+            entries.insert(entries.end(), states.begin(), states.end());
+            return !states.empty();
         });
 
-    if (it == m_exclusivePublications.end())
+    const std::size_t sent = m_driverProxy.addExclusivePublications(registrationIds, requests);
+    std::unique_ptr<AsyncRegistrationDefn> registration(new AsyncRegistrationDefn(now, registrationIds));
+
+    registration->m_onAddExclusivePublication = handler;
+
+    for (std::size_t i = sent; i < registrationIds.size(); i++)
     {
-        return std::shared_ptr<ExclusivePublication>();
+        removeRegistration(m_exclusivePublications, registrationIds[i]);
+        registration->m_unsentRegistrationIds.push_back(registrationIds[i]);
     }
 
-    ExclusivePublicationStateDefn& state = (*it);
-    std::shared_ptr<ExclusivePublication> pub(state.m_publication.lock());
+    enqueueAsyncRegistration(std::move(registration));
 
-    if (!pub)
-    {
-        switch (state.m_status)
-        {
-            case RegistrationStatus::AWAITING_MEDIA_DRIVER:
-                if (m_epochClock() > (state.m_timeOfRegistration + m_driverTimeoutMs))
-                {
-                    throw DriverTimeoutException(
-                        strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
-                }
-                break;
+    return registrationIds;
+}
 
-            case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
-            {
-                UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, state.m_positionLimitCounterId);
+std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
+{
+    std::shared_ptr<ExclusivePublicationStateDefn> state = findRegistration(m_exclusivePublications, registrationId);
+    std::shared_ptr<ExclusivePublication> pub;
 
-                pub = std::make_shared<ExclusivePublication>(
-                    *this, state.m_channel, state.m_registrationId, state.m_originalRegistrationId, state.m_streamId,
-                    state.m_sessionId, publicationLimit, *(state.m_buffers));
+    if (!state)
+    {
+        return pub;
+    }
 
-                state.m_publication = std::weak_ptr<ExclusivePublication>(pub);
-                break;
+    switch (state->m_status.load(std::memory_order_acquire))
+    {
+        case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+            if (m_epochClock() > (state->m_timeOfRegistration + m_driverTimeoutMs))
+            {
+                throw DriverTimeoutException(
+                    strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
             }
+            break;
 
-            case RegistrationStatus::ERRORED_MEDIA_DRIVER:
-                throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
-        }
+        case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+            pub = takeResource(*state);
+            break;
+
+        case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+            throw RegistrationException(state->m_errorCode, state->m_errorMessage, SOURCEINFO);
     }
 
     return pub;
@@ -200,18 +314,9 @@ void ClientConductor::releaseExclusivePublication(std::int64_t registrationId)
 {
     verifyDriverIsActiveViaErrorHandler();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
-
-    if (it != m_exclusivePublications.end())
+    if (removeRegistration(m_exclusivePublications, registrationId))
     {
         m_driverProxy.removePublication(registrationId);
-        m_exclusivePublications.erase(it);
     }
 }
 
@@ -223,51 +328,97 @@ std::int64_t ClientConductor::addSubscription(
 {
     verifyDriverIsActive();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+    std::shared_ptr<SubscriptionStateDefn> state = std::make_shared<SubscriptionStateDefn>(
+        channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler);
 
-    std::int64_t registrationId = m_driverProxy.addSubscription(channel, streamId);
+    updateRegistry(m_subscriptions,
+        [&](std::vector<std::shared_ptr<SubscriptionStateDefn>>& entries)
+        {
+            entries.push_back(state);
+            return true;
+        });
 
-    m_subscriptions.emplace_back(
-        channel, registrationId, streamId, m_epochClock(), onAvailableImageHandler, onUnavailableImageHandler);
+    sendToDriver(m_subscriptions, registrationId,
+        [&]()
+        {
+            m_driverProxy.addSubscription(registrationId, channel, streamId);
+        });
 
     return registrationId;
 }
 
-std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
+std::vector<std::int64_t> ClientConductor::addSubscriptions(
+    const std::vector<RegistrationRequest>& requests,
+    const on_available_image_t &onAvailableImageHandler,
+    const on_unavailable_image_t &onUnavailableImageHandler,
+    const on_add_subscription_t& handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    verifyDriverIsActive();
+    verifyCommandQueueHasCapacity();
 
-    auto it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [registrationId](const SubscriptionStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    const long long now = m_epochClock();
+    std::vector<std::int64_t> registrationIds;
+    std::vector<std::shared_ptr<SubscriptionStateDefn>> states;
 
-    if (it == m_subscriptions.end())
+    for (const RegistrationRequest& request : requests)
     {
-        return std::shared_ptr<Subscription>();
+        const std::int64_t registrationId = m_driverProxy.nextCorrelationId();
+
+        registrationIds.push_back(registrationId);
+        states.push_back(std::make_shared<SubscriptionStateDefn>(
+            request.channel, registrationId, request.streamId, now, onAvailableImageHandler, onUnavailableImageHandler));
     }
 
-    SubscriptionStateDefn& state = *it;
-    std::shared_ptr<Subscription> sub = state.m_subscription.lock();
+    updateRegistry(m_subscriptions,
+        [&](std::vector<std::shared_ptr<SubscriptionStateDefn>>& entries)
+        {
+            entries.insert(entries.end(), states.begin(), states.end());
+            return !states.empty();
+        });
+
+    const std::size_t sent = m_driverProxy.addSubscriptions(registrationIds, requests);
+    std::unique_ptr<AsyncRegistrationDefn> registration(new AsyncRegistrationDefn(now, registrationIds));
+
+    registration->m_onAddSubscription = handler;
 
-    // now remove the cached value
-    if (state.m_subscriptionCache)
+    for (std::size_t i = sent; i < registrationIds.size(); i++)
     {
-        state.m_subscriptionCache.reset();
+        removeRegistration(m_subscriptions, registrationIds[i]);
+        registration->m_unsentRegistrationIds.push_back(registrationIds[i]);
     }
 
-    if (!sub && RegistrationStatus::AWAITING_MEDIA_DRIVER == state.m_status)
+    enqueueAsyncRegistration(std::move(registration));
+
+    return registrationIds;
+}
+
+std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
+{
+    std::shared_ptr<SubscriptionStateDefn> state = findRegistration(m_subscriptions, registrationId);
+    std::shared_ptr<Subscription> sub;
+
+    if (!state)
     {
-        if (m_epochClock() > (state.m_timeOfRegistration + m_driverTimeoutMs))
-        {
-            throw DriverTimeoutException(
-                strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
-        }
+        return sub;
     }
-    else if (!sub && RegistrationStatus::ERRORED_MEDIA_DRIVER == state.m_status)
+
+    switch (state->m_status.load(std::memory_order_acquire))
     {
-        throw RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO);
+        case RegistrationStatus::AWAITING_MEDIA_DRIVER:
+            if (m_epochClock() > (state->m_timeOfRegistration + m_driverTimeoutMs))
+            {
+                throw DriverTimeoutException(
+                    strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO);
+            }
+            break;
+
+        case RegistrationStatus::REGISTERED_MEDIA_DRIVER:
+            sub = takeResource(*state);
+            break;
+
+        case RegistrationStatus::ERRORED_MEDIA_DRIVER:
+            throw RegistrationException(state->m_errorCode, state->m_errorMessage, SOURCEINFO);
     }
 
     return sub;
@@ -277,26 +428,26 @@ void ClientConductor::releaseSubscription(std::int64_t registrationId, Image *im
 {
     verifyDriverIsActiveViaErrorHandler();
 
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [registrationId](const SubscriptionStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
+    std::shared_ptr<SubscriptionStateDefn> state = removeRegistration(m_subscriptions, registrationId);
 
-    if (it != m_subscriptions.end())
+    if (state)
     {
-        m_driverProxy.removeSubscription((*it).m_registrationId);
+        m_driverProxy.removeSubscription(state->m_registrationId);
 
         for (int i = 0; i < imagesLength; i++)
         {
-            (*it).m_onUnavailableImageHandler(images[i]);
+            state->m_onUnavailableImageHandler(images[i]);
         }
 
-        m_subscriptions.erase(it);
+        ReleasedImagesDefn command = { m_epochClock(), images, imagesLength };
 
-        lingerResources(m_epochClock(), images, imagesLength);
+        if (!enqueueCommand(RELEASED_IMAGES_MSG_TYPE_ID, command))
+        {
+            // the images may still be in use by other threads so are left allocated rather than deleted here
+            util::IllegalStateException exception(
+                "client conductor command queue is full, images of released subscription not lingered", SOURCEINFO);
+            m_errorHandler(exception);
+        }
     }
 }
 
@@ -322,25 +473,21 @@ void ClientConductor::onNewPublication(
     std::int64_t registrationId,
     std::int64_t originalRegistrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    std::shared_ptr<PublicationStateDefn> state = findRegistration(m_publications, registrationId);
 
-    auto it = std::find_if(m_publications.begin(), m_publications.end(),
-        [registrationId](const PublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
-
-    if (it != m_publications.end())
+    if (state && RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
     {
-        PublicationStateDefn& state = (*it);
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, positionLimitCounterId);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_positionLimitCounterId = positionLimitCounterId;
-        state.m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
-        state.m_originalRegistrationId = originalRegistrationId;
+        state->m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
+        state->m_publicationCache = std::make_shared<Publication>(
+            *this, state->m_channel, registrationId, originalRegistrationId, streamId, sessionId, publicationLimit,
+            *(state->m_buffers));
+        state->m_publication = std::weak_ptr<Publication>(state->m_publicationCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        m_onNewPublicationHandler(state->m_channel, streamId, sessionId, registrationId);
+        completeAsyncRegistration(*state);
     }
 }
 
@@ -352,48 +499,37 @@ void ClientConductor::onNewExclusivePublication(
     std::int64_t registrationId,
     std::int64_t originalRegistrationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    std::shared_ptr<ExclusivePublicationStateDefn> state = findRegistration(m_exclusivePublications, registrationId);
 
-    auto it = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [registrationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (registrationId == entry.m_registrationId);
-        });
-
-    if (it != m_exclusivePublications.end())
+    if (state && RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
     {
-        ExclusivePublicationStateDefn& state = (*it);
+        UnsafeBufferPosition publicationLimit(m_counterValuesBuffer, positionLimitCounterId);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_sessionId = sessionId;
-        state.m_positionLimitCounterId = positionLimitCounterId;
-        state.m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
-        state.m_originalRegistrationId = originalRegistrationId;
+        state->m_buffers = std::make_shared<LogBuffers>(logFileName.c_str());
+        state->m_publicationCache = std::make_shared<ExclusivePublication>(
+            *this, state->m_channel, registrationId, originalRegistrationId, streamId, sessionId, publicationLimit,
+            *(state->m_buffers));
+        state->m_publication = std::weak_ptr<ExclusivePublication>(state->m_publicationCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        m_onNewPublicationHandler(state.m_channel, streamId, sessionId, registrationId);
+        m_onNewPublicationHandler(state->m_channel, streamId, sessionId, registrationId);
+        completeAsyncRegistration(*state);
     }
 }
 
 void ClientConductor::onOperationSuccess(std::int64_t correlationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto subIt = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [correlationId](const SubscriptionStateDefn &entry)
-        {
-            return (correlationId == entry.m_registrationId);
-        });
+    std::shared_ptr<SubscriptionStateDefn> state = findRegistration(m_subscriptions, correlationId);
 
-    if (subIt != m_subscriptions.end() && (*subIt).m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
+    if (state && RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
     {
-        SubscriptionStateDefn& state = (*subIt);
+        state->m_subscriptionCache =
+            std::make_shared<Subscription>(*this, state->m_registrationId, state->m_channel, state->m_streamId);
+        state->m_subscription = std::weak_ptr<Subscription>(state->m_subscriptionCache);
+        state->m_status.store(RegistrationStatus::REGISTERED_MEDIA_DRIVER, std::memory_order_release);
 
-        state.m_status = RegistrationStatus::REGISTERED_MEDIA_DRIVER;
-        state.m_subscriptionCache =
-            std::make_shared<Subscription>(*this, state.m_registrationId, state.m_channel, state.m_streamId);
-        state.m_subscription = std::weak_ptr<Subscription>(state.m_subscriptionCache);
-        m_onNewSubscriptionHandler(state.m_channel, state.m_streamId, correlationId);
-        return;
+        m_onNewSubscriptionHandler(state->m_channel, state->m_streamId, correlationId);
+        completeAsyncRegistration(*state);
     }
 }
 
@@ -402,52 +538,32 @@ void ClientConductor::onErrorResponse(
     std::int32_t errorCode,
     const std::string& errorMessage)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
-
-    auto subIt = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
-        [offendingCommandCorrelationId](const SubscriptionStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    std::shared_ptr<SubscriptionStateDefn> subscription =
+        findRegistration(m_subscriptions, offendingCommandCorrelationId);
 
-    if (subIt != m_subscriptions.end())
+    if (onRegistrationError(subscription, errorCode, errorMessage))
     {
-        (*subIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        (*subIt).m_errorCode = errorCode;
-        (*subIt).m_errorMessage = errorMessage;
+        completeAsyncRegistration(*subscription);
         return;
     }
 
-    auto pubIt = std::find_if(m_publications.begin(), m_publications.end(),
-        [offendingCommandCorrelationId](const PublicationStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    std::shared_ptr<PublicationStateDefn> publication = findRegistration(m_publications, offendingCommandCorrelationId);
 
-    if (pubIt != m_publications.end())
+    if (onRegistrationError(publication, errorCode, errorMessage))
     {
-        (*pubIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        (*pubIt).m_errorCode = errorCode;
-        (*pubIt).m_errorMessage = errorMessage;
+        completeAsyncRegistration(*publication);
         return;
     }
 
-    auto exPubIt = std::find_if(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [offendingCommandCorrelationId](const ExclusivePublicationStateDefn &entry)
-        {
-            return (offendingCommandCorrelationId == entry.m_registrationId);
-        });
+    std::shared_ptr<ExclusivePublicationStateDefn> exclusivePublication =
+        findRegistration(m_exclusivePublications, offendingCommandCorrelationId);
 
-    if (exPubIt != m_exclusivePublications.end())
+    if (onRegistrationError(exclusivePublication, errorCode, errorMessage))
     {
-        (*exPubIt).m_status = RegistrationStatus::ERRORED_MEDIA_DRIVER;
-        (*exPubIt).m_errorCode = errorCode;
-        (*exPubIt).m_errorMessage = errorMessage;
-        return;
+        completeAsyncRegistration(*exclusivePublication);
     }
 }
 
-
 void ClientConductor::onAvailableImage(
     std::int32_t streamId,
     std::int32_t sessionId,
@@ -457,14 +573,15 @@ void ClientConductor::onAvailableImage(
     const ImageBuffersReadyDefn::SubscriberPosition *subscriberPositions,
     std::int64_t correlationId)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    const registry_t<SubscriptionStateDefn> subscriptions = std::atomic_load(&m_subscriptions);
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](const SubscriptionStateDefn &entry)
+    std::for_each(subscriptions->begin(), subscriptions->end(),
+        [&](const std::shared_ptr<SubscriptionStateDefn> &entry)
         {
-            if (streamId == entry.m_streamId)
+            if (streamId == entry->m_streamId &&
+                RegistrationStatus::REGISTERED_MEDIA_DRIVER == entry->m_status.load(std::memory_order_acquire))
             {
-                std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+                std::shared_ptr<Subscription> subscription = entry->m_subscription.lock();
 
                 if (subscription != nullptr &&
                     !(subscription->hasImage(correlationId)))
@@ -486,7 +603,7 @@ void ClientConductor::onAvailableImage(
                                 logBuffers,
                                 m_errorHandler);
 
-                            entry.m_onAvailableImageHandler(image);
+                            entry->m_onAvailableImageHandler(image);
 
                             Image* oldArray = subscription->addImage(image);
 
@@ -507,14 +624,15 @@ void ClientConductor::onUnavailableImage(
     std::int64_t correlationId)
 {
     const long long now = m_epochClock();
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    const registry_t<SubscriptionStateDefn> subscriptions = std::atomic_load(&m_subscriptions);
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](const SubscriptionStateDefn &entry)
+    std::for_each(subscriptions->begin(), subscriptions->end(),
+        [&](const std::shared_ptr<SubscriptionStateDefn> &entry)
         {
-            if (streamId == entry.m_streamId)
+            if (streamId == entry->m_streamId &&
+                RegistrationStatus::REGISTERED_MEDIA_DRIVER == entry->m_status.load(std::memory_order_acquire))
             {
-                std::shared_ptr<Subscription> subscription = entry.m_subscription.lock();
+                std::shared_ptr<Subscription> subscription = entry->m_subscription.lock();
 
                 if (nullptr != subscription)
                 {
@@ -526,7 +644,7 @@ void ClientConductor::onUnavailableImage(
                     {
                         lingerResource(now, oldArray[index].logBuffers());
                         lingerResource(now, oldArray);
-                        entry.m_onUnavailableImageHandler(oldArray[index]);
+                        entry->m_onUnavailableImageHandler(oldArray[index]);
                     }
                 }
             }
@@ -535,55 +653,161 @@ void ClientConductor::onUnavailableImage(
 
 void ClientConductor::onInterServiceTimeout(long long now)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    failAsyncRegistrations(std::make_exception_ptr(
+        ConductorServiceTimeoutException("Registration abandoned by the client conductor", SOURCEINFO)));
 
-    std::for_each(m_publications.begin(), m_publications.end(),
-        [&](PublicationStateDefn& entry)
-        {
-            std::shared_ptr<Publication> pub = entry.m_publication.lock();
+    const registry_t<PublicationStateDefn> publications =
+        std::atomic_exchange(&m_publications, emptyRegistry<PublicationStateDefn>());
 
-            if (nullptr != pub)
+    std::for_each(publications->begin(), publications->end(),
+        [&](const std::shared_ptr<PublicationStateDefn>& entry)
+        {
+            if (RegistrationStatus::REGISTERED_MEDIA_DRIVER == entry->m_status.load(std::memory_order_acquire))
             {
-                pub->close();
+                std::shared_ptr<Publication> pub = takeResource(*entry);
+
+                if (nullptr != pub)
+                {
+                    pub->close();
+                }
             }
         });
 
-    m_publications.clear();
+    const registry_t<ExclusivePublicationStateDefn> exclusivePublications =
+        std::atomic_exchange(&m_exclusivePublications, emptyRegistry<ExclusivePublicationStateDefn>());
 
-    std::for_each(m_exclusivePublications.begin(), m_exclusivePublications.end(),
-        [&](ExclusivePublicationStateDefn& entry)
+    std::for_each(exclusivePublications->begin(), exclusivePublications->end(),
+        [&](const std::shared_ptr<ExclusivePublicationStateDefn>& entry)
         {
-            std::shared_ptr<ExclusivePublication> pub = entry.m_publication.lock();
-
-            if (nullptr != pub)
+            if (RegistrationStatus::REGISTERED_MEDIA_DRIVER == entry->m_status.load(std::memory_order_acquire))
             {
-                pub->close();
+                std::shared_ptr<ExclusivePublication> pub = takeResource(*entry);
+
+                if (nullptr != pub)
+                {
+                    pub->close();
+                }
             }
         });
 
-    m_exclusivePublications.clear();
+    const registry_t<SubscriptionStateDefn> subscriptions =
+        std::atomic_exchange(&m_subscriptions, emptyRegistry<SubscriptionStateDefn>());
 
-    std::for_each(m_subscriptions.begin(), m_subscriptions.end(),
-        [&](SubscriptionStateDefn& entry)
+    std::for_each(subscriptions->begin(), subscriptions->end(),
+        [&](const std::shared_ptr<SubscriptionStateDefn>& entry)
         {
-            std::shared_ptr<Subscription> sub = entry.m_subscription.lock();
-
-            if (nullptr != sub)
+            if (RegistrationStatus::REGISTERED_MEDIA_DRIVER == entry->m_status.load(std::memory_order_acquire))
             {
-                std::pair<Image *, int> removeResult = sub->removeAndCloseAllImages();
-                Image* images = removeResult.first;
-                const int imagesLength = removeResult.second;
+                std::shared_ptr<Subscription> sub = takeResource(*entry);
+
+                if (nullptr != sub)
+                {
+                    std::pair<Image *, int> removeResult = sub->removeAndCloseAllImages();
+                    Image* images = removeResult.first;
+                    const int imagesLength = removeResult.second;
 
-                lingerResources(now, images, imagesLength);
+                    lingerResources(now, images, imagesLength);
+                }
             }
         });
+}
 
-    m_subscriptions.clear();
+void ClientConductor::onCommand(
+    std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+{
+    switch (msgTypeId)
+    {
+        case RELEASED_IMAGES_MSG_TYPE_ID:
+        {
+            const ReleasedImagesDefn& released = buffer.overlayStruct<ReleasedImagesDefn>(offset);
+
+            lingerResources(released.m_timeOfRelease, released.m_images, released.m_imagesLength);
+            break;
+        }
+
+        case ASYNC_REGISTRATION_MSG_TYPE_ID:
+        {
+            const AsyncRegistrationCommandDefn& command = buffer.overlayStruct<AsyncRegistrationCommandDefn>(offset);
+
+            onAsyncRegistration(std::shared_ptr<AsyncRegistrationDefn>(command.m_registration));
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void ClientConductor::onAsyncRegistration(std::shared_ptr<AsyncRegistrationDefn> registration)
+{
+    const std::vector<std::int64_t>& unsentIds = registration->m_unsentRegistrationIds;
+
+    for (std::int64_t registrationId : registration->m_registrationIds)
+    {
+        if (std::find(unsentIds.begin(), unsentIds.end(), registrationId) != unsentIds.end())
+        {
+            invokeAsyncRegistrationHandler(
+                [&]()
+                {
+                    registration->onError(registrationId, std::make_exception_ptr(
+                        IllegalStateException("couldn't write command to driver", SOURCEINFO)));
+                });
+        }
+        else
+        {
+            m_asyncRegistrations.emplace(registrationId, registration);
+        }
+    }
+
+    // the driver may have responded before the registration reached the conductor
+    completeAsyncRegistrations(m_publications);
+    completeAsyncRegistrations(m_exclusivePublications);
+    completeAsyncRegistrations(m_subscriptions);
+}
+
+void ClientConductor::onCheckAsyncRegistrations(long long now)
+{
+    std::vector<std::pair<std::int64_t, std::shared_ptr<AsyncRegistrationDefn>>> timedOut;
+
+    for (auto it = m_asyncRegistrations.begin(); it != m_asyncRegistrations.end();)
+    {
+        if (now > (it->second->m_timeOfRegistration + m_driverTimeoutMs))
+        {
+            timedOut.push_back(*it);
+            it = m_asyncRegistrations.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (const std::pair<std::int64_t, std::shared_ptr<AsyncRegistrationDefn>>& entry : timedOut)
+    {
+        invokeAsyncRegistrationHandler(
+            [&]()
+            {
+                entry.second->onError(entry.first, std::make_exception_ptr(DriverTimeoutException(
+                    strPrintf("No response from driver in %d ms", m_driverTimeoutMs), SOURCEINFO)));
+            });
+    }
+}
+
+void ClientConductor::failAsyncRegistrations(std::exception_ptr error)
+{
+    std::unordered_multimap<std::int64_t, std::shared_ptr<AsyncRegistrationDefn>> registrations;
+
+    registrations.swap(m_asyncRegistrations);
+
+    for (const std::pair<const std::int64_t, std::shared_ptr<AsyncRegistrationDefn>>& entry : registrations)
+    {
+        invokeAsyncRegistrationHandler([&]() { entry.second->onError(entry.first, error); });
+    }
 }
 
 void ClientConductor::onCheckManagedResources(long long now)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    onCheckAsyncRegistrations(now);
 
     // erase-remove idiom
 
@@ -18,8 +18,12 @@
 #define INCLUDED_AERON_CLIENT_CONDUCTOR__
 
 #include <vector>
-#include <mutex>
+#include <atomic>
+#include <unordered_map>
+#include <memory>
+#include <thread>
 #include <concurrent/logbuffer/TermReader.h>
+#include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
 #include <concurrent/status/UnsafeBufferPosition.h>
 #include <util/LangUtil.h>
 #include "Publication.h"
@@ -34,6 +38,7 @@ namespace aeron {
 
 using namespace aeron::concurrent::logbuffer;
 using namespace aeron::concurrent::status;
+using namespace aeron::concurrent::ringbuffer;
 using namespace aeron::concurrent;
 
 typedef std::function<long long()> epoch_clock_t;
@@ -41,7 +46,17 @@ typedef std::function<long long()> nano_clock_t;
 
 static const long KEEPALIVE_TIMEOUT_MS = 500;
 static const long RESOURCE_TIMEOUT_MS = 1000;
-
+static const util::index_t COMMAND_QUEUE_CAPACITY = 64 * 1024;
+
+/**
+ * Conductor for the client which manages registrations with the media driver and the resources they map.
+ * <p>
+ * Application threads never block behind the duty cycle of the conductor. Registrations are held in immutable
+ * snapshots which are replaced in a copy on write fashion, so lookups only take a reference to the current snapshot.
+ * The state of each registration is written once by the conductor and published by storing its status. Resources
+ * released by application threads which must outlive them, such as image arrays, are handed to the conductor via a
+ * many to one command queue.
+ */
 class ClientConductor
 {
 public:
@@ -57,7 +72,8 @@ public:
         long driverTimeoutMs,
         long resourceLingerTimeoutMs,
         long long interServiceTimeoutNs,
-        long publicationConnectionTimeoutMs) :
+        long publicationConnectionTimeoutMs,
+        bool useConductorAgentInvoker) :
         m_driverProxy(driverProxy),
         m_driverListenerAdapter(broadcastReceiver, *this),
         m_counterValuesBuffer(counterValuesBuffer),
@@ -72,7 +88,16 @@ public:
         m_resourceLingerTimeoutMs(resourceLingerTimeoutMs),
         m_interServiceTimeoutMs(static_cast<long>(interServiceTimeoutNs / 1000000)),
         m_publicationConnectionTimeoutMs(publicationConnectionTimeoutMs),
-        m_driverActive(true)
+        m_useConductorAgentInvoker(useConductorAgentInvoker),
+        m_driverActive(true),
+        m_commandQueueBuffer(static_cast<std::size_t>(COMMAND_QUEUE_CAPACITY + RingBufferDescriptor::TRAILER_LENGTH), 0),
+        m_commandBuffer(&m_commandQueueBuffer[0], static_cast<util::index_t>(m_commandQueueBuffer.size())),
+        m_commandQueue(m_commandBuffer),
+        m_commandHandler(
+            [this](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                onCommand(msgTypeId, buffer, offset, length);
+            })
     {
     }
 
@@ -82,6 +107,7 @@ public:
     {
         int workCount = 0;
 
+        workCount += m_commandQueue.read(m_commandHandler);
         workCount += m_driverListenerAdapter.receiveMessages();
         workCount += onHeartbeatCheckTimeouts();
 
@@ -93,10 +119,14 @@ public:
     }
 
     std::int64_t addPublication(const std::string& channel, std::int32_t streamId);
+    std::vector<std::int64_t> addPublications(
+        const std::vector<RegistrationRequest>& requests, const on_add_publication_t& handler);
     std::shared_ptr<Publication> findPublication(std::int64_t registrationId);
     void releasePublication(std::int64_t registrationId);
 
     std::int64_t addExclusivePublication(const std::string& channel, std::int32_t streamId);
+    std::vector<std::int64_t> addExclusivePublications(
+        const std::vector<RegistrationRequest>& requests, const on_add_exclusive_publication_t& handler);
     std::shared_ptr<ExclusivePublication> findExclusivePublication(std::int64_t registrationId);
     void releaseExclusivePublication(std::int64_t registrationId);
 
@@ -105,6 +135,11 @@ public:
         std::int32_t streamId,
         const on_available_image_t &onAvailableImageHandler,
         const on_unavailable_image_t &onUnavailableImageHandler);
+    std::vector<std::int64_t> addSubscriptions(
+        const std::vector<RegistrationRequest>& requests,
+        const on_available_image_t &onAvailableImageHandler,
+        const on_unavailable_image_t &onUnavailableImageHandler,
+        const on_add_subscription_t& handler);
     std::shared_ptr<Subscription> findSubscription(std::int64_t registrationId);
     void releaseSubscription(std::int64_t registrationId, Image *images, int imagesLength);
 
@@ -171,20 +206,22 @@ private:
     {
         std::string m_channel;
         std::int64_t m_registrationId;
-        std::int64_t m_originalRegistrationId;
         std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_positionLimitCounterId = -1;
         long long m_timeOfRegistration;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<RegistrationStatus> m_status;
         std::int32_t m_errorCode;
         std::string m_errorMessage;
         std::shared_ptr<LogBuffers> m_buffers;
+        std::shared_ptr<Publication> m_publicationCache;
         std::weak_ptr<Publication> m_publication;
 
         PublicationStateDefn(
             const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long now) :
-            m_channel(channel), m_registrationId(registrationId), m_streamId(streamId), m_timeOfRegistration(now)
+            m_channel(channel),
+            m_registrationId(registrationId),
+            m_streamId(streamId),
+            m_timeOfRegistration(now),
+            m_status(RegistrationStatus::AWAITING_MEDIA_DRIVER)
         {
         }
     };
@@ -193,20 +230,22 @@ private:
     {
         std::string m_channel;
         std::int64_t m_registrationId;
-        std::int64_t m_originalRegistrationId;
         std::int32_t m_streamId;
-        std::int32_t m_sessionId = -1;
-        std::int32_t m_positionLimitCounterId = -1;
         long long m_timeOfRegistration;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<RegistrationStatus> m_status;
         std::int32_t m_errorCode;
         std::string m_errorMessage;
         std::shared_ptr<LogBuffers> m_buffers;
+        std::shared_ptr<ExclusivePublication> m_publicationCache;
         std::weak_ptr<ExclusivePublication> m_publication;
 
         ExclusivePublicationStateDefn(
             const std::string& channel, std::int64_t registrationId, std::int32_t streamId, long long now) :
-            m_channel(channel), m_registrationId(registrationId), m_streamId(streamId), m_timeOfRegistration(now)
+            m_channel(channel),
+            m_registrationId(registrationId),
+            m_streamId(streamId),
+            m_timeOfRegistration(now),
+            m_status(RegistrationStatus::AWAITING_MEDIA_DRIVER)
         {
         }
     };
@@ -217,7 +256,7 @@ private:
         std::int64_t m_registrationId;
         std::int32_t m_streamId;
         long long m_timeOfRegistration;
-        RegistrationStatus m_status = RegistrationStatus::AWAITING_MEDIA_DRIVER;
+        std::atomic<RegistrationStatus> m_status;
         std::int32_t m_errorCode;
         std::string m_errorMessage;
         std::shared_ptr<Subscription> m_subscriptionCache;
@@ -236,6 +275,7 @@ private:
             m_registrationId(registrationId),
             m_streamId(streamId),
             m_timeOfRegistration(now),
+            m_status(RegistrationStatus::AWAITING_MEDIA_DRIVER),
             m_onAvailableImageHandler(onAvailableImageHandler),
             m_onUnavailableImageHandler(onUnavailableImageHandler)
         {
@@ -264,11 +304,81 @@ private:
         }
     };
 
-    std::recursive_mutex m_adminLock;
+    struct ReleasedImagesDefn
+    {
+        long long m_timeOfRelease;
+        Image *m_images;
+        std::int32_t m_imagesLength;
+    };
+
+    struct AsyncRegistrationDefn
+    {
+        long long m_timeOfRegistration;
+        std::vector<std::int64_t> m_registrationIds;
+        std::vector<std::int64_t> m_unsentRegistrationIds;
+        on_add_publication_t m_onAddPublication;
+        on_add_exclusive_publication_t m_onAddExclusivePublication;
+        on_add_subscription_t m_onAddSubscription;
+
+        AsyncRegistrationDefn(long long now, const std::vector<std::int64_t>& registrationIds) :
+            m_timeOfRegistration(now), m_registrationIds(registrationIds)
+        {
+        }
+
+        void onAdd(std::int64_t registrationId, std::shared_ptr<Publication> publication) const
+        {
+            m_onAddPublication(registrationId, publication, nullptr);
+        }
+
+        void onAdd(std::int64_t registrationId, std::shared_ptr<ExclusivePublication> publication) const
+        {
+            m_onAddExclusivePublication(registrationId, publication, nullptr);
+        }
+
+        void onAdd(std::int64_t registrationId, std::shared_ptr<Subscription> subscription) const
+        {
+            m_onAddSubscription(registrationId, subscription, nullptr);
+        }
+
+        void onError(std::int64_t registrationId, std::exception_ptr error) const
+        {
+            if (m_onAddPublication)
+            {
+                m_onAddPublication(registrationId, std::shared_ptr<Publication>(), error);
+            }
+            else if (m_onAddExclusivePublication)
+            {
+                m_onAddExclusivePublication(registrationId, std::shared_ptr<ExclusivePublication>(), error);
+            }
+            else if (m_onAddSubscription)
+            {
+                m_onAddSubscription(registrationId, std::shared_ptr<Subscription>(), error);
+            }
+        }
+    };
+
+    struct AsyncRegistrationCommandDefn
+    {
+        AsyncRegistrationDefn *m_registration;
+    };
+
+    static const std::int32_t RELEASED_IMAGES_MSG_TYPE_ID = 1;
+    static const std::int32_t ASYNC_REGISTRATION_MSG_TYPE_ID = 2;
+
+    /*
+     * Registries are immutable snapshots read and swapped with the std::atomic_* overloads for shared_ptr, so a find
+     * never waits on the conductor's duty cycle. These are not lock free: libstdc++ guards them with a small pool of
+     * mutexes hashed by address, held only around the pointer copy. Each add or remove copies the whole registry, so
+     * it is O(n) in the number of registrations.
+     */
+    template <typename T>
+    using registry_t = std::shared_ptr<const std::vector<std::shared_ptr<T>>>;
+
+    registry_t<PublicationStateDefn> m_publications = emptyRegistry<PublicationStateDefn>();
+    registry_t<ExclusivePublicationStateDefn> m_exclusivePublications = emptyRegistry<ExclusivePublicationStateDefn>();
+    registry_t<SubscriptionStateDefn> m_subscriptions = emptyRegistry<SubscriptionStateDefn>();
 
-    std::vector<PublicationStateDefn> m_publications;
-    std::vector<ExclusivePublicationStateDefn> m_exclusivePublications;
-    std::vector<SubscriptionStateDefn> m_subscriptions;
+    std::unordered_multimap<std::int64_t, std::shared_ptr<AsyncRegistrationDefn>> m_asyncRegistrations;
 
     std::vector<LogBuffersLingerDefn> m_lingeringLogBuffers;
     std::vector<ImageArrayLingerDefn> m_lingeringImageArrays;
@@ -290,9 +400,259 @@ private:
     long m_resourceLingerTimeoutMs;
     long m_interServiceTimeoutMs;
     long m_publicationConnectionTimeoutMs;
+    bool m_useConductorAgentInvoker;
 
     std::atomic<bool> m_driverActive;
 
+    std::vector<std::uint8_t> m_commandQueueBuffer;
+    AtomicBuffer m_commandBuffer;
+    ManyToOneRingBuffer m_commandQueue;
+    handler_t m_commandHandler;
+
+    template <typename T>
+    inline static registry_t<T> emptyRegistry()
+    {
+        return registry_t<T>(std::make_shared<std::vector<std::shared_ptr<T>>>());
+    }
+
+    template <typename T>
+    inline static std::shared_ptr<T> findRegistration(const registry_t<T>& registry, std::int64_t registrationId)
+    {
+        const registry_t<T> snapshot = std::atomic_load(&registry);
+
+        for (const std::shared_ptr<T>& entry : *snapshot)
+        {
+            if (registrationId == entry->m_registrationId)
+            {
+                return entry;
+            }
+        }
+
+        return std::shared_ptr<T>();
+    }
+
+    /*
+     * Apply an update to a copy of the current snapshot and swap it in, retrying against any snapshot which was swapped
+     * in concurrently. The update returns false when no change is needed.
+     */
+    template <typename T, typename F>
+    inline static bool updateRegistry(registry_t<T>& registry, F&& update)
+    {
+        registry_t<T> snapshot = std::atomic_load(&registry);
+
+        while (true)
+        {
+            std::shared_ptr<std::vector<std::shared_ptr<T>>> next =
+                std::make_shared<std::vector<std::shared_ptr<T>>>(*snapshot);
+
+            if (!update(*next))
+            {
+                return false;
+            }
+
+            if (std::atomic_compare_exchange_weak(&registry, &snapshot, registry_t<T>(std::move(next))))
+            {
+                return true;
+            }
+        }
+    }
+
+    template <typename T>
+    inline static std::shared_ptr<T> removeRegistration(registry_t<T>& registry, std::int64_t registrationId)
+    {
+        std::shared_ptr<T> removed;
+
+        updateRegistry(registry,
+            [&](std::vector<std::shared_ptr<T>>& entries)
+            {
+                auto it = std::find_if(entries.begin(), entries.end(),
+                    [registrationId](const std::shared_ptr<T>& entry)
+                    {
+                        return (registrationId == entry->m_registrationId);
+                    });
+
+                if (it == entries.end())
+                {
+                    removed.reset();
+                    return false;
+                }
+
+                removed = *it;
+                entries.erase(it);
+                return true;
+            });
+
+        return removed;
+    }
+
+    template <typename T, typename F>
+    inline static void sendToDriver(registry_t<T>& registry, std::int64_t registrationId, F&& send)
+    {
+        try
+        {
+            send();
+        }
+        catch (...)
+        {
+            removeRegistration(registry, registrationId);
+            throw;
+        }
+    }
+
+    template <typename T>
+    inline static bool onRegistrationError(
+        const std::shared_ptr<T>& state, std::int32_t errorCode, const std::string& errorMessage)
+    {
+        if (!state)
+        {
+            return false;
+        }
+
+        if (RegistrationStatus::AWAITING_MEDIA_DRIVER == state->m_status.load(std::memory_order_acquire))
+        {
+            state->m_errorCode = errorCode;
+            state->m_errorMessage = errorMessage;
+            state->m_status.store(RegistrationStatus::ERRORED_MEDIA_DRIVER, std::memory_order_release);
+        }
+
+        return true;
+    }
+
+    /*
+     * With a conductor thread the queue is sized well beyond the commands expected between duty cycles so this is not
+     * expected to spin. In agent invoker mode the calling thread may be the one which must invoke the conductor to
+     * drain the queue, so a full queue is returned as false rather than waited on.
+     */
+    template <typename T>
+    inline bool enqueueCommand(std::int32_t msgTypeId, T& command)
+    {
+        AtomicBuffer buffer(reinterpret_cast<std::uint8_t *>(&command), static_cast<util::index_t>(sizeof(command)));
+
+        if (m_useConductorAgentInvoker)
+        {
+            return m_commandQueue.write(msgTypeId, buffer, 0, buffer.capacity());
+        }
+
+        while (!m_commandQueue.write(msgTypeId, buffer, 0, buffer.capacity()))
+        {
+            std::this_thread::yield();
+        }
+
+        return true;
+    }
+
+    inline void enqueueAsyncRegistration(std::unique_ptr<AsyncRegistrationDefn> registration)
+    {
+        AsyncRegistrationCommandDefn command = { registration.get() };
+
+        if (!enqueueCommand(ASYNC_REGISTRATION_MSG_TYPE_ID, command))
+        {
+            throw util::IllegalStateException(
+                "client conductor command queue is full, the conductor must be invoked", SOURCEINFO);
+        }
+
+        registration.release();
+    }
+
+    template <typename T>
+    void completeAsyncRegistrations(const registry_t<T>& registry)
+    {
+        const registry_t<T> snapshot = std::atomic_load(&registry);
+
+        for (const std::shared_ptr<T>& entry : *snapshot)
+        {
+            completeAsyncRegistration(*entry);
+        }
+    }
+
+    /*
+     * Take the resource from the cache on first use so it is released once the application drops it, then hand out
+     * the same resource while it is held.
+     */
+    inline static std::shared_ptr<Publication> takeResource(PublicationStateDefn& state)
+    {
+        std::shared_ptr<Publication> pub = std::atomic_exchange(&state.m_publicationCache, std::shared_ptr<Publication>());
+
+        return pub ? pub : state.m_publication.lock();
+    }
+
+    inline static std::shared_ptr<ExclusivePublication> takeResource(ExclusivePublicationStateDefn& state)
+    {
+        std::shared_ptr<ExclusivePublication> pub =
+            std::atomic_exchange(&state.m_publicationCache, std::shared_ptr<ExclusivePublication>());
+
+        return pub ? pub : state.m_publication.lock();
+    }
+
+    inline static std::shared_ptr<Subscription> takeResource(SubscriptionStateDefn& state)
+    {
+        std::shared_ptr<Subscription> sub =
+            std::atomic_exchange(&state.m_subscriptionCache, std::shared_ptr<Subscription>());
+
+        return sub ? sub : state.m_subscription.lock();
+    }
+
+    template <typename T>
+    void completeAsyncRegistration(T& state)
+    {
+        const RegistrationStatus status = state.m_status.load(std::memory_order_acquire);
+
+        if (m_asyncRegistrations.empty() || RegistrationStatus::AWAITING_MEDIA_DRIVER == status)
+        {
+            return;
+        }
+
+        auto range = m_asyncRegistrations.equal_range(state.m_registrationId);
+        std::vector<std::shared_ptr<AsyncRegistrationDefn>> registrations;
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            registrations.push_back(it->second);
+        }
+
+        m_asyncRegistrations.erase(range.first, range.second);
+
+        for (const std::shared_ptr<AsyncRegistrationDefn>& registration : registrations)
+        {
+            invokeAsyncRegistrationHandler(
+                [&]()
+                {
+                    if (RegistrationStatus::REGISTERED_MEDIA_DRIVER == status)
+                    {
+                        registration->onAdd(state.m_registrationId, takeResource(state));
+                    }
+                    else
+                    {
+                        registration->onError(state.m_registrationId, std::make_exception_ptr(
+                            RegistrationException(state.m_errorCode, state.m_errorMessage, SOURCEINFO)));
+                    }
+                });
+        }
+    }
+
+    /*
+     * An exception from an application handler is passed to the error handler so the rest of the batch is still
+     * completed.
+     */
+    template <typename F>
+    inline void invokeAsyncRegistrationHandler(F&& handler)
+    {
+        try
+        {
+            handler();
+        }
+        catch (const std::exception& exception)
+        {
+            m_errorHandler(exception);
+        }
+    }
+
+    void onAsyncRegistration(std::shared_ptr<AsyncRegistrationDefn> registration);
+    void onCheckAsyncRegistrations(long long now);
+    void failAsyncRegistrations(std::exception_ptr error);
+
+    void onCommand(std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length);
+
     inline int onHeartbeatCheckTimeouts()
     {
         // TODO: use system nano clock since it is quicker to poll, then use epochClock only for driver activity
@@ -346,6 +706,23 @@ private:
         }
     }
 
+    /*
+     * Checked before an async add has any effect so a full queue in agent invoker mode fails the add cleanly. Twice the
+     * record length allows for padding at the end of the queue.
+     */
+    inline void verifyCommandQueueHasCapacity()
+    {
+        const util::index_t commandLength = static_cast<util::index_t>(sizeof(AsyncRegistrationCommandDefn));
+        const util::index_t recordLength = util::BitUtil::align(
+            ringbuffer::RecordDescriptor::HEADER_LENGTH + commandLength, ringbuffer::RecordDescriptor::ALIGNMENT);
+
+        if (m_useConductorAgentInvoker && m_commandQueue.size() + (2 * recordLength) > m_commandQueue.capacity())
+        {
+            throw util::IllegalStateException(
+                "client conductor command queue is full, the conductor must be invoked", SOURCEINFO);
+        }
+    }
+
     inline void verifyDriverIsActiveViaErrorHandler()
     {
         if (!m_driverActive)
@@ -18,6 +18,7 @@
 #define INCLUDED_AERON_CONTEXT__
 
 #include <memory>
+#include <exception>
 #include <util/Exceptions.h>
 #include <concurrent/AgentRunner.h>
 #include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
@@ -32,6 +33,9 @@ using namespace aeron::concurrent::logbuffer;
 using namespace aeron::concurrent::broadcast;
 
 class Image;
+class Publication;
+class ExclusivePublication;
+class Subscription;
 
 /**
  * Function called by Aeron to deliver notification of an available image
@@ -77,6 +81,49 @@ typedef std::function<void(
     std::int32_t streamId,
     std::int64_t correlationId)> on_new_subscription_t;
 
+/**
+ * Function called by Aeron on the conductor thread when an add of a Publication from a batch completes
+ *
+ * @param registrationId returned by Aeron::addPublications for the request
+ * @param publication that has been added or null if the add failed
+ * @param error that caused the add to fail or null if the add succeeded
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<Publication> publication,
+    std::exception_ptr error)> on_add_publication_t;
+
+/**
+ * Function called by Aeron on the conductor thread when an add of an ExclusivePublication from a batch completes
+ *
+ * @param registrationId returned by Aeron::addExclusivePublications for the request
+ * @param publication that has been added or null if the add failed
+ * @param error that caused the add to fail or null if the add succeeded
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<ExclusivePublication> publication,
+    std::exception_ptr error)> on_add_exclusive_publication_t;
+
+/**
+ * Function called by Aeron on the conductor thread when an add of a Subscription from a batch completes
+ *
+ * @param registrationId returned by Aeron::addSubscriptions for the request
+ * @param subscription that has been added or null if the add failed
+ * @param error that caused the add to fail or null if the add succeeded
+ */
+typedef std::function<void(
+    std::int64_t registrationId,
+    std::shared_ptr<Subscription> subscription,
+    std::exception_ptr error)> on_add_subscription_t;
+
+/**
+ * Function called on the client conductor thread after each duty cycle so it can idle when no work was done.
+ *
+ * @param workCount done in the duty cycle.
+ */
+typedef std::function<void(int workCount)> idle_strategy_t;
+
 const static long NULL_TIMEOUT = -1;
 const static long DEFAULT_MEDIA_DRIVER_TIMEOUT_MS = 10000;
 const static long DEFAULT_RESOURCE_LINGER_MS = 5000;
@@ -284,6 +331,63 @@ public:
         return *this;
     }
 
+    /**
+     * Set whether the client conductor is run by the application via {@link Aeron::conductorAgentInvoker} rather
+     * than on a thread of its own.
+     *
+     * The application must then call AgentInvoker::invoke regularly, well within the client liveness timeout of the
+     * media driver, and idle as it sees fit between calls.
+     *
+     * @param value true to invoke the client conductor from the application.
+     * @return reference to this Context instance
+     */
+    inline this_t& useConductorAgentInvoker(bool value)
+    {
+        m_useConductorAgentInvoker = value;
+        return *this;
+    }
+
+    /**
+     * Is the client conductor run by the application via {@link Aeron::conductorAgentInvoker}.
+     *
+     * @return true if the client conductor is run by the application.
+     */
+    inline bool useConductorAgentInvoker() const
+    {
+        return m_useConductorAgentInvoker;
+    }
+
+    /**
+     * Set the idle strategy for the client conductor thread when it is not run via an agent invoker. By default the
+     * thread sleeps for a few milliseconds when idle.
+     *
+     * A BackoffIdleStrategy or AdaptiveIdleStrategy held by the application can be plugged in to trade CPU for
+     * latency, and its phase times read from any thread:
+     *
+     * <pre>
+     *   auto idleStrategy = std::make_shared<BackoffIdleStrategy>();
+     *   context.conductorIdleStrategy([idleStrategy](int workCount) { idleStrategy->idle(workCount); });
+     * </pre>
+     *
+     * @param idleStrategy to call after each duty cycle of the client conductor.
+     * @return reference to this Context instance
+     */
+    inline this_t& conductorIdleStrategy(const idle_strategy_t& idleStrategy)
+    {
+        m_conductorIdleStrategy = idleStrategy;
+        return *this;
+    }
+
+    /**
+     * Get the idle strategy for the client conductor thread.
+     *
+     * @return idle strategy for the client conductor thread or an empty function to use the default.
+     */
+    inline const idle_strategy_t& conductorIdleStrategy() const
+    {
+        return m_conductorIdleStrategy;
+    }
+
     inline static std::string tmpDir()
     {
 #if defined(_MSC_VER)
@@ -350,6 +454,8 @@ private:
     long m_mediaDriverTimeout = NULL_TIMEOUT;
     long m_resourceLingerTimeout = NULL_TIMEOUT;
     long m_publicationConnectionTimeout = NULL_TIMEOUT;
+    bool m_useConductorAgentInvoker = false;
+    idle_strategy_t m_conductorIdleStrategy;
 };
 
 }
@@ -16,6 +16,7 @@
 #ifndef AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
+#include <type_traits>
 #include <unordered_map>
 #include "Aeron.h"
 #include "BufferBuilder.h"
@@ -34,10 +35,39 @@ static const std::size_t DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 40
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is a template parameter so a lambda or functor can be called directly, letting the whole
+ * Image::controlledPoll to delegate chain inline. {@link ControlledFragmentAssembler} is the std::function
+ * form and {@link makeControlledFragmentAssembler} deduces the delegate type.
+ *
+ * @tparam Handler callable as ControlledPollAction(AtomicBuffer&, util::index_t, util::index_t, Header&).
  */
-class ControlledFragmentAssembler
+template <typename Handler>
+class BasicControlledFragmentAssembler
 {
 public:
+    typedef BasicControlledFragmentAssembler<Handler> this_t;
+
+    /**
+     * Fragment handler composed with a BasicControlledFragmentAssembler instance which is cheap to copy and can be
+     * inlined by Image::controlledPoll. It converts to controlled_poll_fragment_handler_t where type erasure is needed.
+     */
+    class FragmentHandler
+    {
+    public:
+        explicit FragmentHandler(this_t& assembler) : m_assembler(assembler)
+        {
+        }
+
+        inline ControlledPollAction operator()(
+            AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header) const
+        {
+            return m_assembler.onFragment(buffer, offset, length, header);
+        }
+
+    private:
+        this_t& m_assembler;
+    };
 
     /**
      * Construct an adapter to reassembly message fragments and delegate on only whole messages.
@@ -45,8 +75,8 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    ControlledFragmentAssembler(
-        const controlled_poll_fragment_handler_t& delegate,
+    BasicControlledFragmentAssembler(
+        const Handler& delegate,
         size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength),
         m_delegate(delegate)
@@ -54,17 +84,14 @@ public:
     }
 
     /**
-     * Compose a controlled_poll_fragment_handler_t that calls the this ControlledFragmentAssembler instance for reassembly. Suitable for
-     * passing to Subscription::poll(controlled_poll_fragment_handler_t, int).
+     * Compose a handler that calls the this ControlledFragmentAssembler instance for reassembly. Suitable for
+     * passing to Image::controlledPoll(controlled_poll_fragment_handler_t, int).
      *
-     * @return controlled_poll_fragment_handler_t composed with the ControlledFragmentAssembler instance
+     * @return handler composed with the ControlledFragmentAssembler instance
      */
-    controlled_poll_fragment_handler_t handler()
+    FragmentHandler handler()
     {
-        return [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
-        {
-            return this->onFragment(buffer, offset, length, header);
-        };
+        return FragmentHandler(*this);
     }
 
     /**
@@ -80,7 +107,7 @@ public:
 
 private:
     std::size_t m_initialBufferLength;
-    controlled_poll_fragment_handler_t m_delegate;
+    Handler m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
     ControlledPollAction onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
@@ -155,5 +182,25 @@ private:
     }
 };
 
+/**
+ * Controlled fragment assembler which delegates to a controlled_poll_fragment_handler_t.
+ */
+typedef BasicControlledFragmentAssembler<controlled_poll_fragment_handler_t> ControlledFragmentAssembler;
+
+/**
+ * Construct a controlled fragment assembler with the delegate type deduced so calls to it can be inlined.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return the controlled fragment assembler.
+ */
+template <typename Handler>
+inline BasicControlledFragmentAssembler<typename std::decay<Handler>::type> makeControlledFragmentAssembler(
+    Handler&& delegate, size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return BasicControlledFragmentAssembler<typename std::decay<Handler>::type>(
+        std::forward<Handler>(delegate), initialBufferLength);
+}
+
 }
 #endif
@@ -18,6 +18,7 @@
 #define INCLUDED_AERON_DRIVER_PROXY__
 
 #include <array>
+#include <vector>
 #include <concurrent/ringbuffer/ManyToOneRingBuffer.h>
 #include <command/PublicationMessageFlyweight.h>
 #include <command/RemoveMessageFlyweight.h>
@@ -31,6 +32,15 @@ using namespace aeron::command;
 using namespace aeron::concurrent;
 using namespace aeron::concurrent::ringbuffer;
 
+/**
+ * Channel and stream of a publication or subscription to be added as part of a batch.
+ */
+struct RegistrationRequest
+{
+    std::string channel;
+    std::int32_t streamId;
+};
+
 class DriverProxy
 {
 public:
@@ -48,10 +58,22 @@ public:
         return m_toDriverCommandBuffer.consumerHeartbeatTime();
     }
 
+    inline std::int64_t nextCorrelationId()
+    {
+        return m_toDriverCommandBuffer.nextCorrelationId();
+    }
+
     std::int64_t addPublication(const std::string& channel, std::int32_t streamId)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
+        addPublication(correlationId, channel, streamId);
+
+        return correlationId;
+    }
+
+    void addPublication(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             PublicationMessageFlyweight publicationMessage(buffer, 0);
@@ -65,14 +87,19 @@ public:
 
             return ControlProtocolEvents::ADD_PUBLICATION;
         });
-
-        return correlationId;
     }
 
     std::int64_t addExclusivePublication(const std::string& channel, std::int32_t streamId)
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
+        addExclusivePublication(correlationId, channel, streamId);
+
+        return correlationId;
+    }
+
+    void addExclusivePublication(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             PublicationMessageFlyweight publicationMessage(buffer, 0);
@@ -86,8 +113,32 @@ public:
 
             return ControlProtocolEvents::ADD_EXCLUSIVE_PUBLICATION;
         });
+    }
 
-        return correlationId;
+    /**
+     * Add a batch of publications, encoding as many commands as fit into each write to the driver.
+     *
+     * @param correlationIds for each of the requests.
+     * @param requests       to be sent to the driver.
+     * @return the number of requests written, which is less than requested when the driver buffer is full.
+     */
+    std::size_t addPublications(
+        const std::vector<std::int64_t>& correlationIds, const std::vector<RegistrationRequest>& requests)
+    {
+        return writePublicationBatchToDriver(correlationIds, requests, ControlProtocolEvents::ADD_PUBLICATION);
+    }
+
+    /**
+     * Add a batch of exclusive publications, encoding as many commands as fit into each write to the driver.
+     *
+     * @param correlationIds for each of the requests.
+     * @param requests       to be sent to the driver.
+     * @return the number of requests written, which is less than requested when the driver buffer is full.
+     */
+    std::size_t addExclusivePublications(
+        const std::vector<std::int64_t>& correlationIds, const std::vector<RegistrationRequest>& requests)
+    {
+        return writePublicationBatchToDriver(correlationIds, requests, ControlProtocolEvents::ADD_EXCLUSIVE_PUBLICATION);
     }
 
     std::int64_t removePublication(std::int64_t registrationId)
@@ -114,6 +165,13 @@ public:
     {
         std::int64_t correlationId = m_toDriverCommandBuffer.nextCorrelationId();
 
+        addSubscription(correlationId, channel, streamId);
+
+        return correlationId;
+    }
+
+    void addSubscription(std::int64_t correlationId, const std::string& channel, std::int32_t streamId)
+    {
         writeCommandToDriver([&](AtomicBuffer &buffer, util::index_t &length)
         {
             SubscriptionMessageFlyweight subscriptionMessage(buffer, 0);
@@ -128,8 +186,33 @@ public:
 
             return ControlProtocolEvents::ADD_SUBSCRIPTION;
         });
+    }
 
-        return correlationId;
+    /**
+     * Add a batch of subscriptions, encoding as many commands as fit into each write to the driver.
+     *
+     * @param correlationIds for each of the requests.
+     * @param requests       to be sent to the driver.
+     * @return the number of requests written, which is less than requested when the driver buffer is full.
+     */
+    std::size_t addSubscriptions(
+        const std::vector<std::int64_t>& correlationIds, const std::vector<RegistrationRequest>& requests)
+    {
+        return writeBatchToDriver(requests.size(),
+            [&](std::size_t index, AtomicBuffer &buffer, util::index_t &length)
+            {
+                SubscriptionMessageFlyweight subscriptionMessage(buffer, 0);
+
+                subscriptionMessage.clientId(m_clientId);
+                subscriptionMessage.registrationCorrelationId(-1);
+                subscriptionMessage.correlationId(correlationIds[index]);
+                subscriptionMessage.streamId(requests[index].streamId);
+                subscriptionMessage.channel(requests[index].channel);
+
+                length = subscriptionMessage.length();
+
+                return ControlProtocolEvents::ADD_SUBSCRIPTION;
+            });
     }
 
     std::int64_t removeSubscription(std::int64_t registrationId)
@@ -227,6 +310,87 @@ private:
             throw util::IllegalStateException("couldn't write command to driver", SOURCEINFO);
         }
     }
+
+    inline std::size_t writePublicationBatchToDriver(
+        const std::vector<std::int64_t>& correlationIds,
+        const std::vector<RegistrationRequest>& requests,
+        std::int32_t msgTypeId)
+    {
+        return writeBatchToDriver(requests.size(),
+            [&](std::size_t index, AtomicBuffer &buffer, util::index_t &length)
+            {
+                PublicationMessageFlyweight publicationMessage(buffer, 0);
+
+                publicationMessage.clientId(m_clientId);
+                publicationMessage.correlationId(correlationIds[index]);
+                publicationMessage.streamId(requests[index].streamId);
+                publicationMessage.channel(requests[index].channel);
+
+                length = publicationMessage.length();
+
+                return msgTypeId;
+            });
+    }
+
+    /*
+     * Frame each command as a ring buffer record in a batch buffer so the to driver buffer is claimed once per batch
+     * rather than once per command. Batches are bounded by the max message length of the to driver buffer.
+     */
+    template <typename F>
+    std::size_t writeBatchToDriver(std::size_t count, F&& filler)
+    {
+        std::vector<std::uint8_t> batch(static_cast<std::size_t>(m_toDriverCommandBuffer.maxMsgLength()), 0);
+        AtomicBuffer batchBuffer(&batch[0], static_cast<util::index_t>(batch.size()));
+        util::index_t batchLength = 0;
+        std::size_t batchStart = 0;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            AERON_DECL_ALIGNED(driver_proxy_command_buffer_t messageBuffer, 16);
+            AtomicBuffer buffer(messageBuffer);
+            util::index_t length = buffer.capacity();
+
+            const std::int32_t msgTypeId = filler(i, buffer, length);
+            const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+            const util::index_t alignedLength = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+
+            if (batchLength + alignedLength > batchBuffer.capacity())
+            {
+                if (batchLength > 0)
+                {
+                    if (!m_toDriverCommandBuffer.writeBatch(batchBuffer, 0, batchLength))
+                    {
+                        return batchStart;
+                    }
+
+                    batchStart = i;
+                    batchLength = 0;
+                }
+
+                if (alignedLength > batchBuffer.capacity())
+                {
+                    if (!m_toDriverCommandBuffer.write(msgTypeId, buffer, 0, length))
+                    {
+                        return i;
+                    }
+
+                    batchStart = i + 1;
+                    continue;
+                }
+            }
+
+            batchBuffer.putInt64(batchLength, RecordDescriptor::makeHeader(recordLength, msgTypeId));
+            batchBuffer.putBytes(RecordDescriptor::encodedMsgOffset(batchLength), buffer, 0, length);
+            batchLength += alignedLength;
+        }
+
+        if (batchLength > 0 && !m_toDriverCommandBuffer.writeBatch(batchBuffer, 0, batchLength))
+        {
+            return batchStart;
+        }
+
+        return count;
+    }
 };
 
 }
@@ -308,6 +308,140 @@ public:
         return offer(buffer, 0, buffer.capacity());
     }
 
+    /**
+     * Non-blocking publish of a message gathered from a sequence of buffers, written directly into the log without
+     * first being copied into a single staging buffer.
+     *
+     * @param startBuffer iterator to the first buffer holding the message.
+     * @param lastBuffer iterator one past the last buffer holding the message.
+     * @param reservedValueSupplier for the frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <class BufferIterator>
+    std::int64_t offer(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const util::index_t length = gatheredLength(startBuffer, lastBuffer);
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit)
+            {
+                std::int32_t result;
+                if (length <= m_maxPayloadLength)
+                {
+                    result = termAppender->appendUnfragmentedMessage(
+                        m_termId, m_termOffset, m_headerWriter, startBuffer, length, reservedValueSupplier);
+                }
+                else
+                {
+                    result = termAppender->appendFragmentedMessage(
+                        m_termId, m_termOffset, m_headerWriter, startBuffer, length, m_maxPayloadLength, reservedValueSupplier);
+                }
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else if (isPublicationConnected(LogBufferDescriptor::timeOfLastStatusMessage(m_logMetaDataBuffer)))
+            {
+                newPosition = BACK_PRESSURED;
+            }
+            else
+            {
+                newPosition = NOT_CONNECTED;
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of a message gathered from an array of buffers.
+     *
+     * @param buffers holding the message in order.
+     * @param length of the buffers array.
+     * @param reservedValueSupplier for the frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer buffers[],
+        std::size_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        return offer(buffers, buffers + length, reservedValueSupplier);
+    }
+
+    /**
+     * Non-blocking publish of a batch of messages, one per buffer, which are appended with a single advance of the
+     * log tail and become visible to subscribers together. Each message must fit within {@link #maxPayloadLength()}
+     * and the framed batch within {@link #maxMessageLength()}.
+     *
+     * @param startBuffer iterator to the first message in the batch.
+     * @param lastBuffer iterator one past the last message in the batch.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <class BufferIterator>
+    std::int64_t offerBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const util::index_t length = batchLength(startBuffer, lastBuffer);
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit)
+            {
+                const std::int32_t result = termAppender->appendUnfragmentedBatch(
+                    m_termId, m_termOffset, m_headerWriter, startBuffer, lastBuffer, length, reservedValueSupplier);
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else if (isPublicationConnected(LogBufferDescriptor::timeOfLastStatusMessage(m_logMetaDataBuffer)))
+            {
+                newPosition = BACK_PRESSURED;
+            }
+            else
+            {
+                newPosition = NOT_CONNECTED;
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of a batch of messages held in an array of buffers, one message per buffer.
+     *
+     * @param buffers holding the messages in order.
+     * @param length of the buffers array.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    inline std::int64_t offerBatch(
+        const concurrent::AtomicBuffer buffers[],
+        std::size_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        return offerBatch(buffers, buffers + length, reservedValueSupplier);
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -451,6 +585,47 @@ private:
         }
     }
 
+    template <class BufferIterator>
+    inline util::index_t gatheredLength(BufferIterator startBuffer, BufferIterator lastBuffer) const
+    {
+        std::int64_t length = 0;
+
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            length += it->capacity();
+        }
+
+        if (length > m_maxMessageLength)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("Encoded message exceeds maxMessageLength of %d, length=%lld",
+                    m_maxMessageLength, static_cast<long long>(length)), SOURCEINFO);
+        }
+
+        return static_cast<util::index_t>(length);
+    }
+
+    template <class BufferIterator>
+    inline util::index_t batchLength(BufferIterator startBuffer, BufferIterator lastBuffer) const
+    {
+        std::int64_t length = 0;
+
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            checkForMaxPayloadLength(it->capacity());
+            length += util::BitUtil::align(it->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+        }
+
+        if (length > m_maxMessageLength)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("Encoded batch exceeds maxMessageLength of %d, length=%lld",
+                    m_maxMessageLength, static_cast<long long>(length)), SOURCEINFO);
+        }
+
+        return static_cast<util::index_t>(length);
+    }
+
     inline void checkForMaxPayloadLength(const util::index_t length) const
     {
         if (AERON_COND_EXPECT((length > m_maxPayloadLength), false))
@@ -17,6 +17,7 @@
 #ifndef AERON_FRAGMENTASSEMBLYADAPTER_H
 #define AERON_FRAGMENTASSEMBLYADAPTER_H
 
+#include <type_traits>
 #include <unordered_map>
 #include "Aeron.h"
 #include "BufferBuilder.h"
@@ -35,10 +36,38 @@ static const std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is a template parameter so a lambda or functor can be called directly, letting the whole
+ * Subscription::poll to delegate chain inline. {@link FragmentAssembler} is the std::function form and
+ * {@link makeFragmentAssembler} deduces the delegate type.
+ *
+ * @tparam Handler callable as void(AtomicBuffer&, util::index_t, util::index_t, Header&).
  */
-class FragmentAssembler
+template <typename Handler>
+class BasicFragmentAssembler
 {
 public:
+    typedef BasicFragmentAssembler<Handler> this_t;
+
+    /**
+     * Fragment handler composed with a BasicFragmentAssembler instance which is cheap to copy and can be inlined
+     * by Subscription::poll and Image::poll. It converts to fragment_handler_t where type erasure is needed.
+     */
+    class FragmentHandler
+    {
+    public:
+        explicit FragmentHandler(this_t& assembler) : m_assembler(assembler)
+        {
+        }
+
+        inline void operator()(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header) const
+        {
+            m_assembler.onFragment(buffer, offset, length, header);
+        }
+
+    private:
+        this_t& m_assembler;
+    };
 
     /**
      * Construct an adapter to reassembly message fragments and delegate on only whole messages.
@@ -46,24 +75,21 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    FragmentAssembler(
-        const fragment_handler_t& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+    BasicFragmentAssembler(
+        const Handler& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength), m_delegate(delegate)
     {
     }
 
     /**
-     * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
+     * Compose a handler that calls the this FragmentAssembler instance for reassembly. Suitable for
      * passing to Subscription::poll(fragment_handler_t, int).
      *
-     * @return fragment_handler_t composed with the FragmentAssembler instance
+     * @return handler composed with the FragmentAssembler instance
      */
-    fragment_handler_t handler()
+    FragmentHandler handler()
     {
-        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
-        {
-            this->onFragment(buffer, offset, length, header);
-        };
+        return FragmentHandler(*this);
     }
 
     /**
@@ -79,10 +105,10 @@ public:
 
 private:
     std::size_t m_initialBufferLength;
-    fragment_handler_t m_delegate;
+    Handler m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
-    void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    inline void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
     {
         const std::uint8_t flags = header.flags();
 
@@ -92,36 +118,42 @@ private:
         }
         else
         {
-            if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
-            {
-                auto result = m_builderBySessionIdMap.emplace(header.sessionId(), m_initialBufferLength);
-                BufferBuilder& builder = result.first->second;
+            onFragmentedMessage(buffer, offset, length, header, flags);
+        }
+    }
 
-                builder
-                    .reset()
-                    .append(buffer, offset, length, header);
-            }
-            else
+    void onFragmentedMessage(
+        AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header, std::uint8_t flags)
+    {
+        if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            auto result = m_builderBySessionIdMap.emplace(header.sessionId(), m_initialBufferLength);
+            BufferBuilder& builder = result.first->second;
+
+            builder
+                .reset()
+                .append(buffer, offset, length, header);
+        }
+        else
+        {
+            auto result = m_builderBySessionIdMap.find(header.sessionId());
+
+            if (result != m_builderBySessionIdMap.end())
             {
-                auto result = m_builderBySessionIdMap.find(header.sessionId());
+                BufferBuilder& builder = result->second;
 
-                if (result != m_builderBySessionIdMap.end())
+                if (builder.limit() != DataFrameHeader::LENGTH)
                 {
-                    BufferBuilder& builder = result->second;
+                    builder.append(buffer, offset, length, header);
 
-                    if (builder.limit() != DataFrameHeader::LENGTH)
+                    if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
                     {
-                        builder.append(buffer, offset, length, header);
+                        const util::index_t msgLength = builder.limit() - DataFrameHeader::LENGTH;
+                        AtomicBuffer msgBuffer(builder.buffer(), builder.limit());
 
-                        if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
-                        {
-                            const util::index_t msgLength = builder.limit() - DataFrameHeader::LENGTH;
-                            AtomicBuffer msgBuffer(builder.buffer(), builder.limit());
+                        m_delegate(msgBuffer, DataFrameHeader::LENGTH, msgLength, header);
 
-                            m_delegate(msgBuffer, DataFrameHeader::LENGTH, msgLength, header);
-
-                            builder.reset();
-                        }
+                        builder.reset();
                     }
                 }
             }
@@ -129,6 +161,26 @@ private:
     }
 };
 
+/**
+ * Fragment assembler which delegates to a fragment_handler_t.
+ */
+typedef BasicFragmentAssembler<fragment_handler_t> FragmentAssembler;
+
+/**
+ * Construct a fragment assembler with the delegate type deduced so calls to it can be inlined.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return the fragment assembler.
+ */
+template <typename Handler>
+inline BasicFragmentAssembler<typename std::decay<Handler>::type> makeFragmentAssembler(
+    Handler&& delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return BasicFragmentAssembler<typename std::decay<Handler>::type>(
+        std::forward<Handler>(delegate), initialBufferLength);
+}
+
 }
 
 #endif //AERON_FRAGMENTASSEMBLYADAPTER_H
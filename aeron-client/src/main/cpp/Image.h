@@ -77,6 +77,27 @@ typedef std::function<ControlledPollAction(
     util::index_t length,
     Header &header)> controlled_poll_fragment_handler_t;
 
+/**
+ * Callback for handling a block of committed messages being read from a log file, which can be transferred to a
+ * file or socket with sendfile, splice or copy_file_range without being copied through user space.
+ *
+ * @param fileDescriptor of the log file, or -1 if the log is not backed by an open file.
+ * @param fileOffset     at which the block begins in the log file.
+ * @param termBuffer     mapping the term containing the block.
+ * @param termOffset     at which the block begins in the term.
+ * @param length         of the block in bytes.
+ * @param sessionId      of the stream containing this block of message fragments.
+ * @param termId         of the stream containing this block of message fragments.
+ */
+typedef std::function<void(
+    int fileDescriptor,
+    std::int64_t fileOffset,
+    concurrent::AtomicBuffer& termBuffer,
+    util::index_t termOffset,
+    util::index_t length,
+    std::int32_t sessionId,
+    std::int32_t termId)> raw_block_handler_t;
+
 /**
  * Represents a replicated publication {@link Image} from a publisher to a {@link Subscription}.
  * Each {@link Image} identifies a source publisher by session id.
@@ -429,6 +450,217 @@ public:
         return result;
     }
 
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered via the fragment_handler_t up to a limited number of fragments as specified or the
+     * limit position reached, whichever comes first.
+     *
+     * @param fragmentHandler to which messages are delivered.
+     * @param limitPosition   to consume messages up to, fragments ending after it are not delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F>
+    inline int boundedPoll(F&& fragmentHandler, std::int64_t limitPosition, int fragmentLimit)
+    {
+        int result = IMAGE_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t initialPosition = m_subscriberPosition.get();
+            const std::int32_t initialOffset = (std::int32_t) initialPosition & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(initialPosition,
+                m_positionBitsToShift)];
+            const std::int32_t limitOffset = static_cast<std::int32_t>(std::min(
+                static_cast<std::int64_t>(termBuffer.capacity()), (limitPosition - initialPosition) + initialOffset));
+            int fragmentsRead = 0;
+            std::int32_t offset = initialOffset;
+
+            try
+            {
+                while (fragmentsRead < fragmentLimit && offset < limitOffset)
+                {
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+
+                    if (frameOffset + alignedLength > limitOffset)
+                    {
+                        break;
+                    }
+
+                    offset += alignedLength;
+
+                    if (!FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        m_header.buffer(termBuffer);
+                        m_header.offset(frameOffset);
+
+                        fragmentHandler(
+                            termBuffer, frameOffset + DataFrameHeader::LENGTH, length - DataFrameHeader::LENGTH, m_header);
+
+                        ++fragmentsRead;
+                    }
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                m_exceptionHandler(ex);
+            }
+
+            const std::int64_t newPosition = initialPosition + (offset - initialOffset);
+            if (newPosition > initialPosition)
+            {
+                m_subscriberPosition.setOrdered(newPosition);
+            }
+
+            result = fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Poll for new messages in a stream up to the position currently held by a counter, such as the subscriber
+     * position of another consumer being trailed.
+     *
+     * @param fragmentHandler to which messages are delivered.
+     * @param limitPosition   counter holding the position to consume messages up to.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see fragment_handler_t
+     */
+    template <typename F, class X>
+    inline int boundedPoll(F&& fragmentHandler, ReadablePosition<X>& limitPosition, int fragmentLimit)
+    {
+        return boundedPoll(fragmentHandler, limitPosition.getVolatile(), fragmentLimit);
+    }
+
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered to the controlled_poll_fragment_handler_t up to a limited number of fragments as specified
+     * or the limit position reached, whichever comes first.
+     *
+     * To assemble messages that span multiple fragments then use ControlledFragmentAssembler.
+     *
+     * @param fragmentHandler to which message fragments are delivered.
+     * @param limitPosition   to consume messages up to, fragments ending after it are not delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see controlled_poll_fragment_handler_t
+     */
+    template <typename F>
+    inline int boundedControlledPoll(F&& fragmentHandler, std::int64_t limitPosition, int fragmentLimit)
+    {
+        int result = IMAGE_CLOSED;
+
+        if (!isClosed())
+        {
+            std::int64_t position = m_subscriberPosition.get();
+            std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            AtomicBuffer &termBuffer = m_termBuffers[LogBufferDescriptor::indexByPosition(position,
+                m_positionBitsToShift)];
+            const std::int32_t limitOffset = static_cast<std::int32_t>(std::min(
+                static_cast<std::int64_t>(termBuffer.capacity()), (limitPosition - position) + termOffset));
+            int fragmentsRead = 0;
+            std::int32_t offset = termOffset;
+
+            try
+            {
+                while (fragmentsRead < fragmentLimit && offset < limitOffset)
+                {
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+
+                    if (frameOffset + alignedLength > limitOffset)
+                    {
+                        break;
+                    }
+
+                    offset += alignedLength;
+
+                    if (!FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        m_header.buffer(termBuffer);
+                        m_header.offset(frameOffset);
+
+                        const ControlledPollAction action =
+                            fragmentHandler(
+                                termBuffer,
+                                frameOffset + DataFrameHeader::LENGTH,
+                                length - DataFrameHeader::LENGTH,
+                                m_header);
+
+                        ++fragmentsRead;
+
+                        if (ControlledPollAction::BREAK == action)
+                        {
+                            break;
+                        }
+                        else if (ControlledPollAction::ABORT == action)
+                        {
+                            --fragmentsRead;
+                            offset = frameOffset;
+                            break;
+                        }
+                        else if (ControlledPollAction::COMMIT == action)
+                        {
+                            position += (offset - termOffset);
+                            termOffset = offset;
+                            m_subscriberPosition.setOrdered(position);
+                        }
+                    }
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                m_exceptionHandler(ex);
+            }
+
+            const std::int64_t newPosition = position + (offset - termOffset);
+            if (newPosition > position)
+            {
+                m_subscriberPosition.setOrdered(newPosition);
+            }
+
+            result = fragmentsRead;
+        }
+
+        return result;
+    }
+
+    /**
+     * Controlled poll for new messages in a stream up to the position currently held by a counter, such as the
+     * subscriber position of another consumer being trailed.
+     *
+     * @param fragmentHandler to which message fragments are delivered.
+     * @param limitPosition   counter holding the position to consume messages up to.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     *
+     * @see controlled_poll_fragment_handler_t
+     */
+    template <typename F, class X>
+    inline int boundedControlledPoll(F&& fragmentHandler, ReadablePosition<X>& limitPosition, int fragmentLimit)
+    {
+        return boundedControlledPoll(fragmentHandler, limitPosition.getVolatile(), fragmentLimit);
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered via the block_handler_t up to a limited number of bytes.
@@ -478,7 +710,57 @@ public:
         return result;
     }
 
-    // TODO: filePoll() with fd/HANDLE (or MemoryMappedFile) ptr access
+    /**
+     * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
+     * will be delivered via the raw_block_handler_t as the location of a block in the log file, up to a limited
+     * number of bytes.
+     *
+     * @param rawBlockHandler  to which block is delivered.
+     * @param blockLengthLimit up to which a block may be in length.
+     * @return the number of bytes that have been consumed.
+     *
+     * @see raw_block_handler_t
+     */
+    template <typename F>
+    inline int rawPoll(F&& rawBlockHandler, int blockLengthLimit)
+    {
+        int result = IMAGE_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t position = m_subscriberPosition.get();
+            const std::int32_t termOffset = (std::int32_t) position & m_termLengthMask;
+            const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+            AtomicBuffer &termBuffer = m_termBuffers[index];
+            const std::int32_t limit = termOffset + std::min(blockLengthLimit, termBuffer.capacity() - termOffset);
+
+            const std::int32_t resultingOffset = TermBlockScanner::scan(termBuffer, termOffset, limit);
+
+            const std::int32_t length = resultingOffset - termOffset;
+
+            if (resultingOffset > termOffset)
+            {
+                try
+                {
+                    const std::int64_t fileOffset = m_logBuffers->termFileOffset(index) + termOffset;
+                    const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+
+                    rawBlockHandler(
+                        m_logBuffers->fileDescriptor(), fileOffset, termBuffer, termOffset, length, m_sessionId, termId);
+                }
+                catch (const std::exception& ex)
+                {
+                    m_exceptionHandler(ex);
+                }
+
+                m_subscriberPosition.setOrdered(position + length);
+            }
+
+            result = length;
+        }
+
+        return result;
+    }
 
     std::shared_ptr<LogBuffers> logBuffers()
     {
@@ -14,6 +14,12 @@
  * limitations under the License.
  */
 
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include <util/Exceptions.h>
 #include "LogBuffers.h"
 
 namespace aeron {
@@ -21,12 +27,27 @@ namespace aeron {
 using namespace aeron::util;
 using namespace aeron::concurrent::logbuffer;
 
+/*
+ * Logs from drivers that do not record the term length and page size in the meta data are never padded so the term
+ * length can be derived from the log length.
+ */
+static std::int64_t logTermLength(AtomicBuffer& logMetaDataBuffer, std::int64_t logLength)
+{
+    const std::int32_t termLength = LogBufferDescriptor::termLength(logMetaDataBuffer);
+
+    return 0 != termLength ? termLength : LogBufferDescriptor::computeTermLength(logLength);
+}
+
+static std::int64_t logPageSize(AtomicBuffer& logMetaDataBuffer)
+{
+    const std::int32_t pageSize = LogBufferDescriptor::pageSize(logMetaDataBuffer);
+
+    return 0 != pageSize ? pageSize : LogBufferDescriptor::PAGE_MIN_SIZE;
+}
+
 LogBuffers::LogBuffers(const char *filename)
 {
     const std::int64_t logLength = MemoryMappedFile::getFileSize(filename);
-    const std::int64_t termLength = LogBufferDescriptor::computeTermLength(logLength);
-
-    LogBufferDescriptor::checkTermLength(termLength);
 
     if (logLength < LogBufferDescriptor::MAX_SINGLE_MAPPING_SIZE)
     {
@@ -34,24 +55,45 @@ LogBuffers::LogBuffers(const char *filename)
 
         std::uint8_t *basePtr = m_memoryMappedFiles[0]->getMemoryPtr();
 
+        m_buffers[LogBufferDescriptor::PARTITION_COUNT]
+            .wrap(basePtr + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
+                LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+        const std::int64_t termLength = logTermLength(m_buffers[LogBufferDescriptor::PARTITION_COUNT], logLength);
+        const std::int64_t pageSize = logPageSize(m_buffers[LogBufferDescriptor::PARTITION_COUNT]);
+
+        LogBufferDescriptor::checkTermLength(termLength, pageSize);
+
+        if (pageSize > LogBufferDescriptor::PAGE_MIN_SIZE)
+        {
+            m_memoryMappedFiles[0]->adviseHugePages();
+        }
+
         for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
         {
             m_buffers[i].wrap(basePtr + (i * termLength), util::convertSizeToIndex(termLength));
         }
-
-        m_buffers[LogBufferDescriptor::PARTITION_COUNT]
-            .wrap(basePtr + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
-                LogBufferDescriptor::LOG_META_DATA_LENGTH);
     }
     else
     {
-        const index_t metaDataSectionOffset = (index_t) (termLength * LogBufferDescriptor::PARTITION_COUNT);
-        const std::int64_t metaDataSectionLength = (index_t) (logLength - metaDataSectionOffset);
+        // terms this large are page aligned for any page size so the meta data section starts at the last term end
+        const std::int64_t metaDataSectionOffset =
+            ((logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH) / LogBufferDescriptor::PAGE_MAX_SIZE) *
+                LogBufferDescriptor::PAGE_MAX_SIZE;
+        const std::int64_t metaDataSectionLength = logLength - metaDataSectionOffset;
 
         m_memoryMappedFiles.push_back(
             MemoryMappedFile::mapExisting(filename, metaDataSectionOffset, metaDataSectionLength));
 
-        std::uint8_t *metaDataBasePtr = m_memoryMappedFiles[0]->getMemoryPtr();
+        std::uint8_t *metaDataBasePtr =
+            m_memoryMappedFiles[0]->getMemoryPtr() + (metaDataSectionLength - LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+        m_buffers[LogBufferDescriptor::PARTITION_COUNT].wrap(metaDataBasePtr, LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+        const std::int64_t termLength = logTermLength(m_buffers[LogBufferDescriptor::PARTITION_COUNT], logLength);
+        const std::int64_t pageSize = logPageSize(m_buffers[LogBufferDescriptor::PARTITION_COUNT]);
+
+        LogBufferDescriptor::checkTermLength(termLength, pageSize);
 
         for (int i = 0; i < LogBufferDescriptor::PARTITION_COUNT; i++)
         {
@@ -60,11 +102,23 @@ LogBuffers::LogBuffers(const char *filename)
 
             std::uint8_t *basePtr = m_memoryMappedFiles[i + 1]->getMemoryPtr();
 
+            if (pageSize > LogBufferDescriptor::PAGE_MIN_SIZE)
+            {
+                m_memoryMappedFiles[i + 1]->adviseHugePages();
+            }
+
             m_buffers[i].wrap(basePtr, util::convertSizeToIndex(termLength));
         }
+    }
 
-        m_buffers[LogBufferDescriptor::PARTITION_COUNT].wrap(metaDataBasePtr, LogBufferDescriptor::LOG_META_DATA_LENGTH);
+#ifndef _WIN32
+    m_fileDescriptor = ::open(filename, O_RDONLY | O_CLOEXEC);
+
+    if (m_fileDescriptor < 0)
+    {
+        throw IOException(std::string("Failed to open existing file: ") + filename, SOURCEINFO);
     }
+#endif
 }
 
 LogBuffers::LogBuffers(std::uint8_t *address, index_t length)
@@ -81,6 +135,14 @@ LogBuffers::LogBuffers(std::uint8_t *address, index_t length)
             LogBufferDescriptor::LOG_META_DATA_LENGTH);
 }
 
-LogBuffers::~LogBuffers() = default;
+LogBuffers::~LogBuffers()
+{
+#ifndef _WIN32
+    if (m_fileDescriptor >= 0)
+    {
+        ::close(m_fileDescriptor);
+    }
+#endif
+}
 
 }
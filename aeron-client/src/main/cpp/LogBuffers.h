@@ -42,9 +42,32 @@ public:
         return m_buffers[index];
     }
 
+    /**
+     * File descriptor of the log file which is held open for zero copy transfers of committed blocks, or -1 if the
+     * log was not mapped from a file or the platform does not support it.
+     *
+     * @return file descriptor of the log file or -1 if not available.
+     */
+    inline int fileDescriptor() const
+    {
+        return m_fileDescriptor;
+    }
+
+    /**
+     * Offset in the log file at which a term begins.
+     *
+     * @param index of the term partition.
+     * @return offset in the log file at which the term begins.
+     */
+    inline std::int64_t termFileOffset(int index) const
+    {
+        return static_cast<std::int64_t>(index) * m_buffers[0].capacity();
+    }
+
 private:
     std::vector<MemoryMappedFile::ptr_t> m_memoryMappedFiles;
     AtomicBuffer m_buffers[LogBufferDescriptor::PARTITION_COUNT + 1];
+    int m_fileDescriptor = -1;
 };
 
 }
@@ -318,6 +318,82 @@ public:
         return offer(buffer, 0, buffer.capacity());
     }
 
+    /**
+     * Non-blocking publish of a message gathered from a sequence of buffers, written directly into the log without
+     * first being copied into a single staging buffer.
+     *
+     * @param startBuffer iterator to the first buffer holding the message.
+     * @param lastBuffer iterator one past the last buffer holding the message.
+     * @param reservedValueSupplier for the frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template <class BufferIterator>
+    std::int64_t offer(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const util::index_t length = gatheredLength(startBuffer, lastBuffer);
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t partitionIndex = LogBufferDescriptor::activePartitionIndex(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[partitionIndex].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int64_t position =
+                LogBufferDescriptor::computeTermBeginPosition(
+                    LogBufferDescriptor::termId(rawTail), m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (position < limit)
+            {
+                TermAppender::Result appendResult;
+                if (length <= m_maxPayloadLength)
+                {
+                    termAppender->appendUnfragmentedMessage(
+                        appendResult, m_headerWriter, startBuffer, length, reservedValueSupplier);
+                }
+                else
+                {
+                    termAppender->appendFragmentedMessage(
+                        appendResult, m_headerWriter, startBuffer, length, m_maxPayloadLength, reservedValueSupplier);
+                }
+
+                newPosition = Publication::newPosition(partitionIndex, static_cast<std::int32_t>(termOffset), position, appendResult);
+            }
+            else if (isPublicationConnected(LogBufferDescriptor::timeOfLastStatusMessage(m_logMetaDataBuffer)))
+            {
+                newPosition = BACK_PRESSURED;
+            }
+            else
+            {
+                newPosition = NOT_CONNECTED;
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Non-blocking publish of a message gathered from an array of buffers.
+     *
+     * @param buffers holding the message in order.
+     * @param length of the buffers array.
+     * @param reservedValueSupplier for the frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer buffers[],
+        std::size_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        return offer(buffers, buffers + length, reservedValueSupplier);
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -459,6 +535,26 @@ private:
         }
     }
 
+    template <class BufferIterator>
+    util::index_t gatheredLength(BufferIterator startBuffer, BufferIterator lastBuffer)
+    {
+        std::int64_t length = 0;
+
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            length += it->capacity();
+        }
+
+        if (length > m_maxMessageLength)
+        {
+            throw util::IllegalStateException(
+                util::strPrintf("Encoded message exceeds maxMessageLength of %d, length=%lld",
+                    m_maxMessageLength, static_cast<long long>(length)), SOURCEINFO);
+        }
+
+        return static_cast<util::index_t>(length);
+    }
+
     void checkForMaxPayloadLength(const util::index_t length)
     {
         if (length > m_maxPayloadLength)
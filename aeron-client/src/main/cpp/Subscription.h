@@ -127,6 +127,125 @@ public:
         return fragmentsRead;
     }
 
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments, consuming each {@link Image}
+     * no further than the limit position.
+     * <p>
+     * The same limit is applied to every {@link Image} so this is intended for streams with a single publisher,
+     * such as a follower trailing the position of a leader.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param limitPosition   to consume messages up to in each {@link Image}.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple {@link Image}s.
+     * @return the number of fragments received
+     *
+     * @see Image#boundedPoll
+     */
+    template <typename F>
+    inline int boundedPoll(F&& fragmentHandler, std::int64_t limitPosition, int fragmentLimit)
+    {
+        int fragmentsRead = 0;
+        const int length = std::atomic_load(&m_imagesLength);
+        Image *images = std::atomic_load(&m_images);
+
+        if (length > 0)
+        {
+            int startingIndex = m_roundRobinIndex;
+            if (startingIndex >= length)
+            {
+                m_roundRobinIndex = startingIndex = 0;
+            }
+
+            int i = startingIndex;
+
+            do
+            {
+                fragmentsRead += images[i].boundedPoll(fragmentHandler, limitPosition, fragmentLimit - fragmentsRead);
+
+                if (++i == length)
+                {
+                    i = 0;
+                }
+            }
+            while (fragmentsRead < fragmentLimit && i != startingIndex);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Poll the {@link Image}s under the subscription up to the position currently held by a counter.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param limitPosition   counter holding the position to consume messages up to in each {@link Image}.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple {@link Image}s.
+     * @return the number of fragments received
+     */
+    template <typename F, class X>
+    inline int boundedPoll(F&& fragmentHandler, concurrent::status::ReadablePosition<X>& limitPosition, int fragmentLimit)
+    {
+        return boundedPoll(fragmentHandler, limitPosition.getVolatile(), fragmentLimit);
+    }
+
+    /**
+     * Controlled poll of the {@link Image}s under the subscription for available message fragments, consuming each
+     * {@link Image} no further than the limit position.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param limitPosition   to consume messages up to in each {@link Image}.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple {@link Image}s.
+     * @return the number of fragments received
+     *
+     * @see Image#boundedControlledPoll
+     */
+    template <typename F>
+    inline int boundedControlledPoll(F&& fragmentHandler, std::int64_t limitPosition, int fragmentLimit)
+    {
+        int fragmentsRead = 0;
+        const int length = std::atomic_load(&m_imagesLength);
+        Image *images = std::atomic_load(&m_images);
+
+        if (length > 0)
+        {
+            int startingIndex = m_roundRobinIndex;
+            if (startingIndex >= length)
+            {
+                m_roundRobinIndex = startingIndex = 0;
+            }
+
+            int i = startingIndex;
+
+            do
+            {
+                fragmentsRead += images[i].boundedControlledPoll(
+                    fragmentHandler, limitPosition, fragmentLimit - fragmentsRead);
+
+                if (++i == length)
+                {
+                    i = 0;
+                }
+            }
+            while (fragmentsRead < fragmentLimit && i != startingIndex);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Controlled poll of the {@link Image}s under the subscription up to the position currently held by a counter.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param limitPosition   counter holding the position to consume messages up to in each {@link Image}.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple {@link Image}s.
+     * @return the number of fragments received
+     */
+    template <typename F, class X>
+    inline int boundedControlledPoll(
+        F&& fragmentHandler, concurrent::status::ReadablePosition<X>& limitPosition, int fragmentLimit)
+    {
+        return boundedControlledPoll(fragmentHandler, limitPosition.getVolatile(), fragmentLimit);
+    }
+
     /**
      * Poll the {@link Image}s under the subscription for available message fragments in blocks.
      *
@@ -149,7 +268,28 @@ public:
         return bytesConsumed;
     }
 
-    // TODO: add filePoll to return MemoryMappedFile
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments in blocks located in the
+     * log files, so they can be transferred without being copied through user space.
+     *
+     * @param rawBlockHandler  to receive the location of a block of fragments from each {@link Image}.
+     * @param blockLengthLimit for each individual block.
+     * @return the number of bytes consumed.
+     */
+    template <typename F>
+    inline long rawPoll(F&& rawBlockHandler, int blockLengthLimit)
+    {
+        const int length = std::atomic_load(&m_imagesLength);
+        Image *images = std::atomic_load(&m_images);
+        long bytesConsumed = 0;
+
+        for (int i = 0; i < length; i++)
+        {
+            bytesConsumed += images[i].rawPoll(rawBlockHandler, blockLengthLimit);
+        }
+
+        return bytesConsumed;
+    }
 
     /**
      * Count of images connected to this subscription.
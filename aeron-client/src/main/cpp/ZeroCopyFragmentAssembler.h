@@ -0,0 +1,328 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ZEROCOPYFRAGMENTASSEMBLER_H
+#define AERON_ZEROCOPYFRAGMENTASSEMBLER_H
+
+#include <unordered_map>
+#include "Aeron.h"
+#include "BufferBuilder.h"
+#include "FragmentAssembler.h"
+
+namespace aeron {
+
+/**
+ * View over a whole message which may be left in place as a run of fragments in the term, separated only by their
+ * frame headers, or held contiguously in a single buffer.
+ */
+class FragmentedMessage
+{
+public:
+    FragmentedMessage(AtomicBuffer& buffer, util::index_t offset, util::index_t length) :
+        m_buffer(buffer), m_offset(offset), m_limit(offset + length), m_length(length), m_isContiguous(true)
+    {
+    }
+
+    FragmentedMessage(AtomicBuffer& termBuffer, util::index_t frameOffset, util::index_t frameLimit, util::index_t length) :
+        m_buffer(termBuffer), m_offset(frameOffset), m_limit(frameLimit), m_length(length), m_isContiguous(false)
+    {
+    }
+
+    /**
+     * Length of the message payload in bytes.
+     *
+     * @return length of the message payload in bytes.
+     */
+    inline util::index_t length() const
+    {
+        return m_length;
+    }
+
+    /**
+     * Is the message payload held contiguously in a single buffer so it can be read as one range.
+     *
+     * @return true if the message payload is a single range otherwise false for a run of fragments.
+     */
+    inline bool isContiguous() const
+    {
+        return m_isContiguous;
+    }
+
+    /**
+     * Visit each range of the message payload in order.
+     *
+     * @param func called with (AtomicBuffer& buffer, util::index_t offset, util::index_t length) for each range.
+     * @throws util::IllegalStateException if a fragment left in place no longer has a valid frame length.
+     */
+    template <typename F>
+    inline void forEachFragment(F&& func) const
+    {
+        if (m_isContiguous)
+        {
+            func(m_buffer, m_offset, m_length);
+        }
+        else
+        {
+            for (util::index_t offset = m_offset; offset < m_limit;)
+            {
+                const std::int32_t frameLength = m_buffer.getInt32(FrameDescriptor::lengthOffset(offset));
+
+                if (frameLength < DataFrameHeader::LENGTH || frameLength > m_limit - offset)
+                {
+                    throw util::IllegalStateException(
+                        util::strPrintf("invalid frame length %d at term offset %d", frameLength, offset), SOURCEINFO);
+                }
+
+                func(m_buffer, offset + DataFrameHeader::LENGTH, frameLength - DataFrameHeader::LENGTH);
+                offset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+        }
+    }
+
+    /**
+     * Copy the message payload into a destination which must have at least {@link #length()} bytes available.
+     *
+     * @param destination to copy the message payload into.
+     */
+    inline void getBytes(std::uint8_t *destination) const
+    {
+        forEachFragment(
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                ::memcpy(destination, buffer.buffer() + offset, static_cast<std::size_t>(length));
+                destination += length;
+            });
+    }
+
+private:
+    AtomicBuffer& m_buffer;
+    const util::index_t m_offset;
+    const util::index_t m_limit;
+    const util::index_t m_length;
+    const bool m_isContiguous;
+};
+
+/**
+ * Callback for handling whole messages which may be left in place in the term as a run of fragments.
+ *
+ * @param message view over the message payload.
+ * @param header  representing the meta data for the last fragment of the message.
+ */
+typedef std::function<void(const FragmentedMessage& message, Header& header)> fragmented_message_handler_t;
+
+/**
+ * A handler that sits in a chain-of-responsibility pattern that reassembles fragmented messages without copying
+ * them when all fragments lie back to back in the same term, which is how a publication appends them.
+ * <p>
+ * Fragments are only valid in the term until the poll that delivered them completes. Once the subscriber position
+ * moves past them the publisher may clean them, as an IPC publication does below the minimum subscriber position.
+ * A message is therefore left in place only when all its fragments arrive within a single poll. Fragments of a
+ * message that is still incomplete at the end of a poll are copied into a session buffer by {@link #onPollComplete()},
+ * as is a message whose fragments are not contiguous in the same buffer, and then assembled as
+ * {@link FragmentAssembler} does.
+ */
+class ZeroCopyFragmentAssembler
+{
+public:
+
+    /**
+     * Construct an adapter to reassemble message fragments in place and delegate on only whole messages.
+     *
+     * @param delegate            onto which whole messages are forwarded.
+     * @param initialBufferLength to be used for each session when falling back to copying.
+     */
+    ZeroCopyFragmentAssembler(
+        const fragmented_message_handler_t& delegate,
+        size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+        m_initialBufferLength(initialBufferLength), m_delegate(delegate)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the this ZeroCopyFragmentAssembler instance for reassembly. Suitable
+     * for passing to Subscription::poll(fragment_handler_t, int), after which {@link #onPollComplete()} must be
+     * called. {@link #poll(P&, int)} does both.
+     *
+     * @return fragment_handler_t composed with the ZeroCopyFragmentAssembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+    /**
+     * Poll a Subscription or Image for fragments with this assembler, then complete the poll.
+     *
+     * @param source        Subscription or Image to poll.
+     * @param fragmentLimit for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been received.
+     */
+    template <typename P>
+    int poll(P& source, int fragmentLimit)
+    {
+        const int fragmentsRead = source.poll(handler(), fragmentLimit);
+
+        onPollComplete();
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Copy the fragments of any message still being assembled in place into its session buffer, before the end of
+     * the poll lets them be cleaned from the term. Must be called after each poll using {@link #handler()}.
+     */
+    void onPollComplete()
+    {
+        for (auto& entry : m_assemblyBySessionIdMap)
+        {
+            Assembly& assembly = entry.second;
+
+            if (assembly.isActive && !assembly.isCopying)
+            {
+                copyInPlaceFragments(assembly);
+            }
+        }
+    }
+
+    /**
+     * Free existing session state to reduce memory pressure when an Image goes inactive.
+     *
+     * @param sessionId to have its state freed
+     */
+    void deleteSessionBuffer(std::int32_t sessionId)
+    {
+        m_assemblyBySessionIdMap.erase(sessionId);
+    }
+
+private:
+    struct Assembly
+    {
+        AtomicBuffer termBuffer;
+        util::index_t beginFrameOffset = 0;
+        util::index_t nextFrameOffset = 0;
+        util::index_t length = 0;
+        bool isActive = false;
+        bool isCopying = false;
+        std::unique_ptr<BufferBuilder> builder;
+    };
+
+    std::size_t m_initialBufferLength;
+    fragmented_message_handler_t m_delegate;
+    std::unordered_map<std::int32_t, Assembly> m_assemblyBySessionIdMap;
+
+    void onFragment(AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_delegate(FragmentedMessage(buffer, offset, length), header);
+        }
+        else if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            Assembly& assembly = m_assemblyBySessionIdMap[header.sessionId()];
+
+            assembly.termBuffer.wrap(buffer);
+            assembly.beginFrameOffset = header.offset();
+            assembly.nextFrameOffset = nextFrameOffset(header.offset(), length);
+            assembly.length = length;
+            assembly.isActive = true;
+            assembly.isCopying = false;
+        }
+        else
+        {
+            auto result = m_assemblyBySessionIdMap.find(header.sessionId());
+
+            if (result != m_assemblyBySessionIdMap.end() && result->second.isActive)
+            {
+                Assembly& assembly = result->second;
+
+                if (!assembly.isCopying &&
+                    (buffer.buffer() != assembly.termBuffer.buffer() || header.offset() != assembly.nextFrameOffset))
+                {
+                    copyInPlaceFragments(assembly);
+                }
+
+                if (assembly.isCopying)
+                {
+                    assembly.builder->append(buffer, offset, length, header);
+                }
+                else
+                {
+                    assembly.nextFrameOffset = nextFrameOffset(header.offset(), length);
+                    assembly.length += length;
+                }
+
+                if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+                {
+                    assembly.isActive = false;
+
+                    if (assembly.isCopying)
+                    {
+                        BufferBuilder& builder = *assembly.builder;
+                        AtomicBuffer msgBuffer(builder.buffer(), builder.limit());
+
+                        m_delegate(
+                            FragmentedMessage(msgBuffer, DataFrameHeader::LENGTH, builder.limit() - DataFrameHeader::LENGTH),
+                            header);
+
+                        builder.reset();
+                    }
+                    else
+                    {
+                        m_delegate(
+                            FragmentedMessage(
+                                assembly.termBuffer, assembly.beginFrameOffset, assembly.nextFrameOffset, assembly.length),
+                            header);
+                    }
+                }
+            }
+        }
+    }
+
+    void copyInPlaceFragments(Assembly& assembly)
+    {
+        /* the builder does not read the header of appended fragments */
+        Header header(0, assembly.termBuffer.capacity());
+
+        if (!assembly.builder)
+        {
+            assembly.builder.reset(new BufferBuilder(static_cast<std::uint32_t>(m_initialBufferLength)));
+        }
+
+        BufferBuilder& builder = assembly.builder->reset();
+        FragmentedMessage(assembly.termBuffer, assembly.beginFrameOffset, assembly.nextFrameOffset, assembly.length)
+            .forEachFragment(
+                [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+                {
+                    builder.append(buffer, offset, length, header);
+                });
+
+        assembly.isCopying = true;
+    }
+
+    inline static util::index_t nextFrameOffset(util::index_t frameOffset, util::index_t length)
+    {
+        return frameOffset + util::BitUtil::align(length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+};
+
+}
+
+#endif //AERON_ZEROCOPYFRAGMENTASSEMBLER_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ADAPTIVEIDLESTRATEGY_H
+#define AERON_ADAPTIVEIDLESTRATEGY_H
+
+#include "BackoffIdleStrategy.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Backoff idle strategy that tunes how long it spins from when work arrives.
+ *
+ * Work arriving while yielding means a longer spin would have caught it so the spins are doubled up to a limit.
+ * Work arriving while parked means the gaps between work are long and spinning only burns the core so the spins
+ * are halved.
+ */
+class AdaptiveIdleStrategy : public BackoffIdleStrategy
+{
+public:
+    static const std::int64_t DEFAULT_SPIN_LIMIT = 10 * 1000;
+
+    AdaptiveIdleStrategy(
+        std::int64_t maxSpins = DEFAULT_MAX_SPINS,
+        std::int64_t spinLimit = DEFAULT_SPIN_LIMIT,
+        std::int64_t maxYields = DEFAULT_MAX_YIELDS,
+        std::chrono::nanoseconds minParkPeriod = std::chrono::microseconds(1),
+        std::chrono::nanoseconds maxParkPeriod = std::chrono::milliseconds(1)) :
+        BackoffIdleStrategy(maxSpins, maxYields, minParkPeriod, maxParkPeriod),
+        m_spinLimit(spinLimit < maxSpins ? maxSpins : spinLimit)
+    {
+    }
+
+    inline void idle(int workCount)
+    {
+        if (workCount > 0)
+        {
+            switch (resetPhase())
+            {
+                case Phase::YIELDING:
+                    m_maxSpins = std::max<std::int64_t>(1, std::min(m_maxSpins * 2, m_spinLimit));
+                    break;
+
+                case Phase::PARKING:
+                    m_maxSpins = std::max<std::int64_t>(1, m_maxSpins / 2);
+                    break;
+
+                default:
+                    break;
+            }
+
+            return;
+        }
+
+        BackoffIdleStrategy::idle();
+    }
+
+private:
+    const std::int64_t m_spinLimit;
+};
+
+}}
+
+#endif //AERON_ADAPTIVEIDLESTRATEGY_H
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INCLUDED_AERON_COMMON_AGENT_INVOKER__
+#define INCLUDED_AERON_COMMON_AGENT_INVOKER__
+
+#include <util/Exceptions.h>
+#include <concurrent/logbuffer/TermReader.h>
+
+namespace aeron {
+
+namespace concurrent {
+
+/**
+ * Runs the duty cycle of an Agent on the thread of the caller of {@link #invoke()}, as an alternative to
+ * {@link AgentRunner} which spawns a thread of its own. The caller is responsible for idling between invocations.
+ */
+template <typename Agent>
+class AgentInvoker
+{
+public:
+    AgentInvoker(Agent& agent, logbuffer::exception_handler_t& exceptionHandler) :
+        m_agent(agent),
+        m_exceptionHandler(exceptionHandler)
+    {
+    }
+
+    /**
+     * Mark the invoker as started so that calls to {@link #invoke()} run the duty cycle of the Agent.
+     */
+    inline void start()
+    {
+        if (!m_isClosed)
+        {
+            m_isStarted = true;
+        }
+    }
+
+    /**
+     * Invoke the duty cycle of the Agent once. Exceptions are passed to the exception handler.
+     *
+     * @return the amount of work done by the Agent, or 0 if the invoker has not been started or has been closed.
+     */
+    inline int invoke()
+    {
+        int workCount = 0;
+
+        if (m_isStarted && !m_isClosed)
+        {
+            try
+            {
+                workCount = m_agent.doWork();
+            }
+            catch (const util::SourcedException &exception)
+            {
+                m_exceptionHandler(exception);
+            }
+        }
+
+        return workCount;
+    }
+
+    inline bool isStarted() const
+    {
+        return m_isStarted;
+    }
+
+    inline bool isClosed() const
+    {
+        return m_isClosed;
+    }
+
+    /**
+     * Close the invoker so further calls to {@link #invoke()} do no work, then close the Agent.
+     */
+    inline void close()
+    {
+        if (!m_isClosed)
+        {
+            m_isClosed = true;
+            m_agent.onClose();
+        }
+    }
+
+private:
+    Agent& m_agent;
+    logbuffer::exception_handler_t& m_exceptionHandler;
+    bool m_isStarted = false;
+    bool m_isClosed = false;
+};
+
+}}
+
+#endif
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_BACKOFFIDLESTRATEGY_H
+#define AERON_BACKOFFIDLESTRATEGY_H
+
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "Atomic64.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Idle strategy that spins, then yields, then parks for an exponentially growing period up to a maximum.
+ *
+ * The time spent in each phase is measured when the phase ends and can be read from any thread, so the trade of
+ * CPU for latency can be observed per agent.
+ */
+class BackoffIdleStrategy
+{
+public:
+    static const std::int64_t DEFAULT_MAX_SPINS = 10;
+    static const std::int64_t DEFAULT_MAX_YIELDS = 5;
+
+    BackoffIdleStrategy(
+        std::int64_t maxSpins = DEFAULT_MAX_SPINS,
+        std::int64_t maxYields = DEFAULT_MAX_YIELDS,
+        std::chrono::nanoseconds minParkPeriod = std::chrono::microseconds(1),
+        std::chrono::nanoseconds maxParkPeriod = std::chrono::milliseconds(1)) :
+        m_maxSpins(maxSpins),
+        m_maxYields(maxYields),
+        m_minParkPeriod(minParkPeriod),
+        m_maxParkPeriod(maxParkPeriod < minParkPeriod ? minParkPeriod : maxParkPeriod),
+        m_parkPeriod(minParkPeriod)
+    {
+        for (auto& phaseTimeNs : m_phaseTimeNs)
+        {
+            phaseTimeNs.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    inline void idle(int workCount)
+    {
+        if (workCount > 0)
+        {
+            reset();
+            return;
+        }
+
+        idle();
+    }
+
+    /**
+     * Perform the next step of backing off when no work has been done.
+     */
+    inline void idle()
+    {
+        switch (m_phase)
+        {
+            case Phase::NOT_IDLE:
+                m_phase = Phase::SPINNING;
+                m_phaseStartNs = nanoTime();
+                m_spins = 0;
+                // fall through
+
+            case Phase::SPINNING:
+                if (m_spins++ < m_maxSpins)
+                {
+                    atomic::cpu_pause();
+                    break;
+                }
+
+                endPhase(Phase::YIELDING);
+                m_yields = 0;
+                // fall through
+
+            case Phase::YIELDING:
+                if (m_yields++ < m_maxYields)
+                {
+                    std::this_thread::yield();
+                    break;
+                }
+
+                endPhase(Phase::PARKING);
+                m_parkPeriod = m_minParkPeriod;
+                // fall through
+
+            case Phase::PARKING:
+                std::this_thread::sleep_for(m_parkPeriod);
+                m_parkPeriod = std::min(m_parkPeriod * 2, m_maxParkPeriod);
+                break;
+        }
+    }
+
+    /**
+     * Reset the backoff so the next idle starts by spinning again.
+     */
+    inline void reset()
+    {
+        resetPhase();
+    }
+
+    /**
+     * Number of times to spin before yielding.
+     *
+     * @return number of times to spin before yielding.
+     */
+    inline std::int64_t maxSpins() const
+    {
+        return m_maxSpins;
+    }
+
+    /**
+     * Total time spent spinning when idle.
+     *
+     * @return total time spent spinning when idle in nanoseconds.
+     */
+    inline std::int64_t spinTimeNs() const
+    {
+        return m_phaseTimeNs[Phase::SPINNING].load(std::memory_order_acquire);
+    }
+
+    /**
+     * Total time spent yielding when idle.
+     *
+     * @return total time spent yielding when idle in nanoseconds.
+     */
+    inline std::int64_t yieldTimeNs() const
+    {
+        return m_phaseTimeNs[Phase::YIELDING].load(std::memory_order_acquire);
+    }
+
+    /**
+     * Total time spent parked when idle.
+     *
+     * @return total time spent parked when idle in nanoseconds.
+     */
+    inline std::int64_t parkTimeNs() const
+    {
+        return m_phaseTimeNs[Phase::PARKING].load(std::memory_order_acquire);
+    }
+
+protected:
+    enum Phase : std::uint8_t
+    {
+        NOT_IDLE = 0, SPINNING = 1, YIELDING = 2, PARKING = 3
+    };
+
+    std::int64_t m_maxSpins;
+
+    /**
+     * End the current idle period, if any, and accumulate the time spent in the phase it ended in.
+     *
+     * @return the phase the idle period ended in.
+     */
+    inline Phase resetPhase()
+    {
+        const Phase phase = m_phase;
+
+        if (Phase::NOT_IDLE != phase)
+        {
+            endPhase(Phase::NOT_IDLE);
+        }
+
+        return phase;
+    }
+
+private:
+    const std::int64_t m_maxYields;
+    const std::chrono::nanoseconds m_minParkPeriod;
+    const std::chrono::nanoseconds m_maxParkPeriod;
+    std::chrono::nanoseconds m_parkPeriod;
+    std::int64_t m_spins = 0;
+    std::int64_t m_yields = 0;
+    std::int64_t m_phaseStartNs = 0;
+    Phase m_phase = Phase::NOT_IDLE;
+    std::array<std::atomic<std::int64_t>, 4> m_phaseTimeNs;
+
+    inline static std::int64_t nanoTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    inline void endPhase(Phase nextPhase)
+    {
+        const std::int64_t nowNs = nanoTime();
+        std::atomic<std::int64_t>& phaseTimeNs = m_phaseTimeNs[m_phase];
+
+        phaseTimeNs.store(
+            phaseTimeNs.load(std::memory_order_relaxed) + (nowNs - m_phaseStartNs), std::memory_order_release);
+        m_phaseStartNs = nowNs;
+        m_phase = nextPhase;
+    }
+};
+
+}}
+
+#endif //AERON_BACKOFFIDLESTRATEGY_H
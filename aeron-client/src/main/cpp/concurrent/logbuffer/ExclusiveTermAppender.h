@@ -188,6 +188,195 @@ public:
         return resultingOffset;
     }
 
+    template <class BufferIterator>
+    inline std::int32_t appendUnfragmentedMessage(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriter& header,
+        BufferIterator bufferIt,
+        util::index_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+        const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + alignedLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            header.write(m_termBuffer, termOffset, frameLength, termId);
+
+            util::index_t payloadOffset = termOffset + DataFrameHeader::LENGTH;
+            for (util::index_t remaining = length; remaining > 0; ++bufferIt)
+            {
+                const util::index_t numBytes = std::min(remaining, bufferIt->capacity());
+
+                m_termBuffer.putBytes(payloadOffset, bufferIt->buffer(), numBytes);
+                payloadOffset += numBytes;
+                remaining -= numBytes;
+            }
+
+            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, termOffset, frameLength);
+            m_termBuffer.putInt64(termOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, termOffset, frameLength);
+        }
+
+        return resultingOffset;
+    }
+
+    template <class BufferIterator>
+    std::int32_t appendFragmentedMessage(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriter& header,
+        BufferIterator bufferIt,
+        util::index_t length,
+        util::index_t maxPayloadLength,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const int numMaxPayloads = length / maxPayloadLength;
+        const util::index_t remainingPayload = length % maxPayloadLength;
+        const util::index_t lastFrameLength = (remainingPayload > 0) ?
+            util::BitUtil::align(remainingPayload + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT) : 0;
+        const util::index_t requiredLength =
+            (numMaxPayloads * (maxPayloadLength + DataFrameHeader::LENGTH)) + lastFrameLength;
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + requiredLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            std::uint8_t flags = FrameDescriptor::BEGIN_FRAG;
+            util::index_t remaining = length;
+            std::int32_t offset = static_cast<std::int32_t>(termOffset);
+            util::index_t bufferOffset = 0;
+
+            do
+            {
+                const util::index_t bytesToWrite = std::min(remaining, maxPayloadLength);
+                const util::index_t frameLength = bytesToWrite + DataFrameHeader::LENGTH;
+                const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+                header.write(m_termBuffer, offset, frameLength, termId);
+
+                util::index_t payloadOffset = offset + DataFrameHeader::LENGTH;
+                for (util::index_t bytesLeft = bytesToWrite; bytesLeft > 0;)
+                {
+                    const util::index_t bufferRemaining = bufferIt->capacity() - bufferOffset;
+                    const util::index_t numBytes = std::min(bytesLeft, bufferRemaining);
+
+                    m_termBuffer.putBytes(payloadOffset, bufferIt->buffer() + bufferOffset, numBytes);
+                    payloadOffset += numBytes;
+                    bytesLeft -= numBytes;
+                    bufferOffset += numBytes;
+
+                    if (bufferOffset == bufferIt->capacity())
+                    {
+                        ++bufferIt;
+                        bufferOffset = 0;
+                    }
+                }
+
+                if (remaining <= maxPayloadLength)
+                {
+                    flags |= FrameDescriptor::END_FRAG;
+                }
+
+                FrameDescriptor::frameFlags(m_termBuffer, offset, flags);
+
+                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
+
+                flags = 0;
+                offset += alignedLength;
+                remaining -= bytesToWrite;
+            }
+            while (remaining > 0);
+        }
+
+        return resultingOffset;
+    }
+
+    /**
+     * Append a batch of unfragmented messages, one per buffer, with a single advance of the tail. Frame lengths
+     * are published in reverse order so a subscriber sees either none of the batch or all of it.
+     *
+     * @param termId for the current term.
+     * @param termOffset in the term at which to append.
+     * @param header for writing the default header.
+     * @param startBuffer iterator to the first message in the batch.
+     * @param lastBuffer iterator one past the last message in the batch.
+     * @param batchLength of the batch including headers and alignment padding.
+     * @param reservedValueSupplier for each frame.
+     * @return the resulting offset of the term after the append on success otherwise {@link #TERM_APPENDER_TRIPPED}.
+     */
+    template <class BufferIterator>
+    std::int32_t appendUnfragmentedBatch(
+        std::int32_t termId,
+        std::int32_t termOffset,
+        const HeaderWriter& header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        std::int32_t resultingOffset = termOffset + batchLength;
+        putRawTailOrdered(termId, resultingOffset);
+
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termId, termOffset, header, termLength);
+        }
+        else
+        {
+            std::int32_t offset = termOffset;
+
+            for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+            {
+                const util::index_t length = it->capacity();
+                const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+
+                header.write(m_termBuffer, offset, frameLength, termId);
+                m_termBuffer.putBytes(offset + DataFrameHeader::LENGTH, it->buffer(), length);
+
+                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                offset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+
+            while (startBuffer != lastBuffer)
+            {
+                --lastBuffer;
+
+                const util::index_t frameLength = lastBuffer->capacity() + DataFrameHeader::LENGTH;
+                offset -= util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
+            }
+        }
+
+        return resultingOffset;
+    }
+
 private:
     AtomicBuffer& m_termBuffer;
     std::int64_t *const m_tailAddr;
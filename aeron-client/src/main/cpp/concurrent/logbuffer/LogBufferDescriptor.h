@@ -31,6 +31,8 @@ namespace LogBufferDescriptor {
 
 static const util::index_t TERM_MIN_LENGTH = 64 * 1024;
 static const std::int64_t MAX_SINGLE_MAPPING_SIZE = 0x7FFFFFFF;
+static const std::int64_t PAGE_MIN_SIZE = 4 * 1024;
+static const std::int64_t PAGE_MAX_SIZE = 1024 * 1024 * 1024;
 
 #if defined(__GNUC__) || _MSC_VER >= 1900
 constexpr static const int PARTITION_COUNT = 3;
@@ -53,9 +55,14 @@ static const int PARTITION_COUNT = 3;
  *  +----------------------------+
  *  |           Term 2           |
  *  +----------------------------+
+ *  |  Padding to the Page Size  |
+ *  +----------------------------+
  *  |        Log Meta Data       |
  *  +----------------------------+
  * </pre>
+ *
+ * The log is only padded so its length is a multiple of the page size when the page size is larger than
+ * PAGE_MIN_SIZE, i.e. when the log is to be backed by huge pages.
  */
 
 static const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
@@ -97,6 +104,10 @@ static const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
  *  +---------------------------------------------------------------+
  *  |                          MTU Length                           |
  *  +---------------------------------------------------------------+
+ *  |                          Term Length                          |
+ *  +---------------------------------------------------------------+
+ *  |                           Page Size                           |
+ *  +---------------------------------------------------------------+
  *  |                      Cache Line Padding                      ...
  * ...                                                              |
  *  +---------------------------------------------------------------+
@@ -122,7 +133,9 @@ struct LogMetaDataDefn
     std::int32_t initialTermId;
     std::int32_t defaultFrameHeaderLength;
     std::int32_t mtuLength;
-    std::int8_t pad3[(util::BitUtil::CACHE_LINE_LENGTH) - (5 * sizeof(std::int32_t))];
+    std::int32_t termLength;
+    std::int32_t pageSize;
+    std::int8_t pad3[(util::BitUtil::CACHE_LINE_LENGTH) - (7 * sizeof(std::int32_t))];
 };
 #pragma pack(pop)
 
@@ -134,6 +147,8 @@ static const util::index_t LOG_END_OF_STREAM_POSITION_OFFSET = (util::index_t)of
 static const util::index_t LOG_INITIAL_TERM_ID_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, initialTermId);
 static const util::index_t LOG_DEFAULT_FRAME_HEADER_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, defaultFrameHeaderLength);
 static const util::index_t LOG_MTU_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, mtuLength);
+static const util::index_t LOG_TERM_LENGTH_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, termLength);
+static const util::index_t LOG_PAGE_SIZE_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, pageSize);
 static const util::index_t LOG_DEFAULT_FRAME_HEADER_OFFSET = (util::index_t)sizeof(LogMetaDataDefn);
 static const util::index_t LOG_META_DATA_LENGTH = (util::index_t)sizeof(LogMetaDataDefn) + LOG_DEFAULT_FRAME_HEADER_MAX_LENGTH;
 
@@ -154,6 +169,49 @@ inline static void checkTermLength(std::int64_t termLength)
     }
 }
 
+inline static void checkPageSize(std::int64_t pageSize)
+{
+    if (pageSize < PAGE_MIN_SIZE)
+    {
+        throw util::IllegalStateException(
+            util::strPrintf("Page size less than min size of %d, size=%d",
+                PAGE_MIN_SIZE, pageSize), SOURCEINFO);
+    }
+
+    if (pageSize > PAGE_MAX_SIZE)
+    {
+        throw util::IllegalStateException(
+            util::strPrintf("Page size greater than max size of %d, size=%d",
+                PAGE_MAX_SIZE, pageSize), SOURCEINFO);
+    }
+
+    if (!util::BitUtil::isPowerOfTwo(pageSize))
+    {
+        throw util::IllegalStateException(
+            util::strPrintf("Page size not a power of 2, size=%d", pageSize), SOURCEINFO);
+    }
+}
+
+/**
+ * Check the term length of a log laid out for the given page size. Terms mapped individually must start on a page
+ * boundary so a term length larger than the page size must also be a multiple of it.
+ *
+ * @param termLength of the log.
+ * @param pageSize the log is laid out for.
+ */
+inline static void checkTermLength(std::int64_t termLength, std::int64_t pageSize)
+{
+    checkTermLength(termLength);
+    checkPageSize(pageSize);
+
+    if (termLength > pageSize && (termLength & (pageSize - 1)) != 0)
+    {
+        throw util::IllegalStateException(
+            util::strPrintf("Term length not a multiple of page size %d, length=%d",
+                pageSize, termLength), SOURCEINFO);
+    }
+}
+
 inline static std::int32_t initialTermId(AtomicBuffer& logMetaDataBuffer)
 {
     return logMetaDataBuffer.getInt32(LOG_INITIAL_TERM_ID_OFFSET);
@@ -164,6 +222,32 @@ inline static std::int32_t mtuLength(AtomicBuffer& logMetaDataBuffer)
     return logMetaDataBuffer.getInt32(LOG_MTU_LENGTH_OFFSET);
 }
 
+/**
+ * Term length recorded in the log meta data, or 0 if the driver that created the log did not record it.
+ */
+inline static std::int32_t termLength(AtomicBuffer& logMetaDataBuffer)
+{
+    return logMetaDataBuffer.getInt32(LOG_TERM_LENGTH_OFFSET);
+}
+
+inline static void termLength(AtomicBuffer& logMetaDataBuffer, std::int32_t termLength)
+{
+    logMetaDataBuffer.putInt32(LOG_TERM_LENGTH_OFFSET, termLength);
+}
+
+/**
+ * Page size the log is laid out for, or 0 if the driver that created the log did not record it.
+ */
+inline static std::int32_t pageSize(AtomicBuffer& logMetaDataBuffer)
+{
+    return logMetaDataBuffer.getInt32(LOG_PAGE_SIZE_OFFSET);
+}
+
+inline static void pageSize(AtomicBuffer& logMetaDataBuffer, std::int32_t pageSize)
+{
+    logMetaDataBuffer.putInt32(LOG_PAGE_SIZE_OFFSET, pageSize);
+}
+
 inline static std::int32_t activePartitionIndex(AtomicBuffer& logMetaDataBuffer)
 {
     return logMetaDataBuffer.getInt32Volatile(LOG_ACTIVE_PARTITION_INDEX_OFFSET);
@@ -235,6 +319,13 @@ inline static std::int64_t computeLogLength(std::int64_t termLength)
     return (termLength * PARTITION_COUNT) + LOG_META_DATA_LENGTH;
 }
 
+inline static std::int64_t computeLogLength(std::int64_t termLength, std::int64_t pageSize)
+{
+    const std::int64_t logLength = computeLogLength(termLength);
+
+    return pageSize > PAGE_MIN_SIZE ? util::BitUtil::align(logLength, pageSize) : logLength;
+}
+
 inline static std::int64_t computeTermLength(std::int64_t logLength)
 {
     return (logLength - LOG_META_DATA_LENGTH) / PARTITION_COUNT;
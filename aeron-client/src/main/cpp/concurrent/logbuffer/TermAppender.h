@@ -202,6 +202,128 @@ public:
         }
     }
 
+    template <class BufferIterator>
+    inline void appendUnfragmentedMessage(
+        Result& result,
+        const HeaderWriter& header,
+        BufferIterator bufferIt,
+        util::index_t length,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const util::index_t frameLength = length + DataFrameHeader::LENGTH;
+        const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        const std::int64_t rawTail = getAndAddRawTail(alignedLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        result.termId = LogBufferDescriptor::termId(rawTail);
+        result.termOffset = termOffset + alignedLength;
+        if (result.termOffset > termLength)
+        {
+            handleEndOfLogCondition(result, m_termBuffer, static_cast<std::int32_t>(termOffset), header, termLength);
+        }
+        else
+        {
+            std::int32_t offset = static_cast<std::int32_t>(termOffset);
+            header.write(m_termBuffer, offset, frameLength, LogBufferDescriptor::termId(rawTail));
+
+            util::index_t payloadOffset = offset + DataFrameHeader::LENGTH;
+            for (util::index_t remaining = length; remaining > 0; ++bufferIt)
+            {
+                const util::index_t numBytes = std::min(remaining, bufferIt->capacity());
+
+                m_termBuffer.putBytes(payloadOffset, bufferIt->buffer(), numBytes);
+                payloadOffset += numBytes;
+                remaining -= numBytes;
+            }
+
+            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+            m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
+        }
+    }
+
+    template <class BufferIterator>
+    void appendFragmentedMessage(
+        Result& result,
+        const HeaderWriter& header,
+        BufferIterator bufferIt,
+        util::index_t length,
+        util::index_t maxPayloadLength,
+        const on_reserved_value_supplier_t& reservedValueSupplier)
+    {
+        const int numMaxPayloads = length / maxPayloadLength;
+        const util::index_t remainingPayload = length % maxPayloadLength;
+        const util::index_t lastFrameLength = (remainingPayload > 0) ?
+            util::BitUtil::align(remainingPayload + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT) : 0;
+        const util::index_t requiredLength =
+            (numMaxPayloads * (maxPayloadLength + DataFrameHeader::LENGTH)) + lastFrameLength;
+        const std::int64_t rawTail = getAndAddRawTail(requiredLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        result.termId = LogBufferDescriptor::termId(rawTail);
+        result.termOffset = termOffset + requiredLength;
+        if (result.termOffset > termLength)
+        {
+            handleEndOfLogCondition(result, m_termBuffer, static_cast<std::int32_t>(termOffset), header, termLength);
+        }
+        else
+        {
+            std::uint8_t flags = FrameDescriptor::BEGIN_FRAG;
+            util::index_t remaining = length;
+            std::int32_t offset = static_cast<std::int32_t>(termOffset);
+            util::index_t bufferOffset = 0;
+
+            do
+            {
+                const util::index_t bytesToWrite = std::min(remaining, maxPayloadLength);
+                const util::index_t frameLength = bytesToWrite + DataFrameHeader::LENGTH;
+                const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+                header.write(m_termBuffer, offset, frameLength, result.termId);
+
+                util::index_t payloadOffset = offset + DataFrameHeader::LENGTH;
+                for (util::index_t bytesLeft = bytesToWrite; bytesLeft > 0;)
+                {
+                    const util::index_t bufferRemaining = bufferIt->capacity() - bufferOffset;
+                    const util::index_t numBytes = std::min(bytesLeft, bufferRemaining);
+
+                    m_termBuffer.putBytes(payloadOffset, bufferIt->buffer() + bufferOffset, numBytes);
+                    payloadOffset += numBytes;
+                    bytesLeft -= numBytes;
+                    bufferOffset += numBytes;
+
+                    if (bufferOffset == bufferIt->capacity())
+                    {
+                        ++bufferIt;
+                        bufferOffset = 0;
+                    }
+                }
+
+                if (remaining <= maxPayloadLength)
+                {
+                    flags |= FrameDescriptor::END_FRAG;
+                }
+
+                FrameDescriptor::frameFlags(m_termBuffer, offset, flags);
+
+                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+                FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
+
+                flags = 0;
+                offset += alignedLength;
+                remaining -= bytesToWrite;
+            }
+            while (remaining > 0);
+        }
+    }
+
 private:
     AtomicBuffer& m_termBuffer;
     AtomicBuffer& m_tailBuffer;
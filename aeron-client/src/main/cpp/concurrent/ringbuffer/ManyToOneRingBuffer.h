@@ -79,6 +79,48 @@ public:
         return isSuccessful;
     }
 
+    /**
+     * Write a batch of messages which have already been framed back to back in the source buffer, each with a
+     * {@link RecordDescriptor} header and padded to {@link RecordDescriptor#ALIGNMENT}, so that capacity is claimed
+     * once for the whole batch.
+     *
+     * @param srcBuffer holding the framed records.
+     * @param srcIndex  at which the first record begins.
+     * @param length    of all the records including their headers and alignment.
+     * @return true if the batch was written otherwise false if there is insufficient capacity.
+     */
+    bool writeBatch(concurrent::AtomicBuffer& srcBuffer, util::index_t srcIndex, util::index_t length)
+    {
+        checkMsgLength(length);
+
+        const util::index_t batchIndex = claimCapacity(length);
+
+        if (INSUFFICIENT_CAPACITY == batchIndex)
+        {
+            return false;
+        }
+
+        for (util::index_t offset = 0; offset < length;)
+        {
+            const std::int64_t header = srcBuffer.getInt64(srcIndex + offset);
+            const std::int32_t recordLength = RecordDescriptor::recordLength(header);
+            const std::int32_t msgTypeId = RecordDescriptor::messageTypeId(header);
+            const util::index_t recordIndex = batchIndex + offset;
+
+            m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
+            m_buffer.putBytes(
+                RecordDescriptor::encodedMsgOffset(recordIndex),
+                srcBuffer,
+                RecordDescriptor::encodedMsgOffset(srcIndex + offset),
+                recordLength - RecordDescriptor::HEADER_LENGTH);
+            m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), recordLength);
+
+            offset += util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+        }
+
+        return true;
+    }
+
     int read(const handler_t& handler, int messageCountLimit)
     {
         const std::int64_t head = m_buffer.getInt64(m_headPositionIndex);
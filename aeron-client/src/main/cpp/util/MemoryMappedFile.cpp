@@ -231,6 +231,10 @@ uint8_t* MemoryMappedFile::doMapping(size_t size, FileHandle fd, size_t offset)
     return static_cast<uint8_t*>(memory);
 }
 
+void MemoryMappedFile::adviseHugePages()
+{
+}
+
 size_t MemoryMappedFile::getPageSize()
 {
     SYSTEM_INFO sinfo;
@@ -285,6 +289,16 @@ uint8_t* MemoryMappedFile::doMapping(size_t length, FileHandle fd, size_t offset
     return static_cast<uint8_t*>(memory);
 }
 
+void MemoryMappedFile::adviseHugePages()
+{
+#if defined(MADV_HUGEPAGE)
+    if (m_memory && m_memorySize)
+    {
+        ::madvise(m_memory, m_memorySize, MADV_HUGEPAGE);
+    }
+#endif
+}
+
 size_t MemoryMappedFile::getPageSize()
 {
     return static_cast<size_t>(::getpagesize());
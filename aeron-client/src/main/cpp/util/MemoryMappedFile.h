@@ -25,6 +25,8 @@
 #endif // !NOMINMAX
 
 #include <windows.h>
+#else
+#include <sys/types.h>
 #endif
 
 
@@ -50,6 +52,12 @@ public:
     uint8_t* getMemoryPtr() const;
     size_t getMemorySize() const;
 
+    /**
+     * Advise that the mapping be backed by transparent huge pages. This is a hint only, and has no effect on
+     * platforms or file systems that do not support it.
+     */
+    void adviseHugePages();
+
     MemoryMappedFile(MemoryMappedFile const&) = delete;
     MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
 
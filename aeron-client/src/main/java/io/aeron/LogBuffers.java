@@ -15,6 +15,7 @@
  */
 package io.aeron;
 
+import io.aeron.logbuffer.LogBufferDescriptor;
 import org.agrona.CloseHelper;
 import org.agrona.IoUtil;
 import org.agrona.concurrent.UnsafeBuffer;
@@ -48,16 +49,18 @@ public class LogBuffers implements AutoCloseable
             fileChannel = FileChannel.open(Paths.get(logFileName), READ, WRITE);
 
             final long logLength = fileChannel.size();
-            final int termLength = computeTermLength(logLength);
-
-            checkTermLength(termLength);
-            this.termLength = termLength;
 
             if (logLength < Integer.MAX_VALUE)
             {
                 final MappedByteBuffer mappedBuffer = fileChannel.map(mapMode, 0, logLength);
                 mappedByteBuffers = new MappedByteBuffer[]{ mappedBuffer };
 
+                logMetaDataBuffer = new UnsafeBuffer(
+                    mappedBuffer, (int)(logLength - LOG_META_DATA_LENGTH), LOG_META_DATA_LENGTH);
+
+                termLength = logTermLength(logMetaDataBuffer, logLength);
+                checkTermLength(termLength, logPageSize(logMetaDataBuffer));
+
                 for (int i = 0; i < PARTITION_COUNT; i++)
                 {
                     final int offset = i * termLength;
@@ -65,24 +68,24 @@ public class LogBuffers implements AutoCloseable
 
                     termBuffers[i] = new UnsafeBuffer(mappedBuffer.slice());
                 }
-
-                logMetaDataBuffer = new UnsafeBuffer(
-                    mappedBuffer, (int)(logLength - LOG_META_DATA_LENGTH), LOG_META_DATA_LENGTH);
             }
             else
             {
                 mappedByteBuffers = new MappedByteBuffer[PARTITION_COUNT + 1];
 
+                final MappedByteBuffer metaDataMappedBuffer = fileChannel.map(
+                    mapMode, logLength - LOG_META_DATA_LENGTH, LOG_META_DATA_LENGTH);
+                mappedByteBuffers[mappedByteBuffers.length - 1] = metaDataMappedBuffer;
+                logMetaDataBuffer = new UnsafeBuffer(metaDataMappedBuffer);
+
+                termLength = logTermLength(logMetaDataBuffer, logLength);
+                checkTermLength(termLength, logPageSize(logMetaDataBuffer));
+
                 for (int i = 0; i < PARTITION_COUNT; i++)
                 {
                     mappedByteBuffers[i] = fileChannel.map(mapMode, termLength * (long)i, termLength);
                     termBuffers[i] = new UnsafeBuffer(mappedByteBuffers[i]);
                 }
-
-                final MappedByteBuffer metaDataMappedBuffer = fileChannel.map(
-                    mapMode, logLength - LOG_META_DATA_LENGTH, LOG_META_DATA_LENGTH);
-                mappedByteBuffers[mappedByteBuffers.length - 1] = metaDataMappedBuffer;
-                logMetaDataBuffer = new UnsafeBuffer(metaDataMappedBuffer);
             }
         }
         catch (final IOException ex)
@@ -127,4 +130,22 @@ public class LogBuffers implements AutoCloseable
     {
         return termLength;
     }
+
+    /*
+     * Logs from drivers that do not record the term length and page size in the meta data are never padded so the
+     * term length can be derived from the log length.
+     */
+    private static int logTermLength(final UnsafeBuffer logMetaDataBuffer, final long logLength)
+    {
+        final int termLength = LogBufferDescriptor.termLength(logMetaDataBuffer);
+
+        return 0 != termLength ? termLength : computeTermLength(logLength);
+    }
+
+    private static int logPageSize(final UnsafeBuffer logMetaDataBuffer)
+    {
+        final int pageSize = LogBufferDescriptor.pageSize(logMetaDataBuffer);
+
+        return 0 != pageSize ? pageSize : PAGE_MIN_SIZE;
+    }
 }
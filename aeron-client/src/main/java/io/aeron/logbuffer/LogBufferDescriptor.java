@@ -33,9 +33,14 @@ import static org.agrona.BitUtil.*;
  *  +----------------------------+
  *  |           Term 2           |
  *  +----------------------------+
+ *  |  Padding to the Page Size  |
+ *  +----------------------------+
  *  |        Log Meta Data       |
  *  +----------------------------+
  * </pre>
+ *
+ * The log is only padded so its length is a multiple of the page size when the page size is larger than
+ * {@link #PAGE_MIN_SIZE}, i.e. when the log is to be backed by huge pages.
  */
 public class LogBufferDescriptor
 {
@@ -59,6 +64,16 @@ public class LogBufferDescriptor
      */
     public static final int TERM_MAX_LENGTH = 1024 * 1024 * 1024;
 
+    /**
+     * Minimum page size a log can be laid out for. Logs are only padded to a multiple of the page size above this.
+     */
+    public static final int PAGE_MIN_SIZE = 4 * 1024;
+
+    /**
+     * Maximum page size a log can be laid out for.
+     */
+    public static final int PAGE_MAX_SIZE = 1024 * 1024 * 1024;
+
     // *******************************
     // *** Log Meta Data Constants ***
     // *******************************
@@ -98,6 +113,16 @@ public class LogBufferDescriptor
      */
     public static final int LOG_MTU_LENGTH_OFFSET;
 
+    /**
+     * Offset within the log meta data which the term length is stored, 0 if the driver did not record it.
+     */
+    public static final int LOG_TERM_LENGTH_OFFSET;
+
+    /**
+     * Offset within the log meta data which the page size is stored, 0 if the driver did not record it.
+     */
+    public static final int LOG_PAGE_SIZE_OFFSET;
+
     /**
      * Offset within the log meta data which the
      */
@@ -130,6 +155,8 @@ public class LogBufferDescriptor
         LOG_INITIAL_TERM_ID_OFFSET = LOG_CORRELATION_ID_OFFSET + SIZE_OF_LONG;
         LOG_DEFAULT_FRAME_HEADER_LENGTH_OFFSET = LOG_INITIAL_TERM_ID_OFFSET + SIZE_OF_INT;
         LOG_MTU_LENGTH_OFFSET = LOG_DEFAULT_FRAME_HEADER_LENGTH_OFFSET + SIZE_OF_INT;
+        LOG_TERM_LENGTH_OFFSET = LOG_MTU_LENGTH_OFFSET + SIZE_OF_INT;
+        LOG_PAGE_SIZE_OFFSET = LOG_TERM_LENGTH_OFFSET + SIZE_OF_INT;
 
         offset += CACHE_LINE_LENGTH;
         LOG_DEFAULT_FRAME_HEADER_OFFSET = offset;
@@ -175,6 +202,10 @@ public class LogBufferDescriptor
      *  +---------------------------------------------------------------+
      *  |                          MTU Length                           |
      *  +---------------------------------------------------------------+
+     *  |                          Term Length                          |
+     *  +---------------------------------------------------------------+
+     *  |                           Page Size                           |
+     *  +---------------------------------------------------------------+
      *  |                      Cache Line Padding                      ...
      * ...                                                              |
      *  +---------------------------------------------------------------+
@@ -211,6 +242,52 @@ public class LogBufferDescriptor
         }
     }
 
+    /**
+     * Check that page size is valid and alignment is valid.
+     *
+     * @param pageSize to be checked.
+     * @throws IllegalStateException if the size is not as expected.
+     */
+    public static void checkPageSize(final int pageSize)
+    {
+        if (pageSize < PAGE_MIN_SIZE)
+        {
+            throw new IllegalStateException(
+                "Page size less than min size of " + PAGE_MIN_SIZE + ": size=" + pageSize);
+        }
+
+        if (pageSize > PAGE_MAX_SIZE)
+        {
+            throw new IllegalStateException(
+                "Page size more than max size of " + PAGE_MAX_SIZE + ": size=" + pageSize);
+        }
+
+        if (!BitUtil.isPowerOfTwo(pageSize))
+        {
+            throw new IllegalStateException("Page size not a power of 2: size=" + pageSize);
+        }
+    }
+
+    /**
+     * Check the term length of a log laid out for the given page size. Terms mapped individually must start on a
+     * page boundary so a term length larger than the page size must also be a multiple of it.
+     *
+     * @param termLength to be checked.
+     * @param pageSize   the log is laid out for.
+     * @throws IllegalStateException if the length or size is not as expected.
+     */
+    public static void checkTermLength(final int termLength, final int pageSize)
+    {
+        checkTermLength(termLength);
+        checkPageSize(pageSize);
+
+        if (termLength > pageSize && (termLength & (pageSize - 1)) != 0)
+        {
+            throw new IllegalStateException(
+                "Term length not a multiple of page size " + pageSize + ": length=" + termLength);
+        }
+    }
+
     /**
      * Get the value of the initial Term id used for this log.
      *
@@ -256,6 +333,50 @@ public class LogBufferDescriptor
         logMetaDataBuffer.putInt(LOG_MTU_LENGTH_OFFSET, mtuLength);
     }
 
+    /**
+     * Get the term length recorded for this log.
+     *
+     * @param logMetaDataBuffer containing the meta data.
+     * @return the term length recorded for this log, or 0 if the driver that created it did not record it.
+     */
+    public static int termLength(final UnsafeBuffer logMetaDataBuffer)
+    {
+        return logMetaDataBuffer.getInt(LOG_TERM_LENGTH_OFFSET);
+    }
+
+    /**
+     * Set the term length recorded for this log.
+     *
+     * @param logMetaDataBuffer containing the meta data.
+     * @param termLength        value to be set.
+     */
+    public static void termLength(final UnsafeBuffer logMetaDataBuffer, final int termLength)
+    {
+        logMetaDataBuffer.putInt(LOG_TERM_LENGTH_OFFSET, termLength);
+    }
+
+    /**
+     * Get the page size this log is laid out for.
+     *
+     * @param logMetaDataBuffer containing the meta data.
+     * @return the page size this log is laid out for, or 0 if the driver that created it did not record it.
+     */
+    public static int pageSize(final UnsafeBuffer logMetaDataBuffer)
+    {
+        return logMetaDataBuffer.getInt(LOG_PAGE_SIZE_OFFSET);
+    }
+
+    /**
+     * Set the page size this log is laid out for.
+     *
+     * @param logMetaDataBuffer containing the meta data.
+     * @param pageSize          value to be set.
+     */
+    public static void pageSize(final UnsafeBuffer logMetaDataBuffer, final int pageSize)
+    {
+        logMetaDataBuffer.putInt(LOG_PAGE_SIZE_OFFSET, pageSize);
+    }
+
     /**
      * Get the value of the correlation ID for this log relating to the command which created it.
      *
@@ -475,7 +596,22 @@ public class LogBufferDescriptor
     }
 
     /**
-     * Compute the term length based on the total length of the log.
+     * Compute the total length of a log file given the term length and the page size it is laid out for. The log is
+     * only padded to a multiple of the page size when the page size is larger than {@link #PAGE_MIN_SIZE}.
+     *
+     * @param termLength on which to base the calculation.
+     * @param pageSize   the log is laid out for.
+     * @return the total length of the log file.
+     */
+    public static long computeLogLength(final int termLength, final int pageSize)
+    {
+        final long logLength = computeLogLength(termLength);
+
+        return pageSize > PAGE_MIN_SIZE ? (logLength + (pageSize - 1)) & ~(long)(pageSize - 1) : logLength;
+    }
+
+    /**
+     * Compute the term length based on the total length of the log. Only valid for logs that are not padded.
      *
      * @param logLength the total length of the log.
      * @return length of an individual term buffer in the log.
@@ -86,7 +86,8 @@ public:
             DRIVER_TIMEOUT_MS,
             RESOURCE_LINGER_TIMEOUT_MS,
             INTER_SERVICE_TIMEOUT_NS,
-            PUBLICATION_CONNECTION_TIMEOUT_MS),
+            PUBLICATION_CONNECTION_TIMEOUT_MS,
+            false),
         m_errorHandler(defaultErrorHandler),
         m_onAvailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewImage, &m_handlers, _1)),
         m_onUnavailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onInactive, &m_handlers, _1))
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -151,6 +154,38 @@ TEST_F(ClientConductorTest, shouldReturnSameIdForDuplicateAddPublication)
     EXPECT_EQ(id1, id2);
 }
 
+TEST_F(ClientConductorTest, shouldReturnSameIdForConcurrentDuplicateAddPublication)
+{
+    const int numThreads = 4;
+    std::vector<std::int64_t> ids(numThreads, -1);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                ids[i] = m_conductor.addPublication(CHANNEL, STREAM_ID);
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 1; i < numThreads; i++)
+    {
+        EXPECT_EQ(ids[0], ids[i]);
+    }
+
+    m_conductor.onNewPublication(STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, m_logFileName, ids[0], ids[0]);
+
+    std::shared_ptr<Publication> pub = m_conductor.findPublication(ids[0]);
+
+    ASSERT_TRUE(pub != nullptr);
+}
+
 TEST_F(ClientConductorTest, shouldReturnSamePublicationAfterLogBuffersCreated)
 {
     std::int64_t id = m_conductor.addPublication(CHANNEL, STREAM_ID);
@@ -424,6 +459,38 @@ TEST_F(ClientConductorTest, shouldReleaseSubscriptionAfterGoingOutOfScope)
     ASSERT_TRUE(subPost == nullptr);
 }
 
+TEST_F(ClientConductorTest, shouldFindSubscriptionsAddedConcurrently)
+{
+    const int numThreads = 4;
+    std::vector<std::int64_t> ids(numThreads, -1);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                ids[i] = m_conductor.addSubscription(
+                    CHANNEL, STREAM_ID + i, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        m_conductor.onOperationSuccess(ids[i]);
+
+        std::shared_ptr<Subscription> sub = m_conductor.findSubscription(ids[i]);
+
+        ASSERT_TRUE(sub != nullptr);
+        EXPECT_EQ(sub->streamId(), STREAM_ID + i);
+    }
+}
+
 TEST_F(ClientConductorTest, shouldReturnDifferentIdsForDuplicateAddSubscription)
 {
     std::int64_t id1 = m_conductor.addSubscription(CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
@@ -859,3 +926,173 @@ TEST_F(ClientConductorTest, shouldRemoveImageOnInterServiceTimeout)
     EXPECT_TRUE(sub->isClosed());
     EXPECT_TRUE(image == nullptr);
 }
+
+TEST_F(ClientConductorTest, shouldNotifyAsBatchedPublicationsAreAdded)
+{
+    static std::int32_t ADD_PUBLICATION = ControlProtocolEvents::ADD_PUBLICATION;
+    const std::string channel2 = "aeron:udp?endpoint=localhost:40124";
+    std::vector<std::int64_t> notifiedIds;
+    std::vector<std::shared_ptr<Publication>> publications;
+
+    std::vector<std::int64_t> ids = m_conductor.addPublications(
+        { { CHANNEL, STREAM_ID }, { channel2, STREAM_ID }, { CHANNEL, STREAM_ID } },
+        [&](std::int64_t registrationId, std::shared_ptr<Publication> publication, std::exception_ptr error)
+        {
+            EXPECT_TRUE(error == nullptr);
+            notifiedIds.push_back(registrationId);
+            publications.push_back(publication);
+        });
+
+    ASSERT_EQ(ids.size(), 3u);
+    EXPECT_NE(ids[0], ids[1]);
+    EXPECT_EQ(ids[0], ids[2]);
+
+    int count = m_manyToOneRingBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            const PublicationMessageFlyweight message(buffer, offset);
+
+            EXPECT_EQ(msgTypeId, ADD_PUBLICATION);
+            EXPECT_TRUE(message.correlationId() == ids[0] || message.correlationId() == ids[1]);
+        });
+
+    EXPECT_EQ(count, 2);
+
+    // driver responds to the first before the batch reaches the conductor
+    m_conductor.onNewPublication(STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID, m_logFileName, ids[0], ids[0]);
+    EXPECT_TRUE(notifiedIds.empty());
+
+    m_conductor.doWork();
+    EXPECT_EQ(notifiedIds.size(), 2u);
+
+    m_conductor.onNewPublication(STREAM_ID, SESSION_ID, PUBLICATION_LIMIT_COUNTER_ID_2, m_logFileName2, ids[1], ids[1]);
+    ASSERT_EQ(notifiedIds.size(), 3u);
+    EXPECT_EQ(notifiedIds[2], ids[1]);
+
+    for (const std::shared_ptr<Publication>& publication : publications)
+    {
+        ASSERT_TRUE(publication != nullptr);
+    }
+
+    EXPECT_TRUE(publications[0] == publications[1]);
+    EXPECT_TRUE(m_conductor.findPublication(ids[1]) == publications[2]);
+}
+
+TEST_F(ClientConductorTest, shouldCompleteRestOfBatchWhenHandlerThrows)
+{
+    const std::string channel2 = "aeron:udp?endpoint=localhost:40124";
+    std::vector<std::int64_t> notifiedIds;
+    int errors = 0;
+
+    m_errorHandler = [&](const std::exception& exception) { errors++; };
+
+    std::vector<std::int64_t> ids = m_conductor.addSubscriptions(
+        { { CHANNEL, STREAM_ID }, { channel2, STREAM_ID } },
+        m_onAvailableImageHandler,
+        m_onUnavailableImageHandler,
+        [&](std::int64_t registrationId, std::shared_ptr<Subscription> subscription, std::exception_ptr error)
+        {
+            notifiedIds.push_back(registrationId);
+            throw util::IllegalStateException("handler failed", SOURCEINFO);
+        });
+
+    ASSERT_EQ(ids.size(), 2u);
+
+    m_conductor.onOperationSuccess(ids[0]);
+    m_conductor.onOperationSuccess(ids[1]);
+    m_conductor.doWork();
+
+    EXPECT_EQ(notifiedIds.size(), 2u);
+    EXPECT_EQ(errors, 2);
+}
+
+TEST_F(ClientConductorTest, shouldNotifyErrorForBatchedSubscription)
+{
+    std::vector<std::int64_t> ids;
+    bool called = false;
+
+    ids = m_conductor.addSubscriptions(
+        { { CHANNEL, STREAM_ID } },
+        m_onAvailableImageHandler,
+        m_onUnavailableImageHandler,
+        [&](std::int64_t registrationId, std::shared_ptr<Subscription> subscription, std::exception_ptr error)
+        {
+            EXPECT_EQ(registrationId, ids[0]);
+            EXPECT_TRUE(subscription == nullptr);
+            EXPECT_THROW(std::rethrow_exception(error), util::RegistrationException);
+            called = true;
+        });
+
+    m_conductor.doWork();
+    m_conductor.onErrorResponse(ids[0], ERROR_CODE_INVALID_CHANNEL, "invalid channel");
+
+    EXPECT_TRUE(called);
+}
+
+TEST_F(ClientConductorTest, shouldNotifyTimeoutForBatchedExclusivePublication)
+{
+    std::vector<std::int64_t> ids;
+    bool called = false;
+
+    m_errorHandler = [&](const std::exception& exception) {};
+
+    ids = m_conductor.addExclusivePublications(
+        { { CHANNEL, STREAM_ID } },
+        [&](std::int64_t registrationId, std::shared_ptr<ExclusivePublication> publication, std::exception_ptr error)
+        {
+            EXPECT_EQ(registrationId, ids[0]);
+            EXPECT_TRUE(publication == nullptr);
+            EXPECT_THROW(std::rethrow_exception(error), util::DriverTimeoutException);
+            called = true;
+        });
+
+    doWorkUntilDriverTimeout();
+    m_currentTime += RESOURCE_TIMEOUT_MS;
+    m_conductor.doWork();
+
+    EXPECT_TRUE(called);
+}
+
+TEST_F(ClientConductorTest, shouldRejectAsyncAddWhenCommandQueueIsFullInAgentInvokerMode)
+{
+    ClientConductor conductor(
+        [&]() { return m_currentTime; },
+        m_driverProxy,
+        m_copyBroadcastReceiver,
+        m_counterValuesBuffer,
+        [&](const std::string&, std::int32_t, std::int32_t, std::int64_t) {},
+        [&](const std::string&, std::int32_t, std::int64_t) {},
+        [&](const std::exception& exception) { m_errorHandler(exception); },
+        DRIVER_TIMEOUT_MS,
+        RESOURCE_LINGER_TIMEOUT_MS,
+        INTER_SERVICE_TIMEOUT_NS,
+        PUBLICATION_CONNECTION_TIMEOUT_MS,
+        true);
+    const std::vector<RegistrationRequest> noRequests;
+    int adds = 0;
+    bool rejected = false;
+
+    while (!rejected && adds < COMMAND_QUEUE_CAPACITY)
+    {
+        try
+        {
+            conductor.addSubscriptions(
+                noRequests, m_onAvailableImageHandler, m_onUnavailableImageHandler,
+                [](std::int64_t, std::shared_ptr<Subscription>, std::exception_ptr) {});
+            adds++;
+        }
+        catch (const util::IllegalStateException&)
+        {
+            rejected = true;
+        }
+    }
+
+    EXPECT_TRUE(rejected);
+    EXPECT_GT(adds, 0);
+
+    conductor.doWork();
+
+    EXPECT_NO_THROW(conductor.addSubscriptions(
+        noRequests, m_onAvailableImageHandler, m_onUnavailableImageHandler,
+        [](std::int64_t, std::shared_ptr<Subscription>, std::exception_ptr) {}));
+}
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -161,6 +163,136 @@ TEST_F(ExclusivePublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(ExclusivePublicationTest, shouldOfferAGatheredMessage)
+{
+    createPub();
+    std::array<std::uint8_t, 16> header;
+    header.fill(1);
+    m_src.fill(2);
+
+    AtomicBuffer buffers[] = { AtomicBuffer(header), m_srcBuffer };
+    const util::index_t frameLength = DataFrameHeader::LENGTH + 16 + m_srcBuffer.capacity();
+    const std::int64_t expectedPosition = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_EQ(m_publication->offer(buffers, 2), expectedPosition);
+    EXPECT_EQ(m_publication->position(), expectedPosition);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1)];
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(0)), frameLength);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH), 1u);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + 15), 1u);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + 16), 2u);
+    EXPECT_EQ(termBuffer.getUInt8(frameLength - 1), 2u);
+}
+
+TEST_F(ExclusivePublicationTest, shouldOfferAGatheredMessageAcrossFragments)
+{
+    createPub();
+    std::array<std::uint8_t, 16> header;
+    std::array<std::uint8_t, 4096> payload;
+    header.fill(1);
+    m_src.fill(2);
+    for (std::size_t i = 0; i < payload.size(); i++)
+    {
+        payload[i] = static_cast<std::uint8_t>(i % 251);
+    }
+
+    AtomicBuffer buffers[] = { AtomicBuffer(header), m_srcBuffer, AtomicBuffer(payload) };
+    std::vector<std::uint8_t> expected(header.begin(), header.end());
+    expected.insert(expected.end(), m_src.begin(), m_src.end());
+    expected.insert(expected.end(), payload.begin(), payload.end());
+
+    const util::index_t maxPayloadLength = m_publication->maxPayloadLength();
+    const util::index_t lastPayloadLength = static_cast<util::index_t>(expected.size()) - maxPayloadLength;
+    m_publicationLimit.set(LONG_MAX);
+
+    EXPECT_GT(m_publication->offer(buffers, 3), 0);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1)];
+    const util::index_t secondFrameOffset = maxPayloadLength + DataFrameHeader::LENGTH;
+
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(0)), maxPayloadLength + DataFrameHeader::LENGTH);
+    EXPECT_EQ(termBuffer.getUInt8(FrameDescriptor::flagsOffset(0)), FrameDescriptor::BEGIN_FRAG);
+    EXPECT_EQ(
+        termBuffer.getInt32(FrameDescriptor::lengthOffset(secondFrameOffset)), lastPayloadLength + DataFrameHeader::LENGTH);
+    EXPECT_EQ(termBuffer.getUInt8(FrameDescriptor::flagsOffset(secondFrameOffset)), FrameDescriptor::END_FRAG);
+
+    for (util::index_t i = 0; i < maxPayloadLength; i++)
+    {
+        ASSERT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + i), expected[i]) << "at " << i;
+    }
+
+    for (util::index_t i = 0; i < lastPayloadLength; i++)
+    {
+        ASSERT_EQ(
+            termBuffer.getUInt8(secondFrameOffset + DataFrameHeader::LENGTH + i), expected[maxPayloadLength + i])
+            << "at " << (maxPayloadLength + i);
+    }
+}
+
+TEST_F(ExclusivePublicationTest, shouldOfferABatchOfMessages)
+{
+    createPub();
+    std::array<std::uint8_t, 32> first;
+    std::array<std::uint8_t, 60> second;
+    first.fill(1);
+    second.fill(2);
+
+    AtomicBuffer buffers[] = { AtomicBuffer(first), AtomicBuffer(second) };
+    const util::index_t firstFrameLength = DataFrameHeader::LENGTH + 32;
+    const util::index_t secondFrameLength = DataFrameHeader::LENGTH + 60;
+    const util::index_t secondFrameOffset = util::BitUtil::align(firstFrameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const std::int64_t expectedPosition =
+        secondFrameOffset + util::BitUtil::align(secondFrameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_EQ(m_publication->offerBatch(buffers, 2), expectedPosition);
+    EXPECT_EQ(m_publication->position(), expectedPosition);
+
+    const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
+    AtomicBuffer& termBuffer = m_termBuffers[activeIndex];
+    EXPECT_EQ(m_logMetaDataBuffer.getInt64(termTailCounterOffset(activeIndex)), rawTailValue(TERM_ID_1, expectedPosition));
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(0)), firstFrameLength);
+    EXPECT_EQ(termBuffer.getUInt8(FrameDescriptor::flagsOffset(0)), FrameDescriptor::UNFRAGMENTED);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH), 1u);
+    EXPECT_EQ(termBuffer.getUInt8(firstFrameLength - 1), 1u);
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(secondFrameOffset)), secondFrameLength);
+    EXPECT_EQ(termBuffer.getInt32(secondFrameOffset + DataFrameHeader::TERM_OFFSET_FIELD_OFFSET), secondFrameOffset);
+    EXPECT_EQ(termBuffer.getUInt8(secondFrameOffset + DataFrameHeader::LENGTH), 2u);
+    EXPECT_EQ(termBuffer.getUInt8(secondFrameOffset + secondFrameLength - 1), 2u);
+}
+
+TEST_F(ExclusivePublicationTest, shouldRotateWhenBatchDoesNotFitInTerm)
+{
+    const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
+    const std::int32_t initialOffset = TERM_LENGTH - 64;
+    m_logMetaDataBuffer.putInt64(termTailCounterOffset(activeIndex), rawTailValue(TERM_ID_1, initialOffset));
+    m_publicationLimit.set(LONG_MAX);
+
+    createPub();
+    std::array<std::uint8_t, 32> message;
+    message.fill(1);
+    AtomicBuffer buffers[] = { AtomicBuffer(message), AtomicBuffer(message) };
+
+    EXPECT_EQ(m_publication->offerBatch(buffers, 2), ADMIN_ACTION);
+
+    AtomicBuffer& termBuffer = m_termBuffers[activeIndex];
+    EXPECT_EQ(termBuffer.getUInt16(FrameDescriptor::typeOffset(initialOffset)), DataFrameHeader::HDR_TYPE_PAD);
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(initialOffset)), 64);
+}
+
+TEST_F(ExclusivePublicationTest, shouldThrowWhenBatchedMessageExceedsMaxPayloadLength)
+{
+    createPub();
+    std::vector<std::uint8_t> message(static_cast<std::size_t>(m_publication->maxPayloadLength() + 1));
+    AtomicBuffer buffers[] = { AtomicBuffer(&message[0], message.size()) };
+    m_publicationLimit.set(LONG_MAX);
+
+    EXPECT_THROW(m_publication->offerBatch(buffers, 1), util::IllegalStateException);
+    EXPECT_EQ(m_publication->position(), 0);
+}
+
 TEST_F(ExclusivePublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     createPub();
@@ -17,8 +17,10 @@
 #include <gmock/gmock.h>
 
 #include <array>
+#include <vector>
 #include "FragmentAssembler.h"
 #include "ControlledFragmentAssembler.h"
+#include "ZeroCopyFragmentAssembler.h"
 
 using namespace aeron::util;
 using namespace aeron;
@@ -235,3 +237,194 @@ TEST_F(FragmentAssemblerTest, shouldNotReassembleIfMissingBegin)
     adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
     ASSERT_FALSE(called);
 }
+
+TEST_F(FragmentAssemblerTest, shouldReassembleInPlaceFromThreeFragments)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const FragmentedMessage& message, Header& header)
+    {
+        called = true;
+        EXPECT_FALSE(message.isContiguous());
+        EXPECT_EQ(message.length(), msgLength * 3);
+        EXPECT_EQ(header.termOffset(), MTU_LENGTH * 2);
+
+        util::index_t expectedOffset = DataFrameHeader::LENGTH;
+        message.forEachFragment(
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                EXPECT_EQ(buffer.buffer(), m_buffer.buffer());
+                EXPECT_EQ(offset, expectedOffset);
+                EXPECT_EQ(length, msgLength);
+                expectedOffset += MTU_LENGTH;
+            });
+
+        std::vector<std::uint8_t> payload(static_cast<std::size_t>(message.length()));
+        message.getBytes(&payload[0]);
+        AtomicBuffer payloadBuffer(&payload[0], payload.size());
+        verifyPayload(payloadBuffer, 0, message.length());
+    };
+
+    ZeroCopyFragmentAssembler adapter(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(0, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+
+    m_header.offset(MTU_LENGTH * 2);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH * 2, msgLength, (msgLength * 2) % 256);
+    adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_TRUE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldFallBackToCopyWhenFragmentsAreNotContiguous)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const FragmentedMessage& message, Header& header)
+    {
+        called = true;
+        EXPECT_TRUE(message.isContiguous());
+        EXPECT_EQ(message.length(), msgLength * 2);
+
+        message.forEachFragment(
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                EXPECT_NE(buffer.buffer(), m_buffer.buffer());
+                verifyPayload(buffer, offset, length);
+            });
+    };
+
+    ZeroCopyFragmentAssembler adapter(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+
+    m_header.offset(MTU_LENGTH * 2);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH * 2, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_TRUE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldCopyFragmentsStillAssemblingAtEndOfPollBeforeTermIsCleaned)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const FragmentedMessage& message, Header& header)
+    {
+        called = true;
+        EXPECT_TRUE(message.isContiguous());
+        EXPECT_EQ(message.length(), msgLength * 2);
+
+        message.forEachFragment(
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+            {
+                EXPECT_NE(buffer.buffer(), m_buffer.buffer());
+                verifyPayload(buffer, offset, length);
+            });
+    };
+
+    ZeroCopyFragmentAssembler adapter(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    adapter.onPollComplete();
+    ASSERT_FALSE(called);
+
+    m_buffer.setMemory(0, MTU_LENGTH, 0);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    adapter.onPollComplete();
+    ASSERT_TRUE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldThrowWhenFragmentLeftInPlaceHasBeenCleaned)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    m_buffer.setMemory(0, MTU_LENGTH, 0);
+
+    FragmentedMessage message(m_buffer, 0, MTU_LENGTH * 2, msgLength * 2);
+
+    ASSERT_THROW(
+        message.forEachFragment([](AtomicBuffer& buffer, util::index_t offset, util::index_t length) {}),
+        util::IllegalStateException);
+}
+
+TEST_F(FragmentAssemblerTest, shouldNotReassembleInPlaceIfMissingBegin)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const FragmentedMessage& message, Header& header)
+    {
+        called = true;
+    };
+
+    ZeroCopyFragmentAssembler adapter(handler);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldReassembleWithDeducedHandlerType)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto adapter = makeFragmentAssembler(
+        [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            ++calls;
+            EXPECT_EQ(length, msgLength * 2);
+            EXPECT_EQ(header.flags(), FrameDescriptor::END_FRAG);
+            verifyPayload(buffer, offset, length);
+        });
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 0);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(calls, 1);
+}
+
+TEST_F(FragmentAssemblerTest, shouldRetainFragmentsOnAbortWithDeducedHandlerType)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto adapter = makeControlledFragmentAssembler(
+        [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            EXPECT_EQ(length, msgLength * 2);
+            verifyPayload(buffer, offset, length);
+            return (++calls == 1) ? ControlledPollAction::ABORT : ControlledPollAction::CONTINUE;
+        });
+    auto handler = adapter.handler();
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    EXPECT_EQ(handler(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    EXPECT_EQ(handler(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::ABORT);
+    EXPECT_EQ(handler(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+    EXPECT_EQ(calls, 2);
+}
@@ -447,3 +447,117 @@ TEST_F(ImageTest, shouldPollFragmentsToControlledFragmentHandlerOnContinue)
     EXPECT_EQ(m_subscriberPosition.get(), initialPosition + ALIGNED_FRAME_LENGTH * 2);
     EXPECT_EQ(image.position(), initialPosition + ALIGNED_FRAME_LENGTH * 2);
 }
+
+TEST_F(ImageTest, shouldPollFragmentsUpToLimitPosition)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(2));
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(testing::_, testing::_, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(2);
+
+    const std::int64_t limitPosition = initialPosition + (2 * ALIGNED_FRAME_LENGTH) + 1;
+    const int fragments = image.boundedPoll(m_handler, limitPosition, INT_MAX);
+    EXPECT_EQ(fragments, 2);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+}
+
+TEST_F(ImageTest, shouldPollNoFragmentsWhenAtLimitPositionCounter)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, offsetOfFrame(1), POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    AERON_DECL_ALIGNED(src_buffer_t leaderCounterValues, 16);
+    leaderCounterValues.fill(0);
+    AtomicBuffer leaderCounterValuesBuffer(leaderCounterValues);
+    UnsafeBufferPosition leaderPositionImpl(leaderCounterValuesBuffer, 0);
+    Position<UnsafeBufferPosition> leaderPosition(leaderPositionImpl);
+    leaderPosition.set(initialPosition);
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(testing::_, testing::_, testing::_, testing::_))
+        .Times(0);
+
+    EXPECT_EQ(image.boundedPoll(m_handler, leaderPosition, INT_MAX), 0);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition);
+
+    leaderPosition.set(initialPosition + ALIGNED_FRAME_LENGTH);
+
+    EXPECT_CALL(m_fragmentHandler, onFragment(testing::_, testing::_, testing::_, testing::_))
+        .Times(1);
+
+    EXPECT_EQ(image.boundedPoll(m_handler, leaderPosition, INT_MAX), 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + ALIGNED_FRAME_LENGTH);
+}
+
+TEST_F(ImageTest, shouldControlledPollFragmentsUpToLimitPosition)
+{
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(INITIAL_TERM_ID, 0, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+
+    EXPECT_CALL(m_controlledFragmentHandler, onFragment(testing::_, DataFrameHeader::LENGTH, static_cast<index_t>(DATA.size()), testing::_))
+        .Times(1)
+        .WillOnce(testing::Return(ControlledPollAction::COMMIT));
+
+    const int fragments = image.boundedControlledPoll(m_controlledHandler, initialPosition + ALIGNED_FRAME_LENGTH, INT_MAX);
+    EXPECT_EQ(fragments, 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + ALIGNED_FRAME_LENGTH);
+}
+
+TEST_F(ImageTest, shouldRawPollBlockLocationInLog)
+{
+    const std::int32_t termId = INITIAL_TERM_ID + 1;
+    const std::int32_t initialTermOffset = offsetOfFrame(1);
+    const std::int64_t initialPosition =
+        LogBufferDescriptor::computePosition(termId, initialTermOffset, POSITION_BITS_TO_SHIFT, INITIAL_TERM_ID);
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(termId, offsetOfFrame(1));
+    insertDataFrame(termId, offsetOfFrame(2));
+
+    const int index = LogBufferDescriptor::indexByTerm(INITIAL_TERM_ID, termId);
+    int calls = 0;
+    auto handler =
+        [&](int fileDescriptor, std::int64_t fileOffset, AtomicBuffer& termBuffer, util::index_t termOffset,
+            util::index_t length, std::int32_t sessionId, std::int32_t blockTermId)
+        {
+            EXPECT_EQ(fileDescriptor, -1);
+            EXPECT_EQ(fileOffset, (index * TERM_LENGTH) + initialTermOffset);
+            EXPECT_EQ(termBuffer.buffer(), m_termBuffers[index].buffer());
+            EXPECT_EQ(termOffset, initialTermOffset);
+            EXPECT_EQ(length, 2 * ALIGNED_FRAME_LENGTH);
+            EXPECT_EQ(sessionId, SESSION_ID);
+            EXPECT_EQ(blockTermId, termId);
+            ++calls;
+        };
+
+    EXPECT_EQ(image.rawPoll(handler, INT_MAX), 2 * ALIGNED_FRAME_LENGTH);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+}
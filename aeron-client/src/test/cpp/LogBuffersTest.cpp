@@ -0,0 +1,87 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include <LogBuffers.h>
+#include "util/TestUtils.h"
+
+using namespace aeron;
+using namespace aeron::util;
+using namespace aeron::test;
+
+TEST(logBuffersTest, shouldPadLogToPageSize)
+{
+    const std::int32_t termLength = LogBufferDescriptor::TERM_MIN_LENGTH;
+    const std::int32_t pageSize = 2 * 1024 * 1024;
+    const std::int64_t logLength = LogBufferDescriptor::computeLogLength(termLength, pageSize);
+    std::string name = makeTempFileName();
+
+    ASSERT_EQ(logLength, pageSize);
+
+    {
+        MemoryMappedFile::ptr_t m = MemoryMappedFile::createNew(name.c_str(), 0, static_cast<size_t>(logLength));
+        AtomicBuffer metaDataBuffer(
+            m->getMemoryPtr() + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
+            LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+        LogBufferDescriptor::termLength(metaDataBuffer, termLength);
+        LogBufferDescriptor::pageSize(metaDataBuffer, pageSize);
+    }
+
+    {
+        LogBuffers logBuffers(name.c_str());
+
+        EXPECT_EQ(logBuffers.atomicBuffer(0).capacity(), termLength);
+        EXPECT_EQ(logBuffers.atomicBuffer(2).buffer(), logBuffers.atomicBuffer(0).buffer() + (2 * termLength));
+        EXPECT_EQ(
+            logBuffers.atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX).buffer(),
+            logBuffers.atomicBuffer(0).buffer() + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH));
+    }
+
+    ::unlink(name.c_str());
+}
+
+TEST(logBuffersTest, shouldNotPadLogWithoutPageSize)
+{
+    const std::int32_t termLength = LogBufferDescriptor::TERM_MIN_LENGTH;
+    const std::int64_t logLength = LogBufferDescriptor::computeLogLength(termLength);
+    std::string name = makeTempFileName();
+
+    ASSERT_EQ(LogBufferDescriptor::computeLogLength(termLength, LogBufferDescriptor::PAGE_MIN_SIZE), logLength);
+
+    MemoryMappedFile::createNew(name.c_str(), 0, static_cast<size_t>(logLength));
+
+    {
+        LogBuffers logBuffers(name.c_str());
+
+        EXPECT_EQ(logBuffers.atomicBuffer(0).capacity(), termLength);
+    }
+
+    ::unlink(name.c_str());
+}
+
+TEST(logBuffersTest, shouldRejectInvalidPageSize)
+{
+    ASSERT_NO_THROW(LogBufferDescriptor::checkTermLength(LogBufferDescriptor::TERM_MIN_LENGTH, 2 * 1024 * 1024));
+    ASSERT_THROW(
+        LogBufferDescriptor::checkTermLength(LogBufferDescriptor::TERM_MIN_LENGTH, 3 * 1024 * 1024),
+        IllegalStateException);
+    ASSERT_THROW(
+        LogBufferDescriptor::checkTermLength(LogBufferDescriptor::TERM_MIN_LENGTH, 1024),
+        IllegalStateException);
+}
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "ClientConductorFixture.h"
@@ -151,6 +153,72 @@ TEST_F(PublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(PublicationTest, shouldOfferAGatheredMessage)
+{
+    std::array<std::uint8_t, 16> header;
+    header.fill(1);
+    m_src.fill(2);
+
+    AtomicBuffer buffers[] = { AtomicBuffer(header), m_srcBuffer };
+    const util::index_t frameLength = DataFrameHeader::LENGTH + 16 + m_srcBuffer.capacity();
+    const std::int64_t expectedPosition = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    m_publicationLimit.set(2 * m_srcBuffer.capacity());
+
+    EXPECT_EQ(m_publication->offer(buffers, 2), expectedPosition);
+    EXPECT_EQ(m_publication->position(), expectedPosition);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1)];
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(0)), frameLength);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH), 1u);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + 15), 1u);
+    EXPECT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + 16), 2u);
+    EXPECT_EQ(termBuffer.getUInt8(frameLength - 1), 2u);
+}
+
+TEST_F(PublicationTest, shouldOfferAGatheredMessageAcrossFragments)
+{
+    std::array<std::uint8_t, 16> header;
+    std::array<std::uint8_t, 4096> payload;
+    header.fill(1);
+    m_src.fill(2);
+    for (std::size_t i = 0; i < payload.size(); i++)
+    {
+        payload[i] = static_cast<std::uint8_t>(i % 251);
+    }
+
+    AtomicBuffer buffers[] = { AtomicBuffer(header), m_srcBuffer, AtomicBuffer(payload) };
+    std::vector<std::uint8_t> expected(header.begin(), header.end());
+    expected.insert(expected.end(), m_src.begin(), m_src.end());
+    expected.insert(expected.end(), payload.begin(), payload.end());
+
+    const util::index_t maxPayloadLength = m_publication->maxPayloadLength();
+    const util::index_t lastPayloadLength = static_cast<util::index_t>(expected.size()) - maxPayloadLength;
+    m_publicationLimit.set(LONG_MAX);
+
+    EXPECT_GT(m_publication->offer(buffers, 3), 0);
+
+    AtomicBuffer& termBuffer = m_termBuffers[LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1)];
+    const util::index_t secondFrameOffset = maxPayloadLength + DataFrameHeader::LENGTH;
+
+    EXPECT_EQ(termBuffer.getInt32(FrameDescriptor::lengthOffset(0)), maxPayloadLength + DataFrameHeader::LENGTH);
+    EXPECT_EQ(termBuffer.getUInt8(FrameDescriptor::flagsOffset(0)), FrameDescriptor::BEGIN_FRAG);
+    EXPECT_EQ(
+        termBuffer.getInt32(FrameDescriptor::lengthOffset(secondFrameOffset)), lastPayloadLength + DataFrameHeader::LENGTH);
+    EXPECT_EQ(termBuffer.getUInt8(FrameDescriptor::flagsOffset(secondFrameOffset)), FrameDescriptor::END_FRAG);
+
+    for (util::index_t i = 0; i < maxPayloadLength; i++)
+    {
+        ASSERT_EQ(termBuffer.getUInt8(DataFrameHeader::LENGTH + i), expected[i]) << "at " << i;
+    }
+
+    for (util::index_t i = 0; i < lastPayloadLength; i++)
+    {
+        ASSERT_EQ(
+            termBuffer.getUInt8(secondFrameOffset + DataFrameHeader::LENGTH + i), expected[maxPayloadLength + i])
+            << "at " << (maxPayloadLength + i);
+    }
+}
+
 TEST_F(PublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     m_publicationLimit.set(0);
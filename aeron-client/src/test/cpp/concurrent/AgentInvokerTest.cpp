@@ -0,0 +1,96 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <concurrent/AgentInvoker.h>
+
+using namespace aeron::concurrent;
+using namespace aeron::util;
+
+class CountingAgent
+{
+public:
+    int doWork()
+    {
+        ++m_dutyCycles;
+
+        if (m_throwOnWork)
+        {
+            throw IllegalStateException("work failed", SOURCEINFO);
+        }
+
+        return 1;
+    }
+
+    void onClose()
+    {
+        ++m_closes;
+    }
+
+    int m_dutyCycles = 0;
+    int m_closes = 0;
+    bool m_throwOnWork = false;
+};
+
+class AgentInvokerTest : public testing::Test
+{
+public:
+    AgentInvokerTest() :
+        m_exceptionHandler([&](const std::exception&) { ++m_exceptions; }),
+        m_invoker(m_agent, m_exceptionHandler)
+    {
+    }
+
+protected:
+    CountingAgent m_agent;
+    int m_exceptions = 0;
+    logbuffer::exception_handler_t m_exceptionHandler;
+    AgentInvoker<CountingAgent> m_invoker;
+};
+
+TEST_F(AgentInvokerTest, shouldNotDoWorkUntilStarted)
+{
+    EXPECT_EQ(m_invoker.invoke(), 0);
+    EXPECT_EQ(m_agent.m_dutyCycles, 0);
+
+    m_invoker.start();
+
+    EXPECT_TRUE(m_invoker.isStarted());
+    EXPECT_EQ(m_invoker.invoke(), 1);
+    EXPECT_EQ(m_agent.m_dutyCycles, 1);
+}
+
+TEST_F(AgentInvokerTest, shouldPassExceptionsToHandler)
+{
+    m_agent.m_throwOnWork = true;
+    m_invoker.start();
+
+    EXPECT_EQ(m_invoker.invoke(), 0);
+    EXPECT_EQ(m_exceptions, 1);
+}
+
+TEST_F(AgentInvokerTest, shouldCloseAgentOnceAndStopDoingWork)
+{
+    m_invoker.start();
+    m_invoker.close();
+    m_invoker.close();
+
+    EXPECT_TRUE(m_invoker.isClosed());
+    EXPECT_EQ(m_agent.m_closes, 1);
+    EXPECT_EQ(m_invoker.invoke(), 0);
+    EXPECT_EQ(m_agent.m_dutyCycles, 0);
+}
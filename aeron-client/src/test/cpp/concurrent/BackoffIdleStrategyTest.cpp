@@ -0,0 +1,81 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <concurrent/AdaptiveIdleStrategy.h>
+
+using namespace aeron::concurrent;
+
+static const std::chrono::nanoseconds MIN_PARK_PERIOD(1);
+static const std::chrono::nanoseconds MAX_PARK_PERIOD(4);
+
+template <typename IdleStrategy>
+static void idleTimes(IdleStrategy& idleStrategy, int times)
+{
+    for (int i = 0; i < times; i++)
+    {
+        idleStrategy.idle(0);
+    }
+}
+
+TEST(BackoffIdleStrategyTest, shouldAccumulateTimeInPhasesOnlyWhenIdle)
+{
+    BackoffIdleStrategy idleStrategy(2, 1, MIN_PARK_PERIOD, MAX_PARK_PERIOD);
+
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.spinTimeNs() + idleStrategy.yieldTimeNs() + idleStrategy.parkTimeNs(), 0);
+
+    idleTimes(idleStrategy, 2);
+    EXPECT_EQ(idleStrategy.parkTimeNs(), 0);
+
+    idleTimes(idleStrategy, 3);
+    idleStrategy.idle(1);
+
+    EXPECT_GT(idleStrategy.parkTimeNs(), 0);
+    EXPECT_GE(idleStrategy.spinTimeNs(), 0);
+    EXPECT_GE(idleStrategy.yieldTimeNs(), 0);
+}
+
+TEST(BackoffIdleStrategyTest, shouldIncreaseSpinsWhenWorkArrivesWhileYielding)
+{
+    AdaptiveIdleStrategy idleStrategy(2, 8, 1, MIN_PARK_PERIOD, MAX_PARK_PERIOD);
+
+    idleTimes(idleStrategy, 3);
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.maxSpins(), 4);
+
+    idleTimes(idleStrategy, 5);
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.maxSpins(), 8);
+
+    idleTimes(idleStrategy, 9);
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.maxSpins(), 8);
+}
+
+TEST(BackoffIdleStrategyTest, shouldDecreaseSpinsWhenWorkArrivesWhileParked)
+{
+    AdaptiveIdleStrategy idleStrategy(4, 8, 1, MIN_PARK_PERIOD, MAX_PARK_PERIOD);
+
+    idleTimes(idleStrategy, 6);
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.maxSpins(), 2);
+
+    idleTimes(idleStrategy, 2);
+    idleStrategy.idle(1);
+    EXPECT_EQ(idleStrategy.maxSpins(), 2);
+}
@@ -117,6 +117,43 @@ TEST_F(ManyToOneRingBufferTest, shouldWriteToEmptyBuffer)
     EXPECT_EQ(m_ab.getInt64(TAIL_COUNTER_INDEX), tail + alignedRecordLength);
 }
 
+TEST_F(ManyToOneRingBufferTest, shouldWriteBatchOfRecordsWithOneClaim)
+{
+    util::index_t firstLength = 8;
+    util::index_t secondLength = 20;
+    util::index_t firstAlignedLength =
+        util::BitUtil::align(firstLength + RecordDescriptor::HEADER_LENGTH, RecordDescriptor::ALIGNMENT);
+    util::index_t secondAlignedLength =
+        util::BitUtil::align(secondLength + RecordDescriptor::HEADER_LENGTH, RecordDescriptor::ALIGNMENT);
+
+    m_srcAb.putInt64(0, RecordDescriptor::makeHeader(firstLength + RecordDescriptor::HEADER_LENGTH, MSG_TYPE_ID));
+    m_srcAb.putInt32(RecordDescriptor::encodedMsgOffset(0), 7);
+    m_srcAb.putInt64(
+        firstAlignedLength,
+        RecordDescriptor::makeHeader(secondLength + RecordDescriptor::HEADER_LENGTH, MSG_TYPE_ID + 1));
+    m_srcAb.putInt32(RecordDescriptor::encodedMsgOffset(firstAlignedLength), 11);
+
+    ASSERT_TRUE(m_ringBuffer.writeBatch(m_srcAb, 0, firstAlignedLength + secondAlignedLength));
+
+    EXPECT_EQ(m_ab.getInt64(TAIL_COUNTER_INDEX), firstAlignedLength + secondAlignedLength);
+
+    std::vector<std::int32_t> msgTypeIds;
+    std::vector<std::int32_t> values;
+
+    int messagesRead = m_ringBuffer.read(
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+        {
+            msgTypeIds.push_back(msgTypeId);
+            values.push_back(buffer.getInt32(offset));
+        });
+
+    ASSERT_EQ(messagesRead, 2);
+    EXPECT_EQ(msgTypeIds[0], MSG_TYPE_ID);
+    EXPECT_EQ(msgTypeIds[1], MSG_TYPE_ID + 1);
+    EXPECT_EQ(values[0], 7);
+    EXPECT_EQ(values[1], 11);
+}
+
 TEST_F(ManyToOneRingBufferTest, shouldRejectWriteWhenInsufficientSpace)
 {
     util::index_t length = 100;
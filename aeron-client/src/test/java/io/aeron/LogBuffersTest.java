@@ -0,0 +1,89 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package io.aeron;
+
+import org.agrona.IoUtil;
+import org.agrona.concurrent.UnsafeBuffer;
+import org.junit.After;
+import org.junit.Test;
+
+import java.io.File;
+import java.io.RandomAccessFile;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+
+import static io.aeron.logbuffer.LogBufferDescriptor.*;
+import static org.hamcrest.MatcherAssert.assertThat;
+import static org.hamcrest.Matchers.is;
+
+public class LogBuffersTest
+{
+    private static final int TERM_LENGTH = TERM_MIN_LENGTH;
+    private static final int HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    private final File logFile = new File(IoUtil.tmpDirName(), "log-buffers-test.logbuffer");
+
+    @After
+    public void after()
+    {
+        IoUtil.delete(logFile, true);
+    }
+
+    @Test
+    public void shouldDeriveTermLengthWhenNotRecordedInMetaData() throws Exception
+    {
+        createLog(computeLogLength(TERM_LENGTH), 0, 0);
+
+        try (LogBuffers logBuffers = new LogBuffers(logFile.getAbsolutePath(), FileChannel.MapMode.READ_WRITE))
+        {
+            assertThat(logBuffers.termLength(), is(TERM_LENGTH));
+            assertThat(logBuffers.termBuffers()[PARTITION_COUNT - 1].capacity(), is(TERM_LENGTH));
+        }
+    }
+
+    @Test
+    public void shouldMapLogPaddedToHugePageSize() throws Exception
+    {
+        final long logLength = computeLogLength(TERM_LENGTH, HUGE_PAGE_SIZE);
+        assertThat(logLength, is((long)HUGE_PAGE_SIZE));
+
+        createLog(logLength, TERM_LENGTH, HUGE_PAGE_SIZE);
+
+        try (LogBuffers logBuffers = new LogBuffers(logFile.getAbsolutePath(), FileChannel.MapMode.READ_WRITE))
+        {
+            assertThat(logBuffers.termLength(), is(TERM_LENGTH));
+            assertThat(logBuffers.termBuffers()[PARTITION_COUNT - 1].capacity(), is(TERM_LENGTH));
+            assertThat(pageSize(logBuffers.metaDataBuffer()), is(HUGE_PAGE_SIZE));
+        }
+    }
+
+    private void createLog(final long logLength, final int termLength, final int pageSize) throws Exception
+    {
+        try (RandomAccessFile file = new RandomAccessFile(logFile, "rw"))
+        {
+            file.setLength(logLength);
+
+            final MappedByteBuffer mappedBuffer = file.getChannel().map(
+                FileChannel.MapMode.READ_WRITE, logLength - LOG_META_DATA_LENGTH, LOG_META_DATA_LENGTH);
+            final UnsafeBuffer logMetaDataBuffer = new UnsafeBuffer(mappedBuffer);
+
+            termLength(logMetaDataBuffer, termLength);
+            pageSize(logMetaDataBuffer, pageSize);
+
+            IoUtil.unmap(mappedBuffer);
+        }
+    }
+}
@@ -20,9 +20,11 @@
 #include <stdio.h>
 #include <dlfcn.h>
 #include <sched.h>
+#include <errno.h>
 #include "aeron_agent.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "util/aeron_error.h"
 
 static void aeron_idle_strategy_sleeping_idle(void *state, int work_count)
 {
@@ -78,6 +80,18 @@ aeron_idle_strategy_t aeron_idle_strategy_noop =
         aeron_idle_strategy_init_null
     };
 
+aeron_idle_strategy_t aeron_idle_strategy_backoff =
+    {
+        aeron_idle_strategy_backoff_idle,
+        aeron_idle_strategy_backoff_init
+    };
+
+aeron_idle_strategy_t aeron_idle_strategy_adaptive =
+    {
+        aeron_idle_strategy_adaptive_idle,
+        aeron_idle_strategy_backoff_init
+    };
+
 aeron_idle_strategy_func_t aeron_idle_strategy_load(
     const char *idle_strategy_name,
     void **idle_strategy_state)
@@ -111,11 +125,22 @@ aeron_idle_strategy_func_t aeron_idle_strategy_load(
     {
         aeron_idle_strategy_t *idle_strat = NULL;
 
-        snprintf(idle_func_name, sizeof(idle_func_name) - 1, "%s", idle_strategy_name);
-        if ((idle_strat = (aeron_idle_strategy_t *)dlsym(RTLD_DEFAULT, idle_func_name)) == NULL)
+        if (strncmp(idle_strategy_name, "backoff", sizeof("backoff")) == 0)
         {
-            /* TODO: dlerror and EINVAL */
-            return NULL;
+            idle_strat = &aeron_idle_strategy_backoff;
+        }
+        else if (strncmp(idle_strategy_name, "adaptive", sizeof("adaptive")) == 0)
+        {
+            idle_strat = &aeron_idle_strategy_adaptive;
+        }
+        else
+        {
+            snprintf(idle_func_name, sizeof(idle_func_name) - 1, "%s", idle_strategy_name);
+            if ((idle_strat = (aeron_idle_strategy_t *)dlsym(RTLD_DEFAULT, idle_func_name)) == NULL)
+            {
+                /* TODO: dlerror and EINVAL */
+                return NULL;
+            }
         }
 
         idle_func = idle_strat->idle;
@@ -153,12 +178,35 @@ int aeron_agent_init(
     runner->role_name = strndup(role_name, AERON_MAX_PATH);
     runner->idle_strategy_state = idle_strategy_state;
     runner->idle_strategy = idle_strategy_func;
+    runner->has_cpu_affinity = false;
     atomic_init(&runner->running, true);
     runner->state = AERON_AGENT_STATE_INITED;
 
     return 0;
 }
 
+int aeron_agent_cpu_affinity(aeron_agent_runner_t *runner, const char *cpu_list)
+{
+    if (NULL == cpu_list || '\0' == *cpu_list)
+    {
+        runner->has_cpu_affinity = false;
+        return 0;
+    }
+
+#if defined(__linux__)
+    if (aeron_cpu_set_parse(&runner->cpu_set, cpu_list) < 0)
+    {
+        return -1;
+    }
+
+    runner->has_cpu_affinity = true;
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "CPU affinity not supported for agent %s", runner->role_name);
+    return -1;
+#endif
+}
+
 static void *agent_main(void *arg)
 {
     aeron_agent_runner_t *runner = (aeron_agent_runner_t *)arg;
@@ -188,9 +236,34 @@ int aeron_agent_start(aeron_agent_runner_t *runner)
         return -1;
     }
 
+#if defined(__linux__)
+    if (runner->has_cpu_affinity)
+    {
+        cpu_set_t cpu_set;
+
+        CPU_ZERO(&cpu_set);
+        for (int cpu = 0; cpu < AERON_CPU_SET_MAX_CPUS && cpu < CPU_SETSIZE; cpu++)
+        {
+            if (aeron_cpu_set_is_set(&runner->cpu_set, cpu))
+            {
+                CPU_SET(cpu, &cpu_set);
+            }
+        }
+
+        /* set on the attributes so the agent never runs, or first touches memory, off its CPUs */
+        if ((pthread_result = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set), &cpu_set)) != 0)
+        {
+            aeron_set_err(pthread_result, "CPU affinity for agent %s: %s", runner->role_name, strerror(pthread_result));
+            pthread_attr_destroy(&attr);
+            return -1;
+        }
+    }
+#endif
+
     if ((pthread_result = pthread_create(&runner->thread, &attr, agent_main, runner)) != 0)
     {
-        /* TODO: pthread-result has error */
+        /* an affinity to CPUs that are not online only fails here */
+        aeron_set_err(pthread_result, "start agent %s: %s", runner->role_name, strerror(pthread_result));
         return -1;
     }
 
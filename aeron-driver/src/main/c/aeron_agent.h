@@ -30,6 +30,8 @@ typedef HANDLE aeron_thread_t;
 #endif
 
 #include "aeron_driver_common.h"
+#include "aeron_idle_strategy.h"
+#include "util/aeron_cpu_set.h"
 
 typedef int (*aeron_agent_do_work_func_t)(void *);
 typedef void (*aeron_agent_on_close_func_t)(void *);
@@ -57,6 +59,8 @@ typedef struct aeron_agent_runner_stct
     aeron_agent_on_close_func_t on_close;
     aeron_idle_strategy_func_t idle_strategy;
     aeron_thread_t thread;
+    aeron_cpu_set_t cpu_set;
+    bool has_cpu_affinity;
     atomic_bool running;
     uint8_t state;
 }
@@ -75,6 +79,12 @@ int aeron_agent_init(
     aeron_idle_strategy_func_t idle_strategy_func,
     void *idle_strategy_state);
 
+/*
+ * Pin the agent thread to the CPUs in cpu_list when it is started. A NULL or empty list leaves the thread unpinned.
+ * Has no effect on an agent run from the main loop of the caller.
+ */
+int aeron_agent_cpu_affinity(aeron_agent_runner_t *runner, const char *cpu_list);
+
 int aeron_agent_start(aeron_agent_runner_t *runner);
 
 inline int aeron_agent_do_work(aeron_agent_runner_t *runner)
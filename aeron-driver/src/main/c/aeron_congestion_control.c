@@ -20,12 +20,14 @@
 
 #include <dlfcn.h>
 #include <errno.h>
+#include <math.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_error.h"
 #include "aeron_congestion_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "aeron_position.h"
 
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name)
@@ -44,12 +46,23 @@ aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strat
 typedef struct aeron_static_window_congestion_control_strategy_state_stct
 {
     int32_t window_length;
+    int64_t rtt_measurement_interval_ns;
+    int64_t last_rtt_measurement_timestamp_ns;
 }
 aeron_static_window_congestion_control_strategy_state_t;
 
 bool aeron_static_window_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
 {
-    return false;
+    aeron_static_window_congestion_control_strategy_state_t *static_state =
+        (aeron_static_window_congestion_control_strategy_state_t *)state;
+
+    return static_state->rtt_measurement_interval_ns > 0 &&
+        now_ns > (static_state->last_rtt_measurement_timestamp_ns + static_state->rtt_measurement_interval_ns);
+}
+
+void aeron_static_window_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+    ((aeron_static_window_congestion_control_strategy_state_t *)state)->last_rtt_measurement_timestamp_ns = now_ns;
 }
 
 void aeron_static_window_congestion_control_strategy_on_rttm(
@@ -104,6 +117,7 @@ int aeron_static_window_congestion_control_strategy_supplier(
     }
 
     _strategy->should_measure_rtt = aeron_static_window_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_static_window_congestion_control_strategy_on_rttm_sent;
     _strategy->on_rttm = aeron_static_window_congestion_control_strategy_on_rttm;
     _strategy->on_track_rebuild = aeron_static_window_congestion_control_strategy_on_track_rebuild;
     _strategy->initial_window_length = aeron_static_window_congestion_control_strategy_initial_window_length;
@@ -114,6 +128,273 @@ int aeron_static_window_congestion_control_strategy_supplier(
     const int32_t max_window_for_term = term_length / 2;
 
     state->window_length = max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+    state->rtt_measurement_interval_ns = (int64_t)context->rtt_measurement_interval_ns;
+    state->last_rtt_measurement_timestamp_ns = context->nano_clock();
+
+    *strategy = _strategy;
+    return 0;
+}
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS (10 * 1000 * 1000L)
+#define AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS (1000 * 1000 * 1000L)
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS (AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS)
+#define AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS (1)
+
+#define AERON_CUBICCONGESTIONCONTROL_C (0.4)
+#define AERON_CUBICCONGESTIONCONTROL_B (0.2)
+
+/*
+ * CUBIC congestion window in units of MTU, see RFC 8312. rtt_ns is written by the receiver on RTTM reply and
+ * read by the conductor on track rebuild, all other fields are only touched by a single thread.
+ */
+typedef struct aeron_cubic_congestion_control_strategy_state_stct
+{
+    bool measure_rtt;
+    bool tcp_mode;
+    int32_t mtu;
+    int32_t max_cwnd;
+    int32_t cwnd;
+    int32_t w_max;
+    int32_t outstanding_rtt_measurements;
+    double k;
+    int64_t last_loss_timestamp_ns;
+    int64_t last_update_timestamp_ns;
+    int64_t last_rtt_timestamp_ns;
+    int64_t window_update_timeout_ns;
+    volatile int64_t rtt_ns;
+
+    aeron_counters_manager_t *counters_manager;
+    int32_t rtt_indicator_counter_id;
+    int32_t window_indicator_counter_id;
+    int64_t *rtt_indicator;
+    int64_t *window_indicator;
+}
+aeron_cubic_congestion_control_strategy_state_t;
+
+bool aeron_cubic_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    if (!cubic_state->measure_rtt)
+    {
+        return false;
+    }
+
+    /* a reply may have been lost, so measure again after the max timeout even with measurements outstanding */
+    if ((cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS) - now_ns < 0)
+    {
+        cubic_state->outstanding_rtt_measurements = 0;
+        return true;
+    }
+
+    return cubic_state->outstanding_rtt_measurements < AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS &&
+        (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS) - now_ns < 0;
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm_sent(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->outstanding_rtt_measurements++;
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    if (cubic_state->outstanding_rtt_measurements > 0)
+    {
+        cubic_state->outstanding_rtt_measurements--;
+    }
+
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    AERON_PUT_ORDERED(cubic_state->rtt_ns, rtt_ns);
+    aeron_counter_set_ordered(cubic_state->rtt_indicator, rtt_ns);
+}
+
+int32_t aeron_cubic_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+    bool force_status_message = false;
+
+    if (loss_occurred)
+    {
+        cubic_state->w_max = cubic_state->cwnd;
+        cubic_state->k = cbrt((double)cubic_state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+
+        const int32_t cwnd = (int32_t)(cubic_state->cwnd * (1.0 - AERON_CUBICCONGESTIONCONTROL_B));
+        cubic_state->cwnd = cwnd > 1 ? cwnd : 1;
+        cubic_state->last_loss_timestamp_ns = now_ns;
+        force_status_message = true;
+    }
+    else if (cubic_state->cwnd < cubic_state->max_cwnd &&
+        ((cubic_state->last_update_timestamp_ns + cubic_state->window_update_timeout_ns) - now_ns < 0))
+    {
+        /* W_cubic = C(T - K)^3 + w_max */
+        const double duration_since_decr =
+            (double)(now_ns - cubic_state->last_loss_timestamp_ns) / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+        const double diff_to_k = duration_since_decr - cubic_state->k;
+        const double incr = AERON_CUBICCONGESTIONCONTROL_C * diff_to_k * diff_to_k * diff_to_k;
+        const int32_t cwnd = cubic_state->w_max + (int32_t)incr;
+
+        cubic_state->cwnd = cwnd < cubic_state->max_cwnd ? cwnd : cubic_state->max_cwnd;
+
+        /* if using TCP mode, then check to see if we are in the TCP region */
+        if (cubic_state->tcp_mode && cubic_state->cwnd < cubic_state->w_max)
+        {
+            /* W_tcp(t) = w_max * (1 - B) + 3 * B / (2 - B) * t / RTT */
+            int64_t rtt_ns;
+            AERON_GET_VOLATILE(rtt_ns, cubic_state->rtt_ns);
+
+            const double rtt_in_seconds = (double)rtt_ns / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+            const double w_tcp =
+                (double)cubic_state->w_max * (1.0 - AERON_CUBICCONGESTIONCONTROL_B) +
+                ((3.0 * AERON_CUBICCONGESTIONCONTROL_B / (2.0 - AERON_CUBICCONGESTIONCONTROL_B)) *
+                (duration_since_decr / rtt_in_seconds));
+
+            cubic_state->cwnd = cubic_state->cwnd > (int32_t)w_tcp ? cubic_state->cwnd : (int32_t)w_tcp;
+        }
+
+        cubic_state->last_update_timestamp_ns = now_ns;
+    }
+    else if (1 == cubic_state->cwnd && new_consumption_position > last_sm_position)
+    {
+        /* special case of receiver window being 1 MTU, force SM for catch up */
+        force_status_message = true;
+    }
+
+    const int32_t window = cubic_state->cwnd * cubic_state->mtu;
+    aeron_counter_set_ordered(cubic_state->window_indicator, window);
+
+    *should_force_sm = force_status_message;
+    return window;
+}
+
+int32_t aeron_cubic_congestion_control_strategy_initial_window_length(void *state)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state = (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    return cubic_state->cwnd * cubic_state->mtu;
+}
+
+int aeron_cubic_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state =
+        (aeron_cubic_congestion_control_strategy_state_t *)strategy->state;
+
+    aeron_counters_manager_free(cubic_state->counters_manager, cubic_state->rtt_indicator_counter_id);
+    aeron_counters_manager_free(cubic_state->counters_manager, cubic_state->window_indicator_counter_id);
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+    return 0;
+}
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_strategy->state, sizeof(aeron_cubic_congestion_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_cubic_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm_sent = aeron_cubic_congestion_control_strategy_on_rttm_sent;
+    _strategy->on_rttm = aeron_cubic_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_cubic_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_cubic_congestion_control_strategy_initial_window_length;
+    _strategy->fini = aeron_cubic_congestion_control_strategy_fini;
+
+    aeron_cubic_congestion_control_strategy_state_t *state = _strategy->state;
+    const int32_t initial_window_length = (int32_t)context->initial_window_length;
+    const int32_t max_window_for_term = term_length / 2;
+    const int32_t max_window =
+        max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+
+    state->measure_rtt = context->cubic_congestion_control_measure_rtt;
+    state->tcp_mode = context->cubic_congestion_control_tcp_mode;
+    state->mtu = sender_mtu_length;
+    state->max_cwnd = max_window / sender_mtu_length > 1 ? max_window / sender_mtu_length : 1;
+    state->cwnd = 1;
+    /* initially set w_max to max window and act in the TCP and concave region */
+    state->w_max = state->max_cwnd;
+    state->k = cbrt((double)state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+    state->outstanding_rtt_measurements = 0;
+    state->rtt_ns = (int64_t)context->cubic_congestion_control_initial_rtt_ns;
+    state->window_update_timeout_ns = state->rtt_ns;
+    state->last_rtt_timestamp_ns = 0;
+    state->last_loss_timestamp_ns = context->nano_clock();
+    state->last_update_timestamp_ns = state->last_loss_timestamp_ns;
+
+    state->counters_manager = counters_manager;
+    state->rtt_indicator_counter_id = aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+    state->window_indicator_counter_id = aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+
+    if (state->rtt_indicator_counter_id < 0 || state->window_indicator_counter_id < 0)
+    {
+        if (state->rtt_indicator_counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, state->rtt_indicator_counter_id);
+        }
+
+        if (state->window_indicator_counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, state->window_indicator_counter_id);
+        }
+
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    state->rtt_indicator = aeron_counter_addr(counters_manager, state->rtt_indicator_counter_id);
+    state->window_indicator = aeron_counter_addr(counters_manager, state->window_indicator_counter_id);
+
+    aeron_counter_set_ordered(state->rtt_indicator, 0);
+    aeron_counter_set_ordered(state->window_indicator, state->cwnd * state->mtu);
 
     *strategy = _strategy;
     return 0;
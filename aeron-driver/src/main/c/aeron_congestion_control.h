@@ -27,6 +27,8 @@ typedef struct aeron_counters_manager_stct aeron_counters_manager_t;
 
 typedef bool (*aeron_congestion_control_strategy_should_measure_rtt_func_t)(void *state, int64_t now_ns);
 
+typedef void (*aeron_congestion_control_strategy_on_rttm_sent_func_t)(void *state, int64_t now_ns);
+
 typedef void (*aeron_congestion_control_strategy_on_rttm_func_t)(
     void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address);
 
@@ -49,6 +51,7 @@ typedef int (*aeron_congestion_control_strategy_fini_func_t)(
 typedef struct aeron_congestion_control_strategy_stct
 {
     aeron_congestion_control_strategy_should_measure_rtt_func_t should_measure_rtt;
+    aeron_congestion_control_strategy_on_rttm_sent_func_t on_rttm_sent;
     aeron_congestion_control_strategy_on_rttm_func_t on_rttm;
     aeron_congestion_control_strategy_on_track_rebuild_func_t on_track_rebuild;
     aeron_congestion_control_strategy_initial_window_length_func_t initial_window_length;
@@ -71,4 +74,29 @@ typedef int (*aeron_congestion_control_strategy_supplier_func_t)(
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name);
 
+int aeron_static_window_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_COUNTER_NAME "rcv-cc-cubic-rtt"
+#define AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_COUNTER_NAME "rcv-cc-cubic-wnd"
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 #endif //AERON_AERON_CONGESTION_CONTROL_H
@@ -151,7 +151,8 @@ int aeron_data_packet_dispatcher_on_data(
     aeron_data_header_t *header,
     uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr)
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp)
 {
     aeron_int64_to_ptr_hash_map_t *session_map =
         aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
@@ -162,7 +163,8 @@ int aeron_data_packet_dispatcher_on_data(
 
         if (NULL != image)
         {
-            return aeron_publication_image_insert_packet(image, header->term_id, header->term_offset, buffer, length);
+            return aeron_publication_image_insert_packet(
+                image, header->term_id, header->term_offset, buffer, length, timestamp);
         }
         else if (NULL == aeron_int64_to_ptr_hash_map_get(
             &dispatcher->ignored_sessions_map,
@@ -198,7 +200,14 @@ int aeron_data_packet_dispatcher_on_setup(
             if (endpoint->conductor_fields.udp_channel->multicast &&
                 endpoint->conductor_fields.udp_channel->multicast_ttl < header->ttl)
             {
-                aeron_counter_ordered_increment(endpoint->possible_ttl_asymmetry_counter, 1);
+                if (endpoint->has_shared_system_counters)
+                {
+                    aeron_counter_increment(endpoint->possible_ttl_asymmetry_counter, 1);
+                }
+                else
+                {
+                    aeron_counter_ordered_increment(endpoint->possible_ttl_asymmetry_counter, 1);
+                }
             }
 
             if (aeron_int64_to_ptr_hash_map_put(
@@ -18,6 +18,7 @@
 #define AERON_AERON_DATA_PACKET_DISPATCHER_H
 
 #include <netinet/in.h>
+#include <time.h>
 #include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "aeron_driver_conductor_proxy.h"
 
@@ -64,7 +65,8 @@ int aeron_data_packet_dispatcher_on_data(
     aeron_data_header_t *header,
     uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr);
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp);
 
 int aeron_data_packet_dispatcher_on_setup(
     aeron_data_packet_dispatcher_t *dispatcher,
@@ -32,6 +32,7 @@
 #include "aeron_alloc.h"
 #include "util/aeron_strutil.h"
 #include "util/aeron_fileutil.h"
+#include "util/aeron_bitutil.h"
 #include "aeron_driver.h"
 
 void aeron_log_func_stderr(const char *str)
@@ -66,6 +67,17 @@ int64_t aeron_epochclock()
     return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
 }
 
+int64_t aeron_epochnanoclock()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_REALTIME, &ts) < 0)
+    {
+        return -1;
+    }
+
+    return (ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
 extern int aeron_number_of_trailing_zeroes(int32_t value);
 extern int aeron_number_of_leading_zeroes(int32_t value);
 extern int32_t aeron_find_next_power_of_two(int32_t value);
@@ -220,6 +232,13 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_t *driver)
         return -1;
     }
 
+    /* files on hugetlbfs, the cnc and loss report as well as logs, must be sized in multiples of its page size */
+    uint64_t hugetlbfs_page_size = aeron_hugetlbfs_page_size(dirname);
+    if (hugetlbfs_page_size > driver->context->file_page_size)
+    {
+        driver->context->file_page_size = (size_t)hugetlbfs_page_size;
+    }
+
     return 0;
 }
 
@@ -245,7 +264,7 @@ void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context)
 int aeron_driver_create_cnc_file(aeron_driver_t *driver)
 {
     char buffer[AERON_MAX_PATH];
-    size_t cnc_file_length = aeron_cnc_length(driver->context);
+    size_t cnc_file_length = AERON_ALIGN(aeron_cnc_length(driver->context), driver->context->file_page_size);
 
     driver->context->cnc_map.addr = NULL;
     driver->context->cnc_map.length = cnc_file_length;
@@ -266,7 +285,8 @@ int aeron_driver_create_loss_report_file(aeron_driver_t *driver)
     char buffer[AERON_MAX_PATH];
 
     driver->context->loss_report.addr = NULL;
-    driver->context->loss_report.length = driver->context->loss_report_length;
+    driver->context->loss_report.length =
+        AERON_ALIGN(driver->context->loss_report_length, driver->context->file_page_size);
 
     snprintf(buffer, sizeof(buffer) - 1, "%s/%s", driver->context->aeron_dir, AERON_LOSS_REPORT_FILE);
 
@@ -318,6 +338,99 @@ void aeron_driver_shared_network_on_close(void *clientd)
     aeron_driver_receiver_on_close(&driver->receiver);
 }
 
+/*
+ * The CPU list for shard index of a list per shard split by '/'. A list without a '/' pins only the first shard.
+ */
+static const char *aeron_driver_shard_cpu_affinity(
+    const char *cpu_affinity, size_t shard_index, char *buffer, size_t buffer_length)
+{
+    const char *segment = cpu_affinity;
+
+    if (NULL == cpu_affinity)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < shard_index; i++)
+    {
+        if (NULL == (segment = strchr(segment, '/')))
+        {
+            return NULL;
+        }
+
+        segment++;
+    }
+
+    const char *end = strchr(segment, '/');
+    size_t length = NULL == end ? strlen(segment) : (size_t)(end - segment);
+
+    snprintf(buffer, buffer_length, "%.*s", (int)length, segment);
+
+    return buffer;
+}
+
+/*
+ * Pinning the conductor also places the pages it prefaults for new logs, and those it allocates for its own state,
+ * on the node of its CPUs by first touch.
+ */
+static int aeron_driver_runners_cpu_affinity(aeron_driver_t *driver)
+{
+    char buffer[AERON_MAX_PATH];
+    aeron_driver_context_t *context = driver->context;
+
+    switch (context->threading_mode)
+    {
+        case AERON_THREADING_MODE_SHARED:
+            return aeron_agent_cpu_affinity(&driver->runners[AERON_AGENT_RUNNER_SHARED], context->shared_cpu_affinity);
+
+        case AERON_THREADING_MODE_SHARED_NETWORK:
+            if (aeron_agent_cpu_affinity(
+                &driver->runners[AERON_AGENT_RUNNER_CONDUCTOR], context->conductor_cpu_affinity) < 0)
+            {
+                return -1;
+            }
+
+            return aeron_agent_cpu_affinity(
+                &driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK], context->shared_network_cpu_affinity);
+
+        case AERON_THREADING_MODE_DEDICATED:
+        default:
+            if (aeron_agent_cpu_affinity(
+                &driver->runners[AERON_AGENT_RUNNER_CONDUCTOR], context->conductor_cpu_affinity) < 0)
+            {
+                return -1;
+            }
+
+            for (size_t i = 0; i < context->sender_shard_count; i++)
+            {
+                int runner_index = 0 == i ?
+                    AERON_AGENT_RUNNER_SENDER : AERON_AGENT_RUNNER_SENDER_SHARDS + (int)i - 1;
+
+                if (aeron_agent_cpu_affinity(
+                    &driver->runners[runner_index],
+                    aeron_driver_shard_cpu_affinity(context->sender_cpu_affinity, i, buffer, sizeof(buffer))) < 0)
+                {
+                    return -1;
+                }
+            }
+
+            for (size_t i = 0; i < context->receiver_shard_count; i++)
+            {
+                int runner_index = 0 == i ?
+                    AERON_AGENT_RUNNER_RECEIVER : AERON_AGENT_RUNNER_RECEIVER_SHARDS + (int)i - 1;
+
+                if (aeron_agent_cpu_affinity(
+                    &driver->runners[runner_index],
+                    aeron_driver_shard_cpu_affinity(context->receiver_cpu_affinity, i, buffer, sizeof(buffer))) < 0)
+                {
+                    return -1;
+                }
+            }
+
+            return 0;
+    }
+}
+
 int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
 {
     aeron_driver_t *_driver = NULL;
@@ -381,6 +494,16 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
 
     _driver->context->receiver_proxy = &_driver->receiver.receiver_proxy;
 
+    /* only dedicated senders and receivers can be sharded as the others share a single thread anyway */
+    if (AERON_THREADING_MODE_DEDICATED != _driver->context->threading_mode)
+    {
+        _driver->context->sender_shard_count = 1;
+        _driver->context->receiver_shard_count = 1;
+    }
+
+    _driver->context->sender_shard_proxies[0] = &_driver->sender.sender_proxy;
+    _driver->context->receiver_shard_proxies[0] = &_driver->receiver.receiver_proxy;
+
     aeron_mpsc_rb_consumer_heartbeat_time(&_driver->conductor.to_driver_commands, aeron_epochclock());
 
     switch (_driver->context->threading_mode)
@@ -451,6 +574,41 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 return -1;
             }
 
+            for (size_t i = 1; i < _driver->context->sender_shard_count; i++)
+            {
+                aeron_driver_sender_t *shard = &_driver->sender_shards[i - 1];
+                aeron_idle_strategy_func_t idle_strategy_func = NULL;
+                char role_name[AERON_MAX_PATH];
+
+                if (aeron_driver_sender_shard_init(
+                    shard, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+                {
+                    return -1;
+                }
+
+                if ((idle_strategy_func = aeron_idle_strategy_load(
+                    _driver->context->sender_idle_strategy_name, &shard->shard_idle_strategy_state)) == NULL)
+                {
+                    return -1;
+                }
+
+                snprintf(role_name, sizeof(role_name) - 1, "sender-%zu", i);
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_SENDER_SHARDS + i - 1],
+                    role_name,
+                    shard,
+                    aeron_driver_sender_do_work,
+                    aeron_driver_sender_on_close,
+                    idle_strategy_func,
+                    shard->shard_idle_strategy_state) < 0)
+                {
+                    return -1;
+                }
+
+                _driver->context->sender_shard_proxies[i] = &shard->sender_proxy;
+            }
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
                 "receiver",
@@ -462,9 +620,92 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 return -1;
             }
+
+            for (size_t i = 1; i < _driver->context->receiver_shard_count; i++)
+            {
+                aeron_driver_receiver_t *shard = &_driver->receiver_shards[i - 1];
+                aeron_idle_strategy_func_t idle_strategy_func = NULL;
+                char role_name[AERON_MAX_PATH];
+
+                if (aeron_driver_receiver_shard_init(
+                    shard, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
+                {
+                    return -1;
+                }
+
+                if ((idle_strategy_func = aeron_idle_strategy_load(
+                    _driver->context->receiver_idle_strategy_name, &shard->shard_idle_strategy_state)) == NULL)
+                {
+                    return -1;
+                }
+
+                snprintf(role_name, sizeof(role_name) - 1, "receiver-%zu", i);
+
+                if (aeron_agent_init(
+                    &_driver->runners[AERON_AGENT_RUNNER_RECEIVER_SHARDS + i - 1],
+                    role_name,
+                    shard,
+                    aeron_driver_receiver_do_work,
+                    aeron_driver_receiver_on_close,
+                    idle_strategy_func,
+                    shard->shard_idle_strategy_state) < 0)
+                {
+                    return -1;
+                }
+
+                _driver->context->receiver_shard_proxies[i] = &shard->receiver_proxy;
+            }
             break;
     }
 
+    if (aeron_driver_runners_cpu_affinity(_driver) < 0)
+    {
+        return -1;
+    }
+
+    if (_driver->context->log_buffer_pool_size > 0)
+    {
+        if (aeron_log_buffer_pool_init(&_driver->log_buffer_pool, context) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_agent_init(
+            &_driver->runners[AERON_AGENT_RUNNER_LOG_BUFFER_POOL],
+            "log-buffer-pool",
+            &_driver->log_buffer_pool,
+            aeron_log_buffer_pool_do_work,
+            aeron_log_buffer_pool_on_close,
+            _driver->context->log_buffer_pool_idle_strategy_func,
+            _driver->context->log_buffer_pool_idle_strategy_state) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_agent_cpu_affinity(
+            &_driver->runners[AERON_AGENT_RUNNER_LOG_BUFFER_POOL], _driver->context->log_buffer_pool_cpu_affinity) < 0)
+        {
+            return -1;
+        }
+
+        _driver->context->log_buffer_pool = &_driver->log_buffer_pool;
+    }
+
+    for (int i = 0; i < AERON_AGENT_RUNNER_MAX; i++)
+    {
+        aeron_agent_runner_t *runner = &_driver->runners[i];
+
+        if (AERON_AGENT_STATE_INITED == runner->state &&
+            aeron_idle_strategy_counters_allocate(
+                runner->idle_strategy,
+                runner->idle_strategy_state,
+                &_driver->conductor.counters_manager,
+                runner->role_name) < 0)
+        {
+            return -1;
+        }
+    }
+
     *driver = _driver;
     return 0;
 }
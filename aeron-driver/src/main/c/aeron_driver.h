@@ -22,20 +22,29 @@
 #include "aeron_driver_conductor.h"
 #include "aeron_driver_sender.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_log_buffer_pool.h"
 
 #define AERON_AGENT_RUNNER_CONDUCTOR 0
 #define AERON_AGENT_RUNNER_SENDER 1
 #define AERON_AGENT_RUNNER_RECEIVER 2
 #define AERON_AGENT_RUNNER_SHARED_NETWORK 1
 #define AERON_AGENT_RUNNER_SHARED 0
-#define AERON_AGENT_RUNNER_MAX 3
+#define AERON_AGENT_RUNNER_LOG_BUFFER_POOL 3
+/* receiver shards after the first, which runs on AERON_AGENT_RUNNER_RECEIVER */
+#define AERON_AGENT_RUNNER_RECEIVER_SHARDS 4
+/* sender shards after the first, which runs on AERON_AGENT_RUNNER_SENDER */
+#define AERON_AGENT_RUNNER_SENDER_SHARDS (AERON_AGENT_RUNNER_RECEIVER_SHARDS + AERON_DRIVER_MAX_SHARDS - 1)
+#define AERON_AGENT_RUNNER_MAX (AERON_AGENT_RUNNER_SENDER_SHARDS + AERON_DRIVER_MAX_SHARDS - 1)
 
 typedef struct aeron_driver_stct
 {
     aeron_driver_context_t *context;
     aeron_driver_conductor_t conductor;
     aeron_driver_sender_t sender;
+    aeron_driver_sender_t sender_shards[AERON_DRIVER_MAX_SHARDS - 1];
     aeron_driver_receiver_t receiver;
+    aeron_driver_receiver_t receiver_shards[AERON_DRIVER_MAX_SHARDS - 1];
+    aeron_log_buffer_pool_t log_buffer_pool;
     aeron_agent_runner_t runners[AERON_AGENT_RUNNER_MAX];
 }
 aeron_driver_t;
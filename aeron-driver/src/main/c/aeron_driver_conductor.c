@@ -84,6 +84,30 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->client_by_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->ipc_publication_by_stream_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->network_publication_by_endpoint_stream_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_hash_map_init(
+        &conductor->subscription_link_by_registration_id_map, 64, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_loss_reporter_init(&conductor->loss_reporter, context->loss_report.addr, context->loss_report.length) < 0)
     {
         return -1;
@@ -98,9 +122,9 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->clients.array = NULL;
     conductor->clients.capacity = 0;
     conductor->clients.length = 0;
-    conductor->clients.on_time_event = aeron_client_on_time_event;
-    conductor->clients.has_reached_end_of_life = aeron_client_has_reached_end_of_life;
-    conductor->clients.delete_func = aeron_client_delete;
+    conductor->clients.on_time_event = aeron_client_entry_on_time_event;
+    conductor->clients.has_reached_end_of_life = aeron_client_entry_has_reached_end_of_life;
+    conductor->clients.delete_func = aeron_client_entry_delete;
 
     conductor->ipc_publications.array = NULL;
     conductor->ipc_publications.length = 0;
@@ -162,80 +186,214 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     return 0;
 }
 
-int aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id)
+int64_t aeron_driver_conductor_network_publication_key(aeron_send_channel_endpoint_t *endpoint, int32_t stream_id)
 {
-    int index = -1;
+    /* the channel status counter is unique to each endpoint for as long as it is open */
+    return aeron_int64_to_ptr_hash_map_compound_key((int32_t)endpoint->channel_status.counter_id, stream_id);
+}
 
-    for (int i = (int)conductor->clients.length - 1; i >= 0; i--)
+int aeron_driver_conductor_index_subscription_links(
+    aeron_driver_conductor_t *conductor, aeron_subscription_link_t *links, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
     {
-        if (client_id == conductor->clients.array[i].client_id)
+        if (aeron_int64_to_ptr_hash_map_put(
+            &conductor->subscription_link_by_registration_id_map, links[i].registration_id, &links[i]) < 0)
         {
-            index = i;
-            break;
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index subscription link: %s", strerror(errcode));
+            return -1;
         }
     }
 
-    return index;
+    return 0;
 }
 
-aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_t *conductor, int64_t client_id)
+void aeron_driver_conductor_remove_subscription_link(
+    aeron_driver_conductor_t *conductor, aeron_subscription_link_t *links, size_t *length, size_t index)
 {
-    aeron_client_t *client = NULL;
-    int index;
+    size_t last_index = *length - 1;
 
-    if ((index = aeron_driver_conductor_find_client(conductor, client_id)) == -1)
+    aeron_int64_to_ptr_hash_map_remove(&conductor->subscription_link_by_registration_id_map, links[index].registration_id);
+
+    if (index != last_index)
     {
-        int ensure_capacity_result = 0;
+        aeron_array_fast_unordered_remove((uint8_t *)links, sizeof(aeron_subscription_link_t), index, last_index);
 
-        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->clients, aeron_client_t);
+        /* existing key so the map does not grow */
+        aeron_int64_to_ptr_hash_map_put(
+            &conductor->subscription_link_by_registration_id_map, links[index].registration_id, &links[index]);
+    }
 
-        if (ensure_capacity_result >= 0)
+    (*length)--;
+}
+
+int aeron_client_index_publication_links(aeron_client_t *client)
+{
+    for (size_t i = 0; i < client->publication_links.length; i++)
+    {
+        aeron_publication_link_t *link = &client->publication_links.array[i];
+
+        if (aeron_int64_to_ptr_hash_map_put(
+            &client->publication_link_by_registration_id_map, link->resource->registration_id, link) < 0)
         {
-            index = (int) conductor->clients.length;
-            client = &conductor->clients.array[index];
-
-            client->client_id = client_id;
-            client->reached_end_of_life = false;
-            client->time_of_last_keepalive = conductor->context->nano_clock();
-            client->client_liveness_timeout_ns = conductor->context->client_liveness_timeout_ns;
-            client->publication_links.array = NULL;
-            client->publication_links.length = 0;
-            client->publication_links.capacity = 0;
-            conductor->clients.length++;
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index publication link: %s", strerror(errcode));
+            return -1;
         }
     }
-    else
+
+    return 0;
+}
+
+int aeron_client_link_publication(aeron_client_t *client, aeron_driver_managed_resource_t *resource)
+{
+    aeron_publication_link_t *link =
+        aeron_int64_to_ptr_hash_map_get(&client->publication_link_by_registration_id_map, resource->registration_id);
+
+    if (NULL != link)
+    {
+        link->refcnt++;
+        return 0;
+    }
+
+    aeron_publication_link_t *links = client->publication_links.array;
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, client->publication_links, aeron_publication_link_t);
+    if (ensure_capacity_result < 0 ||
+        (links != client->publication_links.array && aeron_client_index_publication_links(client) < 0))
+    {
+        return -1;
+    }
+
+    link = &client->publication_links.array[client->publication_links.length];
+    link->resource = resource;
+    link->refcnt = 1;
+
+    if (aeron_int64_to_ptr_hash_map_put(
+        &client->publication_link_by_registration_id_map, resource->registration_id, link) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "could not index publication link: %s", strerror(errcode));
+        return -1;
+    }
+
+    client->publication_links.length++;
+
+    return 0;
+}
+
+void aeron_client_unlink_publication(aeron_client_t *client, aeron_publication_link_t *link)
+{
+    if (0 == --link->refcnt)
+    {
+        int64_t registration_id = link->resource->registration_id;
+        size_t index = (size_t)(link - client->publication_links.array);
+        size_t last_index = client->publication_links.length - 1;
+
+        aeron_int64_to_ptr_hash_map_remove(&client->publication_link_by_registration_id_map, registration_id);
+
+        if (index != last_index)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)client->publication_links.array, sizeof(aeron_publication_link_t), index, last_index);
+
+            /* existing key so the map does not grow */
+            aeron_int64_to_ptr_hash_map_put(
+                &client->publication_link_by_registration_id_map, link->resource->registration_id, link);
+        }
+
+        client->publication_links.length--;
+    }
+}
+
+aeron_client_t *aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id)
+{
+    return aeron_int64_to_ptr_hash_map_get(&conductor->client_by_id_map, client_id);
+}
+
+aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_t *conductor, int64_t client_id)
+{
+    aeron_client_t *client = aeron_driver_conductor_find_client(conductor, client_id);
+
+    if (NULL == client)
     {
-        client = &conductor->clients.array[index];
+        int ensure_capacity_result = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->clients, aeron_client_entry_t);
+
+        if (ensure_capacity_result < 0 || aeron_alloc((void **)&client, sizeof(aeron_client_t)) < 0)
+        {
+            return NULL;
+        }
+
+        client->client_id = client_id;
+        client->reached_end_of_life = false;
+        client->time_of_last_keepalive = conductor->context->nano_clock();
+        client->client_liveness_timeout_ns = conductor->context->client_liveness_timeout_ns;
+        client->publication_links.array = NULL;
+        client->publication_links.length = 0;
+        client->publication_links.capacity = 0;
+
+        if (aeron_int64_to_ptr_hash_map_init(
+            &client->publication_link_by_registration_id_map, 16, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+        {
+            aeron_int64_to_ptr_hash_map_delete(&client->publication_link_by_registration_id_map);
+            aeron_free(client);
+            return NULL;
+        }
+
+        if (aeron_int64_to_ptr_hash_map_put(&conductor->client_by_id_map, client_id, client) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index client: %s", strerror(errcode));
+            aeron_int64_to_ptr_hash_map_delete(&client->publication_link_by_registration_id_map);
+            aeron_free(client);
+            return NULL;
+        }
+
+        conductor->clients.array[conductor->clients.length++].client = client;
     }
 
     return client;
 }
 
-void aeron_client_on_time_event(
-    aeron_driver_conductor_t *conductor, aeron_client_t *client, int64_t now_ns, int64_t now_ms)
+void aeron_client_entry_on_time_event(
+    aeron_driver_conductor_t *conductor, aeron_client_entry_t *entry, int64_t now_ns, int64_t now_ms)
 {
+    aeron_client_t *client = entry->client;
+
     if (now_ns > (client->time_of_last_keepalive + client->client_liveness_timeout_ns))
     {
         client->reached_end_of_life = true;
     }
 }
 
-bool aeron_client_has_reached_end_of_life(aeron_driver_conductor_t *conductor, aeron_client_t *client)
+bool aeron_client_entry_has_reached_end_of_life(aeron_driver_conductor_t *conductor, aeron_client_entry_t *entry)
 {
-    return client->reached_end_of_life;
+    return entry->client->reached_end_of_life;
 }
 
-void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *client)
+void aeron_client_entry_delete(aeron_driver_conductor_t *conductor, aeron_client_entry_t *entry)
 {
+    aeron_client_t *client = entry->client;
+
     for (size_t i = 0; i < client->publication_links.length; i++)
     {
-        aeron_driver_managed_resource_t *resource = client->publication_links.array[i].resource;
+        aeron_publication_link_t *link = &client->publication_links.array[i];
 
-        resource->decref(resource->clientd);
+        for (int32_t j = 0; j < link->refcnt; j++)
+        {
+            link->resource->decref(link->resource->clientd);
+        }
     }
 
-    for (size_t i = 0, size = conductor->ipc_subscriptions.length, last_index = size - 1; i < size; i++)
+    for (int i = (int)conductor->ipc_subscriptions.length - 1; i >= 0; i--)
     {
         aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[i];
 
@@ -243,13 +401,12 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
         {
             aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->ipc_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->ipc_subscriptions.length--;
+            aeron_driver_conductor_remove_subscription_link(
+                conductor, conductor->ipc_subscriptions.array, &conductor->ipc_subscriptions.length, (size_t)i);
         }
     }
 
-    for (size_t i = 0, size = conductor->network_subscriptions.length, last_index = size - 1; i < size; i++)
+    for (int i = (int)conductor->network_subscriptions.length - 1; i >= 0; i--)
     {
         aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
 
@@ -271,13 +428,12 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
 
             aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->network_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->network_subscriptions.length--;
+            aeron_driver_conductor_remove_subscription_link(
+                conductor, conductor->network_subscriptions.array, &conductor->network_subscriptions.length, (size_t)i);
         }
     }
 
-    for (size_t i = 0, size = conductor->spy_subscriptions.length, last_index = size - 1; i < size; i++)
+    for (int i = (int)conductor->spy_subscriptions.length - 1; i >= 0; i--)
     {
         aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
 
@@ -287,14 +443,16 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
             link->spy_channel = NULL;
             aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->spy_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->spy_subscriptions.length--;
+            aeron_driver_conductor_remove_subscription_link(
+                conductor, conductor->spy_subscriptions.array, &conductor->spy_subscriptions.length, (size_t)i);
         }
     }
 
-    client->publication_links.length = 0; /* reuse array if it exists. */
-    client->client_id = -1;
+    aeron_int64_to_ptr_hash_map_remove(&conductor->client_by_id_map, client->client_id);
+    aeron_int64_to_ptr_hash_map_delete(&client->publication_link_by_registration_id_map);
+    aeron_free(client->publication_links.array);
+    aeron_free(client);
+    entry->client = NULL;
 }
 
 void aeron_ipc_publication_entry_on_time_event(
@@ -349,6 +507,12 @@ void aeron_ipc_publication_entry_delete(
         aeron_driver_conductor_unlink_subscribeable(link, &entry->publication->conductor_fields.subscribeable);
     }
 
+    if (aeron_int64_to_ptr_hash_map_get(&conductor->ipc_publication_by_stream_id_map, entry->publication->stream_id) ==
+        entry->publication)
+    {
+        aeron_int64_to_ptr_hash_map_remove(&conductor->ipc_publication_by_stream_id_map, entry->publication->stream_id);
+    }
+
     aeron_ipc_publication_close(&conductor->counters_manager, entry->publication);
     entry->publication = NULL;
 }
@@ -369,6 +533,13 @@ void aeron_network_publication_entry_delete(
     aeron_driver_conductor_t *conductor, aeron_network_publication_entry_t *entry)
 {
     aeron_send_channel_endpoint_t *endpoint = entry->publication->endpoint;
+    int64_t key = aeron_driver_conductor_network_publication_key(endpoint, entry->publication->stream_id);
+
+    if (aeron_int64_to_ptr_hash_map_get(&conductor->network_publication_by_endpoint_stream_id_map, key) ==
+        entry->publication)
+    {
+        aeron_int64_to_ptr_hash_map_remove(&conductor->network_publication_by_endpoint_stream_id_map, key);
+    }
 
     aeron_network_publication_close(&conductor->counters_manager, entry->publication);
     entry->publication = NULL;
@@ -396,7 +567,7 @@ void aeron_driver_conductor_cleanup_spies(aeron_driver_conductor_t *conductor, a
 void aeron_driver_conductor_cleanup_network_publication(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
 {
-    aeron_driver_sender_proxy_remove_publication(conductor->context->sender_proxy, publication);
+    aeron_driver_sender_proxy_remove_publication(publication->endpoint->sender_proxy, publication);
 }
 
 void aeron_send_channel_endpoint_entry_on_time_event(
@@ -410,7 +581,7 @@ void aeron_send_channel_endpoint_entry_on_time_event(
             &conductor->send_channel_endpoint_by_channel_map,
             endpoint->conductor_fields.udp_channel->canonical_form,
             endpoint->conductor_fields.udp_channel->canonical_length);
-        aeron_driver_sender_proxy_remove_endpoint(conductor->context->sender_proxy, endpoint);
+        aeron_driver_sender_proxy_remove_endpoint(endpoint->sender_proxy, endpoint);
     }
 }
 
@@ -493,7 +664,7 @@ void aeron_driver_conductor_on_check_managed_resources(
     aeron_driver_conductor_t *conductor, int64_t now_ns, int64_t now_ms)
 {
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
-        conductor, conductor->clients, aeron_client_t, now_ns, now_ms);
+        conductor, conductor->clients, aeron_client_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
         conductor, conductor->ipc_publications, aeron_ipc_publication_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
@@ -506,6 +677,32 @@ void aeron_driver_conductor_on_check_managed_resources(
         conductor, conductor->publication_images, aeron_publication_image_entry_t, now_ns, now_ms);
 }
 
+static int aeron_driver_conductor_link_new_publication(
+    aeron_client_t *client,
+    aeron_driver_managed_resource_t *resource,
+    aeron_int64_to_ptr_hash_map_t *shared_publication_map,
+    int64_t key)
+{
+    if (aeron_client_link_publication(client, resource) < 0)
+    {
+        return -1;
+    }
+
+    if (NULL != shared_publication_map &&
+        aeron_int64_to_ptr_hash_map_put(shared_publication_map, key, resource->clientd) < 0)
+    {
+        int errcode = errno;
+        aeron_publication_link_t *link =
+            aeron_int64_to_ptr_hash_map_get(&client->publication_link_by_registration_id_map, resource->registration_id);
+
+        aeron_client_unlink_publication(client, link);
+        aeron_set_err(errcode, "could not index shared publication: %s", strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
 aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
     aeron_driver_conductor_t *conductor,
     aeron_client_t *client,
@@ -514,77 +711,80 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
     bool is_exclusive)
 {
     aeron_ipc_publication_t *publication = NULL;
-    int ensure_capacity_result = 0;
 
     if (!is_exclusive)
     {
-        for (size_t i = 0; i < conductor->ipc_publications.length; i++)
-        {
-            aeron_ipc_publication_t *pub_entry = conductor->ipc_publications.array[i].publication;
+        aeron_ipc_publication_t *shared_publication =
+            aeron_int64_to_ptr_hash_map_get(&conductor->ipc_publication_by_stream_id_map, stream_id);
 
-            if (stream_id == pub_entry->stream_id &&
-                !pub_entry->is_exclusive &&
-                pub_entry->conductor_fields.status == AERON_IPC_PUBLICATION_STATUS_ACTIVE)
-            {
-                publication = pub_entry;
-                break;
-            }
+        if (NULL != shared_publication &&
+            shared_publication->conductor_fields.status == AERON_IPC_PUBLICATION_STATUS_ACTIVE)
+        {
+            publication = shared_publication;
         }
     }
 
-    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, client->publication_links, aeron_publication_link_t);
-
-    if (ensure_capacity_result >= 0)
+    if (NULL == publication)
     {
-        if (NULL == publication)
-        {
-            AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->ipc_publications, aeron_ipc_publication_entry_t);
+        int ensure_capacity_result = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->ipc_publications, aeron_ipc_publication_entry_t);
 
-            if (ensure_capacity_result >= 0)
+        if (ensure_capacity_result >= 0)
+        {
+            int32_t session_id = conductor->next_session_id++;
+            int32_t initial_term_id = aeron_randomised_int32();
+            aeron_position_t pub_lmt_position;
+
+            pub_lmt_position.counter_id =
+                aeron_counter_publisher_limit_allocate(
+                    &conductor->counters_manager, registration_id, session_id, stream_id, AERON_IPC_CHANNEL);
+            pub_lmt_position.value_addr =
+                aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_lmt_position.counter_id);
+
+            if (pub_lmt_position.counter_id >= 0 &&
+                aeron_ipc_publication_create(
+                    &publication,
+                    conductor->context,
+                    session_id,
+                    stream_id,
+                    registration_id,
+                    &pub_lmt_position,
+                    initial_term_id,
+                    conductor->context->ipc_term_buffer_length,
+                    conductor->context->mtu_length,
+                    is_exclusive) >= 0)
             {
-                int32_t session_id = conductor->next_session_id++;
-                int32_t initial_term_id = aeron_randomised_int32();
-                aeron_position_t pub_lmt_position;
-
-                pub_lmt_position.counter_id =
-                    aeron_counter_publisher_limit_allocate(
-                        &conductor->counters_manager, registration_id, session_id, stream_id, AERON_IPC_CHANNEL);
-                pub_lmt_position.value_addr =
-                    aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_lmt_position.counter_id);
-
-                if (pub_lmt_position.counter_id >= 0 &&
-                    aeron_ipc_publication_create(
-                        &publication,
-                        conductor->context,
-                        session_id,
-                        stream_id,
-                        registration_id,
-                        &pub_lmt_position,
-                        initial_term_id,
-                        conductor->context->ipc_term_buffer_length,
-                        conductor->context->mtu_length,
-                        is_exclusive) >= 0)
-                {
-                    client->publication_links.array[client->publication_links.length++].resource =
-                        &publication->conductor_fields.managed_resource;
+                conductor->ipc_publications.array[conductor->ipc_publications.length++].publication = publication;
 
-                    conductor->ipc_publications.array[conductor->ipc_publications.length++].publication = publication;
+                publication->conductor_fields.managed_resource.time_of_last_status_change =
+                    conductor->nano_clock();
 
-                    publication->conductor_fields.managed_resource.time_of_last_status_change =
-                        conductor->nano_clock();
+                if (aeron_driver_conductor_link_new_publication(
+                    client,
+                    &publication->conductor_fields.managed_resource,
+                    is_exclusive ? NULL : &conductor->ipc_publication_by_stream_id_map,
+                    stream_id) < 0)
+                {
+                    conductor->ipc_publications.length--;
+                    aeron_ipc_publication_decref(publication);
+                    aeron_ipc_publication_close(&conductor->counters_manager, publication);
+                    return NULL;
                 }
             }
         }
-        else
+    }
+    else
+    {
+        if (aeron_client_link_publication(client, &publication->conductor_fields.managed_resource) < 0)
         {
-            client->publication_links.array[client->publication_links.length++].resource =
-                &publication->conductor_fields.managed_resource;
-
-            publication->conductor_fields.managed_resource.incref(publication->conductor_fields.managed_resource.clientd);
+            return NULL;
         }
+
+        publication->conductor_fields.managed_resource.incref(publication->conductor_fields.managed_resource.clientd);
     }
 
-    return ensure_capacity_result >= 0 ? publication : NULL;
+    return publication;
 }
 
 aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publication(
@@ -598,122 +798,127 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
     aeron_network_publication_t *publication = NULL;
     aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
     const char *channel = udp_channel->original_uri;
-    int ensure_capacity_result = 0;
+    int64_t key = aeron_driver_conductor_network_publication_key(endpoint, stream_id);
 
     if (!is_exclusive)
     {
-        for (size_t i = 0; i < conductor->network_publications.length; i++)
-        {
-            aeron_network_publication_t *pub_entry = conductor->network_publications.array[i].publication;
+        aeron_network_publication_t *shared_publication =
+            aeron_int64_to_ptr_hash_map_get(&conductor->network_publication_by_endpoint_stream_id_map, key);
 
-            if (endpoint == pub_entry->endpoint &&
-                stream_id == pub_entry->stream_id &&
-                !pub_entry->is_exclusive &&
-                pub_entry->conductor_fields.status == AERON_NETWORK_PUBLICATION_STATUS_ACTIVE)
-            {
-                publication = pub_entry;
-                break;
-            }
+        if (NULL != shared_publication &&
+            endpoint == shared_publication->endpoint &&
+            shared_publication->conductor_fields.status == AERON_NETWORK_PUBLICATION_STATUS_ACTIVE)
+        {
+            publication = shared_publication;
         }
     }
 
-    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, client->publication_links, aeron_publication_link_t);
-
-    if (ensure_capacity_result >= 0)
+    if (NULL == publication)
     {
-        if (NULL == publication)
+        int ensure_capacity_result = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->network_publications, aeron_network_publication_entry_t);
+
+        if (ensure_capacity_result >= 0)
         {
-            AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->network_publications, aeron_network_publication_entry_t);
+            int32_t session_id = conductor->next_session_id++;
+            int32_t initial_term_id = aeron_randomised_int32();
+            aeron_position_t pub_lmt_position;
+            aeron_position_t snd_pos_position;
+            aeron_position_t snd_lmt_position;
+            aeron_flow_control_strategy_supplier_func_t flow_control_strategy_supplier_func =
+                (udp_channel->explicit_control || udp_channel->multicast) ?
+                    conductor->context->multicast_flow_control_supplier_func :
+                    conductor->context->unicast_flow_control_supplier_func;
+            aeron_flow_control_strategy_t *flow_control_strategy;
+
+            pub_lmt_position.counter_id =
+                aeron_counter_publisher_limit_allocate(
+                    &conductor->counters_manager, registration_id, session_id, stream_id, channel);
+            snd_pos_position.counter_id =
+                aeron_counter_sender_position_allocate(
+                    &conductor->counters_manager, registration_id, session_id, stream_id, channel);
+            snd_lmt_position.counter_id =
+                aeron_counter_sender_limit_allocate(
+                    &conductor->counters_manager, registration_id, session_id, stream_id, channel);
+
+            if (pub_lmt_position.counter_id < 0 ||
+                snd_pos_position.counter_id < 0 ||
+                snd_lmt_position.counter_id < 0)
+            {
+                return NULL;
+            }
+
+            pub_lmt_position.value_addr =
+                aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_lmt_position.counter_id);
+            snd_pos_position.value_addr =
+                aeron_counter_addr(&conductor->counters_manager, (int32_t)snd_pos_position.counter_id);
+            snd_lmt_position.value_addr =
+                aeron_counter_addr(&conductor->counters_manager, (int32_t)snd_lmt_position.counter_id);
 
-            if (ensure_capacity_result >= 0)
+            if (flow_control_strategy_supplier_func(
+                &flow_control_strategy,
+                endpoint->conductor_fields.udp_channel->original_uri,
+                stream_id,
+                registration_id,
+                initial_term_id,
+                conductor->context->term_buffer_length,
+                conductor->context) < 0)
             {
-                int32_t session_id = conductor->next_session_id++;
-                int32_t initial_term_id = aeron_randomised_int32();
-                aeron_position_t pub_lmt_position;
-                aeron_position_t snd_pos_position;
-                aeron_position_t snd_lmt_position;
-                aeron_flow_control_strategy_supplier_func_t flow_control_strategy_supplier_func =
-                    (udp_channel->explicit_control || udp_channel->multicast) ?
-                        conductor->context->multicast_flow_control_supplier_func :
-                        conductor->context->unicast_flow_control_supplier_func;
-                aeron_flow_control_strategy_t *flow_control_strategy;
-
-                pub_lmt_position.counter_id =
-                    aeron_counter_publisher_limit_allocate(
-                        &conductor->counters_manager, registration_id, session_id, stream_id, channel);
-                snd_pos_position.counter_id =
-                    aeron_counter_sender_position_allocate(
-                        &conductor->counters_manager, registration_id, session_id, stream_id, channel);
-                snd_lmt_position.counter_id =
-                    aeron_counter_sender_limit_allocate(
-                        &conductor->counters_manager, registration_id, session_id, stream_id, channel);
-
-                if (pub_lmt_position.counter_id < 0 ||
-                    snd_pos_position.counter_id < 0 ||
-                    snd_lmt_position.counter_id < 0)
-                {
-                    return NULL;
-                }
+                return NULL;
+            }
 
-                pub_lmt_position.value_addr =
-                    aeron_counter_addr(&conductor->counters_manager, (int32_t)pub_lmt_position.counter_id);
-                snd_pos_position.value_addr =
-                    aeron_counter_addr(&conductor->counters_manager, (int32_t)snd_pos_position.counter_id);
-                snd_lmt_position.value_addr =
-                    aeron_counter_addr(&conductor->counters_manager, (int32_t)snd_lmt_position.counter_id);
+            if (aeron_network_publication_create(
+                &publication,
+                endpoint,
+                conductor->context,
+                registration_id,
+                session_id,
+                stream_id,
+                initial_term_id,
+                conductor->context->mtu_length,
+                &pub_lmt_position,
+                &snd_pos_position,
+                &snd_lmt_position,
+                flow_control_strategy,
+                conductor->context->term_buffer_length,
+                is_exclusive,
+                &conductor->system_counters) >= 0)
+            {
+                conductor->network_publications.array[conductor->network_publications.length++].publication = publication;
 
-                if (flow_control_strategy_supplier_func(
-                    &flow_control_strategy,
-                    endpoint->conductor_fields.udp_channel->original_uri,
-                    stream_id,
-                    registration_id,
-                    initial_term_id,
-                    conductor->context->term_buffer_length) < 0)
+                publication->conductor_fields.managed_resource.time_of_last_status_change =
+                    conductor->nano_clock();
+
+                if (aeron_driver_conductor_link_new_publication(
+                    client,
+                    &publication->conductor_fields.managed_resource,
+                    is_exclusive ? NULL : &conductor->network_publication_by_endpoint_stream_id_map,
+                    key) < 0)
                 {
+                    conductor->network_publications.length--;
+                    aeron_network_publication_decref(publication);
+                    aeron_network_publication_close(&conductor->counters_manager, publication);
                     return NULL;
                 }
 
-                if (pub_lmt_position.counter_id >= 0 &&
-                    aeron_network_publication_create(
-                        &publication,
-                        endpoint,
-                        conductor->context,
-                        registration_id,
-                        session_id,
-                        stream_id,
-                        initial_term_id,
-                        conductor->context->mtu_length,
-                        &pub_lmt_position,
-                        &snd_pos_position,
-                        &snd_lmt_position,
-                        flow_control_strategy,
-                        conductor->context->term_buffer_length,
-                        is_exclusive,
-                        &conductor->system_counters) >= 0)
-                {
-                    endpoint->conductor_fields.managed_resource.incref(endpoint->conductor_fields.managed_resource.clientd);
-                    aeron_driver_sender_proxy_add_publication(conductor->context->sender_proxy, publication);
-
-                    client->publication_links.array[client->publication_links.length++].resource =
-                        &publication->conductor_fields.managed_resource;
-
-                    conductor->network_publications.array[conductor->network_publications.length++].publication = publication;
-
-                    publication->conductor_fields.managed_resource.time_of_last_status_change =
-                        conductor->nano_clock();
-                }
+                /* only hand the publication to the sender once the conductor can no longer roll it back */
+                endpoint->conductor_fields.managed_resource.incref(endpoint->conductor_fields.managed_resource.clientd);
+                aeron_driver_sender_proxy_add_publication(endpoint->sender_proxy, publication);
             }
         }
-        else
+    }
+    else
+    {
+        if (aeron_client_link_publication(client, &publication->conductor_fields.managed_resource) < 0)
         {
-            client->publication_links.array[client->publication_links.length++].resource =
-                &publication->conductor_fields.managed_resource;
-
-            publication->conductor_fields.managed_resource.incref(publication->conductor_fields.managed_resource.clientd);
+            return NULL;
         }
+
+        publication->conductor_fields.managed_resource.incref(publication->conductor_fields.managed_resource.clientd);
     }
 
-    return ensure_capacity_result >= 0 ? publication : NULL;
+    return publication;
 }
 
 aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_endpoint(
@@ -758,7 +963,7 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
             return NULL;
         }
 
-        aeron_driver_sender_proxy_add_endpoint(conductor->context->sender_proxy, endpoint);
+        aeron_driver_sender_proxy_add_endpoint(endpoint->sender_proxy, endpoint);
 
         conductor->send_channel_endpoints.array[conductor->send_channel_endpoints.length++].endpoint = endpoint;
 
@@ -1203,7 +1408,11 @@ void aeron_driver_conductor_on_close(void *clientd)
 
     for (size_t i = 0, length = conductor->clients.length; i < length; i++)
     {
-        aeron_free(conductor->clients.array[i].publication_links.array);
+        aeron_client_t *client = conductor->clients.array[i].client;
+
+        aeron_int64_to_ptr_hash_map_delete(&client->publication_link_by_registration_id_map);
+        aeron_free(client->publication_links.array);
+        aeron_free(client);
     }
     aeron_free(conductor->clients.array);
 
@@ -1264,6 +1473,10 @@ void aeron_driver_conductor_on_close(void *clientd)
 
     aeron_str_to_ptr_hash_map_delete(&conductor->send_channel_endpoint_by_channel_map);
     aeron_str_to_ptr_hash_map_delete(&conductor->receive_channel_endpoint_by_channel_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->client_by_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->ipc_publication_by_stream_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->network_publication_by_endpoint_stream_id_map);
+    aeron_int64_to_ptr_hash_map_delete(&conductor->subscription_link_by_registration_id_map);
 }
 
 #define AERON_ERROR(c, ecode, desc, format, ...) \
@@ -1537,27 +1750,20 @@ int aeron_driver_conductor_on_remove_publication(
     aeron_driver_conductor_t *conductor,
     aeron_remove_command_t *command)
 {
-    int index;
+    aeron_client_t *client = aeron_driver_conductor_find_client(conductor, command->correlated.client_id);
+    aeron_publication_link_t *link = NULL;
 
-    if ((index = aeron_driver_conductor_find_client(conductor, command->correlated.client_id)) >= 0)
+    if (NULL != client &&
+        (link = aeron_int64_to_ptr_hash_map_get(
+            &client->publication_link_by_registration_id_map, command->registration_id)) != NULL)
     {
-        aeron_client_t *client = &conductor->clients.array[index];
+        aeron_driver_managed_resource_t *resource = link->resource;
 
-        for (size_t i = 0, size = client->publication_links.length, last_index = size - 1; i < size; i++)
-        {
-            aeron_driver_managed_resource_t *resource = client->publication_links.array[i].resource;
-
-            if (command->registration_id == resource->registration_id)
-            {
-                resource->decref(resource->clientd);
-
-                aeron_array_fast_unordered_remove(
-                    (uint8_t *)client->publication_links.array, sizeof(aeron_publication_link_t), i, last_index);
+        aeron_client_unlink_publication(client, link);
+        resource->decref(resource->clientd);
 
-                aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-                return 0;
-            }
-        }
+        aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+        return 0;
     }
 
     aeron_set_err(
@@ -1580,10 +1786,18 @@ int aeron_driver_conductor_on_add_ipc_subscription(
         return -1;
     }
 
+    aeron_subscription_link_t *links = conductor->ipc_subscriptions.array;
+
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->ipc_subscriptions, aeron_subscription_link_t);
+    if (ensure_capacity_result >= 0 && links != conductor->ipc_subscriptions.array)
+    {
+        ensure_capacity_result =
+            aeron_driver_conductor_index_subscription_links(conductor, conductor->ipc_subscriptions.array, conductor->ipc_subscriptions.length);
+    }
+
     if (ensure_capacity_result >= 0)
     {
-        aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[conductor->ipc_subscriptions.length++];
+        aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[conductor->ipc_subscriptions.length];
 
         link->endpoint = NULL;
         link->spy_channel = NULL;
@@ -1594,6 +1808,17 @@ int aeron_driver_conductor_on_add_ipc_subscription(
         link->subscribeable_list.capacity = 0;
         link->subscribeable_list.array = NULL;
 
+        if (aeron_int64_to_ptr_hash_map_put(
+            &conductor->subscription_link_by_registration_id_map, link->registration_id, link) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index subscription link: %s", strerror(errcode));
+            return -1;
+        }
+
+        conductor->ipc_subscriptions.length++;
+
         aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
         for (size_t i = 0; i < conductor->ipc_publications.length; i++)
@@ -1651,10 +1876,18 @@ int aeron_driver_conductor_on_add_spy_subscription(
     endpoint = aeron_str_to_ptr_hash_map_get(
             &conductor->send_channel_endpoint_by_channel_map, udp_channel->canonical_form, udp_channel->canonical_length);
 
+    aeron_subscription_link_t *links = conductor->spy_subscriptions.array;
+
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->spy_subscriptions, aeron_subscription_link_t);
+    if (ensure_capacity_result >= 0 && links != conductor->spy_subscriptions.array)
+    {
+        ensure_capacity_result =
+            aeron_driver_conductor_index_subscription_links(conductor, conductor->spy_subscriptions.array, conductor->spy_subscriptions.length);
+    }
+
     if (ensure_capacity_result >= 0)
     {
-        aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[conductor->spy_subscriptions.length++];
+        aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[conductor->spy_subscriptions.length];
 
         link->endpoint = NULL;
         link->spy_channel = udp_channel;
@@ -1665,6 +1898,17 @@ int aeron_driver_conductor_on_add_spy_subscription(
         link->subscribeable_list.capacity = 0;
         link->subscribeable_list.array = NULL;
 
+        if (aeron_int64_to_ptr_hash_map_put(
+            &conductor->subscription_link_by_registration_id_map, link->registration_id, link) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index subscription link: %s", strerror(errcode));
+            return -1;
+        }
+
+        conductor->spy_subscriptions.length++;
+
         aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
         for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
@@ -1735,10 +1979,18 @@ int aeron_driver_conductor_on_add_network_subscription(
         return -1;
     }
 
+    aeron_subscription_link_t *links = conductor->network_subscriptions.array;
+
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->network_subscriptions, aeron_subscription_link_t);
+    if (ensure_capacity_result >= 0 && links != conductor->network_subscriptions.array)
+    {
+        ensure_capacity_result =
+            aeron_driver_conductor_index_subscription_links(conductor, conductor->network_subscriptions.array, conductor->network_subscriptions.length);
+    }
+
     if (ensure_capacity_result >= 0)
     {
-        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[conductor->network_subscriptions.length++];
+        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[conductor->network_subscriptions.length];
 
         link->endpoint = endpoint;
         link->spy_channel = NULL;
@@ -1749,6 +2001,17 @@ int aeron_driver_conductor_on_add_network_subscription(
         link->subscribeable_list.capacity = 0;
         link->subscribeable_list.array = NULL;
 
+        if (aeron_int64_to_ptr_hash_map_put(
+            &conductor->subscription_link_by_registration_id_map, link->registration_id, link) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "could not index subscription link: %s", strerror(errcode));
+            return -1;
+        }
+
+        conductor->network_subscriptions.length++;
+
         aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
 
         for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
@@ -1790,94 +2053,81 @@ int aeron_driver_conductor_on_remove_subscription(
     aeron_driver_conductor_t *conductor,
     aeron_remove_command_t *command)
 {
+    aeron_subscription_link_t *link =
+        aeron_int64_to_ptr_hash_map_get(&conductor->subscription_link_by_registration_id_map, command->registration_id);
 
-    for (size_t i = 0, size = conductor->ipc_subscriptions.length, last_index = size - 1; i < size; i++)
+    if (NULL == link)
     {
-        aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[i];
-
-        if (command->registration_id == link->registration_id)
-        {
-            aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
-
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->ipc_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->ipc_subscriptions.length--;
-
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
-        }
+        aeron_set_err(
+            EINVAL,
+            "unknown subscription client_id=%" PRId64 ", registration_id=%" PRId64,
+            command->correlated.client_id,
+            command->registration_id);
+        return -1;
     }
 
-    for (size_t i = 0, size = conductor->network_subscriptions.length, last_index = size - 1; i < size; i++)
+    if (NULL != link->endpoint)
     {
-        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+        aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
 
-        if (command->registration_id == link->registration_id)
+        link->endpoint = NULL;
+        aeron_receive_channel_endpoint_decref_to_stream(endpoint, link->stream_id);
+        if (AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING == endpoint->conductor_fields.status)
         {
-            aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
-
-            link->endpoint = NULL;
-            aeron_receive_channel_endpoint_decref_to_stream(endpoint, link->stream_id);
-            if (AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSING == endpoint->conductor_fields.status)
-            {
-                aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
+            aeron_udp_channel_t *udp_channel = endpoint->conductor_fields.udp_channel;
 
-                aeron_str_to_ptr_hash_map_remove(
-                    &conductor->receive_channel_endpoint_by_channel_map,
-                    udp_channel->canonical_form,
-                    udp_channel->canonical_length);
-            }
-
-            aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
+            aeron_str_to_ptr_hash_map_remove(
+                &conductor->receive_channel_endpoint_by_channel_map,
+                udp_channel->canonical_form,
+                udp_channel->canonical_length);
+        }
 
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->network_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->network_subscriptions.length--;
+        aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
-        }
+        aeron_driver_conductor_remove_subscription_link(
+            conductor,
+            conductor->network_subscriptions.array,
+            &conductor->network_subscriptions.length,
+            (size_t)(link - conductor->network_subscriptions.array));
     }
-
-    for (size_t i = 0, size = conductor->spy_subscriptions.length, last_index = size - 1; i < size; i++)
+    else if (NULL != link->spy_channel)
     {
-        aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
+        aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-        if (command->registration_id == link->registration_id)
-        {
-            aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
+        aeron_udp_channel_delete(link->spy_channel);
+        link->spy_channel = NULL;
 
-            aeron_udp_channel_delete(link->spy_channel);
-            link->spy_channel = NULL;
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)conductor->spy_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
-            conductor->spy_subscriptions.length--;
+        aeron_driver_conductor_remove_subscription_link(
+            conductor,
+            conductor->spy_subscriptions.array,
+            &conductor->spy_subscriptions.length,
+            (size_t)(link - conductor->spy_subscriptions.array));
+    }
+    else
+    {
+        aeron_driver_conductor_unlink_all_subscribeable(conductor, link);
 
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
-        }
+        aeron_driver_conductor_remove_subscription_link(
+            conductor,
+            conductor->ipc_subscriptions.array,
+            &conductor->ipc_subscriptions.length,
+            (size_t)(link - conductor->ipc_subscriptions.array));
     }
 
-    aeron_set_err(
-        EINVAL,
-        "unknown subscription client_id=%" PRId64 ", registration_id=%" PRId64,
-        command->correlated.client_id,
-        command->registration_id);
-    return -1;
+    aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+    return 0;
 }
 
 int aeron_driver_conductor_on_client_keepalive(
     aeron_driver_conductor_t *conductor,
     int64_t client_id)
 {
-    int index;
+    aeron_client_t *client;
 
     aeron_counter_add_ordered(conductor->client_keep_alives_counter, 1);
 
-    if ((index = aeron_driver_conductor_find_client(conductor, client_id)) >= 0)
+    if ((client = aeron_driver_conductor_find_client(conductor, client_id)) != NULL)
     {
-        aeron_client_t *client = &conductor->clients.array[index];
-
         client->time_of_last_keepalive = conductor->nano_clock();
     }
     return 0;
@@ -1926,6 +2176,9 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
 
     aeron_position_t rcv_hwm_position;
     aeron_position_t rcv_pos_position;
+    aeron_counter_t rcv_rtt_counter;
+    aeron_counter_t rcv_rtt_variance_counter;
+    aeron_counter_t rcv_socket_latency_counter = { .value_addr = NULL, .counter_id = -1 };
 
     rcv_hwm_position.counter_id =
         aeron_counter_receiver_hwm_allocate(
@@ -1933,16 +2186,39 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     rcv_pos_position.counter_id =
         aeron_counter_receiver_position_allocate(
             &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str);
+    rcv_rtt_counter.counter_id =
+        aeron_counter_receiver_rtt_allocate(
+            &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str);
+    rcv_rtt_variance_counter.counter_id =
+        aeron_counter_receiver_rtt_variance_allocate(
+            &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str);
 
-    if (rcv_hwm_position.counter_id < 0 || rcv_pos_position.counter_id < 0)
+    if (rcv_hwm_position.counter_id < 0 || rcv_pos_position.counter_id < 0 ||
+        rcv_rtt_counter.counter_id < 0 || rcv_rtt_variance_counter.counter_id < 0)
     {
         return;
     }
 
+    if (endpoint->transport.timestamps_enabled)
+    {
+        if ((rcv_socket_latency_counter.counter_id = aeron_counter_receiver_socket_latency_allocate(
+            &conductor->counters_manager, registration_id, command->session_id, command->stream_id, channel_str)) < 0)
+        {
+            return;
+        }
+
+        rcv_socket_latency_counter.value_addr =
+            aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_socket_latency_counter.counter_id);
+    }
+
     rcv_hwm_position.value_addr =
         aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_hwm_position.counter_id);
     rcv_pos_position.value_addr =
         aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_pos_position.counter_id);
+    rcv_rtt_counter.value_addr =
+        aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_rtt_counter.counter_id);
+    rcv_rtt_variance_counter.value_addr =
+        aeron_counter_addr(&conductor->counters_manager, (int32_t)rcv_rtt_variance_counter.counter_id);
 
     aeron_publication_image_t *image = NULL;
     if (aeron_publication_image_create(
@@ -1957,6 +2233,9 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         command->term_offset,
         &rcv_hwm_position,
         &rcv_pos_position,
+        &rcv_rtt_counter,
+        &rcv_rtt_variance_counter,
+        &rcv_socket_latency_counter,
         congestion_control,
         &command->control_address,
         &command->src_address,
@@ -2000,15 +2279,15 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         }
     }
 
-    aeron_driver_receiver_proxy_on_add_publication_image(conductor->context->receiver_proxy, endpoint, image);
+    aeron_driver_receiver_proxy_on_add_publication_image(endpoint->receiver_proxy, endpoint, image);
 
-    aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(conductor->context->receiver_proxy, item);
+    aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(endpoint->receiver_proxy, item);
 }
 
 extern bool aeron_driver_conductor_is_subscribeable_linked(
     aeron_subscription_link_t *link, aeron_subscribeable_t *subscribeable);
 extern bool aeron_driver_conductor_has_network_subscription_interest(
-    aeron_driver_conductor_t *conductor, const aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
+    aeron_driver_conductor_t *conductor, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id);
 extern size_t aeron_driver_conductor_num_clients(aeron_driver_conductor_t *conductor);
 extern size_t aeron_driver_conductor_num_ipc_publications(aeron_driver_conductor_t *conductor);
 extern size_t aeron_driver_conductor_num_ipc_subscriptions(aeron_driver_conductor_t *conductor);
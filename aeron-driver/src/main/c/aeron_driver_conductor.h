@@ -27,6 +27,7 @@
 #include "aeron_system_counters.h"
 #include "aeron_ipc_publication.h"
 #include "collections/aeron_str_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_conductor_proxy.h"
@@ -38,6 +39,7 @@
 typedef struct aeron_publication_link_stct
 {
     aeron_driver_managed_resource_t *resource;
+    int32_t refcnt;
 }
 aeron_publication_link_t;
 
@@ -55,9 +57,17 @@ typedef struct aeron_client_stct
         size_t capacity;
     }
     publication_links;
+
+    aeron_int64_to_ptr_hash_map_t publication_link_by_registration_id_map;
 }
 aeron_client_t;
 
+typedef struct aeron_client_entry_stct
+{
+    aeron_client_t *client;
+}
+aeron_client_entry_t;
+
 typedef struct aeron_subscribeable_list_entry_stct
 {
     aeron_subscribeable_t *subscribeable;
@@ -128,15 +138,19 @@ typedef struct aeron_driver_conductor_stct
 
     aeron_str_to_ptr_hash_map_t send_channel_endpoint_by_channel_map;
     aeron_str_to_ptr_hash_map_t receive_channel_endpoint_by_channel_map;
+    aeron_int64_to_ptr_hash_map_t client_by_id_map;
+    aeron_int64_to_ptr_hash_map_t ipc_publication_by_stream_id_map;
+    aeron_int64_to_ptr_hash_map_t network_publication_by_endpoint_stream_id_map;
+    aeron_int64_to_ptr_hash_map_t subscription_link_by_registration_id_map;
 
     struct client_stct
     {
-        aeron_client_t *array;
+        aeron_client_entry_t *array;
         size_t length;
         size_t capacity;
-        void (*on_time_event)(aeron_driver_conductor_t *, aeron_client_t *, int64_t, int64_t);
-        bool (*has_reached_end_of_life)(aeron_driver_conductor_t *, aeron_client_t *);
-        void (*delete_func)(aeron_driver_conductor_t *, aeron_client_t *);
+        void (*on_time_event)(aeron_driver_conductor_t *, aeron_client_entry_t *, int64_t, int64_t);
+        bool (*has_reached_end_of_life)(aeron_driver_conductor_t *, aeron_client_entry_t *);
+        void (*delete_func)(aeron_driver_conductor_t *, aeron_client_entry_t *);
     }
     clients;
 
@@ -232,10 +246,10 @@ aeron_driver_conductor_t;
 
 #define AERON_FORMAT_BUFFER(buffer, format, ...) snprintf(buffer, sizeof(buffer) - 1, format, __VA_ARGS__)
 
-void aeron_client_on_time_event(
-    aeron_driver_conductor_t *conductor, aeron_client_t *client, int64_t now_ns, int64_t now_ms);
-bool aeron_client_has_reached_end_of_life(aeron_driver_conductor_t *conductor, aeron_client_t *client);
-void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *);
+void aeron_client_entry_on_time_event(
+    aeron_driver_conductor_t *conductor, aeron_client_entry_t *entry, int64_t now_ns, int64_t now_ms);
+bool aeron_client_entry_has_reached_end_of_life(aeron_driver_conductor_t *conductor, aeron_client_entry_t *entry);
+void aeron_client_entry_delete(aeron_driver_conductor_t *conductor, aeron_client_entry_t *);
 
 void aeron_ipc_publication_entry_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_ipc_publication_entry_t *entry, int64_t now_ns, int64_t now_ms);
@@ -372,19 +386,10 @@ inline bool aeron_driver_conductor_is_subscribeable_linked(
 }
 
 inline bool aeron_driver_conductor_has_network_subscription_interest(
-    aeron_driver_conductor_t *conductor, const aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
+    aeron_driver_conductor_t *conductor, aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
-    for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
-    {
-        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
-
-        if (endpoint == link->endpoint && stream_id == link->stream_id)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    /* every network subscription link holds a reference to its stream on the endpoint */
+    return NULL != aeron_int64_to_ptr_hash_map_get(&endpoint->stream_id_to_refcnt_map, stream_id);
 }
 
 inline size_t aeron_driver_conductor_num_clients(aeron_driver_conductor_t *conductor)
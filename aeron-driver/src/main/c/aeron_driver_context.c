@@ -108,6 +108,13 @@ bool aeron_config_parse_bool(const char *str, bool def)
     return def;
 }
 
+static const char *aeron_config_get_str(const char *env_var, const char *def)
+{
+    const char *value = getenv(env_var);
+
+    return NULL != value ? value : def;
+}
+
 uint64_t aeron_config_parse_uint64(const char *str, uint64_t def, uint64_t min, uint64_t max)
 {
     uint64_t result = def;
@@ -129,6 +136,31 @@ uint64_t aeron_config_parse_uint64(const char *str, uint64_t def, uint64_t min,
     return result;
 }
 
+static int32_t aeron_config_parse_numa_node(const char *str, int32_t def)
+{
+    if (NULL == str)
+    {
+        return def;
+    }
+
+    if (strcmp(str, "-1") == 0)
+    {
+        return AERON_NUMA_NODE_NONE;
+    }
+
+    char *end = NULL;
+    errno = 0;
+    unsigned long long value = strtoull(str, &end, 10);
+
+    /* only a whole decimal node within range, anything else keeps the default rather than pinning to node 0 */
+    if (end == str || '\0' != *end || 0 != errno || '-' == str[0] || value >= AERON_NUMA_MAX_NODES)
+    {
+        return def;
+    }
+
+    return (int32_t)value;
+}
+
 static void aeron_driver_conductor_to_driver_interceptor_null(
     int32_t msg_type_id, const void *message, size_t length, void *clientd)
 {
@@ -161,6 +193,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->conductor_proxy = NULL;
     _context->sender_proxy = NULL;
     _context->receiver_proxy = NULL;
+    _context->log_buffer_pool = NULL;
+
+    for (size_t i = 0; i < AERON_DRIVER_MAX_SHARDS; i++)
+    {
+        _context->sender_shard_proxies[i] = NULL;
+        _context->receiver_shard_proxies[i] = NULL;
+    }
 
     if (aeron_alloc((void **)&_context->aeron_dir, AERON_MAX_PATH) < 0)
     {
@@ -230,8 +269,23 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->send_to_sm_poll_ratio = 4;
     _context->status_message_timeout_ns = 200 * 1000 * 1000L;
     _context->image_liveness_timeout_ns = 10 * 1000 * 1000 * 1000L;
+    _context->rtt_measurement_interval_ns = 0;
+    _context->min_flow_control_receiver_timeout_ns = 2 * 1000 * 1000 * 1000L;
     _context->initial_window_length = 128 * 1024;
     _context->loss_report_length = 1024 * 1024;
+    _context->retransmit_budget_length = 64 * 1024;
+    _context->log_buffer_pool_size = 0;
+    _context->file_page_size = AERON_PAGE_MIN_SIZE;
+    _context->term_buffer_numa_node = AERON_NUMA_NODE_NONE;
+    _context->ipc_term_buffer_numa_node = AERON_NUMA_NODE_NONE;
+    _context->receiver_shard_count = 1;
+    _context->sender_shard_count = 1;
+    _context->cubic_congestion_control_initial_rtt_ns = 100 * 1000L;
+    _context->cubic_congestion_control_measure_rtt = true;
+    _context->cubic_congestion_control_tcp_mode = false;
+    _context->udp_transport_io_uring = false;
+    _context->udp_gso = false;
+    _context->receiver_timestamps = false;
 
     /* set from env */
     char *value = NULL;
@@ -412,6 +466,20 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1000,
             INT64_MAX);
 
+    _context->rtt_measurement_interval_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_RCV_RTT_MEASUREMENT_INTERVAL_ENV_VAR),
+            _context->rtt_measurement_interval_ns,
+            0,
+            INT64_MAX);
+
+    _context->min_flow_control_receiver_timeout_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_MIN_MULTICAST_FLOWCONTROL_RECEIVER_TIMEOUT_ENV_VAR),
+            _context->min_flow_control_receiver_timeout_ns,
+            1000,
+            INT64_MAX);
+
     _context->initial_window_length =
         aeron_config_parse_uint64(
             getenv(AERON_RCV_INITIAL_WINDOW_LENGTH_ENV_VAR),
@@ -426,6 +494,91 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
             1024,
             INT32_MAX);
 
+    _context->retransmit_budget_length =
+        aeron_config_parse_uint64(
+            getenv(AERON_RETRANSMIT_BUDGET_LENGTH_ENV_VAR),
+            _context->retransmit_budget_length,
+            AERON_DATA_HEADER_LENGTH,
+            INT32_MAX);
+
+    _context->log_buffer_pool_size =
+        aeron_config_parse_uint64(
+            getenv(AERON_LOG_BUFFER_POOL_SIZE_ENV_VAR),
+            _context->log_buffer_pool_size,
+            0,
+            1024);
+
+    _context->file_page_size =
+        aeron_config_parse_uint64(
+            getenv(AERON_FILE_PAGE_SIZE_ENV_VAR),
+            _context->file_page_size,
+            AERON_PAGE_MIN_SIZE,
+            AERON_PAGE_MAX_SIZE);
+
+    if (!AERON_IS_POWER_OF_TWO(_context->file_page_size))
+    {
+        aeron_set_err(
+            EINVAL, "%s must be a power of two: %" PRIu64,
+            AERON_FILE_PAGE_SIZE_ENV_VAR, (uint64_t)_context->file_page_size);
+        return -1;
+    }
+
+    _context->term_buffer_numa_node =
+        aeron_config_parse_numa_node(
+            getenv(AERON_TERM_BUFFER_NUMA_NODE_ENV_VAR),
+            _context->term_buffer_numa_node);
+
+    _context->ipc_term_buffer_numa_node =
+        aeron_config_parse_numa_node(
+            getenv(AERON_IPC_TERM_BUFFER_NUMA_NODE_ENV_VAR),
+            _context->ipc_term_buffer_numa_node);
+
+    _context->receiver_shard_count =
+        aeron_config_parse_uint64(
+            getenv(AERON_RECEIVER_SHARD_COUNT_ENV_VAR),
+            _context->receiver_shard_count,
+            1,
+            AERON_DRIVER_MAX_SHARDS);
+
+    _context->sender_shard_count =
+        aeron_config_parse_uint64(
+            getenv(AERON_SENDER_SHARD_COUNT_ENV_VAR),
+            _context->sender_shard_count,
+            1,
+            AERON_DRIVER_MAX_SHARDS);
+
+    _context->cubic_congestion_control_initial_rtt_ns =
+        aeron_config_parse_uint64(
+            getenv(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR),
+            _context->cubic_congestion_control_initial_rtt_ns,
+            1000,
+            INT64_MAX);
+
+    _context->cubic_congestion_control_measure_rtt =
+        aeron_config_parse_bool(
+            getenv(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR),
+            _context->cubic_congestion_control_measure_rtt);
+
+    _context->cubic_congestion_control_tcp_mode =
+        aeron_config_parse_bool(
+            getenv(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR),
+            _context->cubic_congestion_control_tcp_mode);
+
+    _context->udp_transport_io_uring =
+        aeron_config_parse_bool(
+            getenv(AERON_UDP_TRANSPORT_IO_URING_ENV_VAR),
+            _context->udp_transport_io_uring);
+
+    _context->udp_gso =
+        aeron_config_parse_bool(
+            getenv(AERON_UDP_GSO_ENV_VAR),
+            _context->udp_gso);
+
+    _context->receiver_timestamps =
+        aeron_config_parse_bool(
+            getenv(AERON_RCV_TIMESTAMPS_ENV_VAR),
+            _context->receiver_timestamps);
+
     _context->to_driver_buffer = NULL;
     _context->to_clients_buffer = NULL;
     _context->counters_values_buffer = NULL;
@@ -434,17 +587,58 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 
     _context->nano_clock = aeron_nanoclock;
     _context->epoch_clock = aeron_epochclock;
+    _context->epoch_nano_clock = aeron_epochnanoclock;
+
+    if ((_context->conductor_idle_strategy_func = aeron_idle_strategy_load(
+        aeron_config_get_str(AERON_CONDUCTOR_IDLE_STRATEGY_ENV_VAR, "yielding"),
+        &_context->conductor_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
+
+    if ((_context->shared_idle_strategy_func = aeron_idle_strategy_load(
+        aeron_config_get_str(AERON_SHARED_IDLE_STRATEGY_ENV_VAR, "yielding"),
+        &_context->shared_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
+
+    if ((_context->shared_network_idle_strategy_func = aeron_idle_strategy_load(
+        aeron_config_get_str(AERON_SHAREDNETWORK_IDLE_STRATEGY_ENV_VAR, "yielding"),
+        &_context->shared_network_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
+
+    _context->sender_idle_strategy_name = aeron_config_get_str(AERON_SENDER_IDLE_STRATEGY_ENV_VAR, "noop");
+    if ((_context->sender_idle_strategy_func = aeron_idle_strategy_load(
+        _context->sender_idle_strategy_name,
+        &_context->sender_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
+
+    _context->receiver_idle_strategy_name = aeron_config_get_str(AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR, "noop");
+    if ((_context->receiver_idle_strategy_func = aeron_idle_strategy_load(
+        _context->receiver_idle_strategy_name,
+        &_context->receiver_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
+
+    if ((_context->log_buffer_pool_idle_strategy_func = aeron_idle_strategy_load(
+        aeron_config_get_str(AERON_LOG_BUFFER_POOL_IDLE_STRATEGY_ENV_VAR, "backoff"),
+        &_context->log_buffer_pool_idle_strategy_state)) == NULL)
+    {
+        return -1;
+    }
 
-    _context->conductor_idle_strategy_func =
-        aeron_idle_strategy_load("yielding", &_context->conductor_idle_strategy_state);
-    _context->shared_idle_strategy_func =
-        aeron_idle_strategy_load("yielding", &_context->shared_idle_strategy_state);
-    _context->shared_network_idle_strategy_func =
-        aeron_idle_strategy_load("yielding", &_context->shared_network_idle_strategy_state);
-    _context->sender_idle_strategy_func =
-        aeron_idle_strategy_load("noop", &_context->sender_idle_strategy_state);
-    _context->receiver_idle_strategy_func =
-        aeron_idle_strategy_load("noop", &_context->receiver_idle_strategy_state);
+    _context->conductor_cpu_affinity = aeron_config_get_str(AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR, NULL);
+    _context->sender_cpu_affinity = aeron_config_get_str(AERON_SENDER_CPU_AFFINITY_ENV_VAR, NULL);
+    _context->receiver_cpu_affinity = aeron_config_get_str(AERON_RECEIVER_CPU_AFFINITY_ENV_VAR, NULL);
+    _context->shared_cpu_affinity = aeron_config_get_str(AERON_SHARED_CPU_AFFINITY_ENV_VAR, NULL);
+    _context->shared_network_cpu_affinity = aeron_config_get_str(AERON_SHAREDNETWORK_CPU_AFFINITY_ENV_VAR, NULL);
+    _context->log_buffer_pool_cpu_affinity = aeron_config_get_str(AERON_LOG_BUFFER_POOL_CPU_AFFINITY_ENV_VAR, NULL);
 
     _context->usable_fs_space_func = aeron_usable_fs_space;
     _context->map_raw_log_func = aeron_map_raw_log;
@@ -488,6 +682,10 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
     aeron_free((void *)context->aeron_dir);
     aeron_free(context->conductor_idle_strategy_state);
     aeron_free(context->shared_idle_strategy_state);
+    aeron_free(context->shared_network_idle_strategy_state);
+    aeron_free(context->sender_idle_strategy_state);
+    aeron_free(context->receiver_idle_strategy_state);
+    aeron_free(context->log_buffer_pool_idle_strategy_state);
     aeron_free(context);
     return 0;
 }
@@ -55,11 +55,14 @@ typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 typedef struct aeron_driver_conductor_proxy_stct aeron_driver_conductor_proxy_t;
 typedef struct aeron_driver_sender_proxy_stct aeron_driver_sender_proxy_t;
 typedef struct aeron_driver_receiver_proxy_stct aeron_driver_receiver_proxy_t;
+typedef struct aeron_log_buffer_pool_stct aeron_log_buffer_pool_t;
 
 typedef aeron_rb_handler_t aeron_driver_conductor_to_driver_interceptor_func_t;
 typedef void (*aeron_driver_conductor_to_client_interceptor_func_t)
     (aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *message, size_t length);
 
+#define AERON_DRIVER_MAX_SHARDS (8)
+
 typedef enum aeron_threading_mode_enum
 {
     AERON_THREADING_MODE_DEDICATED,
@@ -76,11 +79,19 @@ typedef struct aeron_driver_context_stct
     bool dirs_delete_on_start;              /* aeron.dir.delete.on.start = false */
     bool warn_if_dirs_exist;
     bool term_buffer_sparse_file;           /* aeron.term.buffer.sparse.file = false */
+    bool udp_transport_io_uring;            /* aeron.udp.transport.io_uring = false */
+    bool udp_gso;                           /* aeron.udp.gso = false, per channel with gso=true|false */
+    bool receiver_timestamps;               /* aeron.rcv.timestamps = false */
     uint64_t driver_timeout_ms;
     uint64_t client_liveness_timeout_ns;    /* aeron.client.liveness.timeout = 5s */
     uint64_t publication_linger_timeout_ns; /* aeron.publication.linger.timeout = 5s */
     uint64_t status_message_timeout_ns;     /* aeron.rcv.status.message.timeout = 200ms */
     uint64_t image_liveness_timeout_ns;     /* aeron.image.liveness.timeout = 10s */
+    uint64_t rtt_measurement_interval_ns;   /* aeron.rcv.rtt.measurement.interval = 0 (off) for the static window */
+    uint64_t min_flow_control_receiver_timeout_ns; /* aeron.MinMulticastFlowControl.receiverTimeout = 2s */
+    uint64_t cubic_congestion_control_initial_rtt_ns; /* aeron.CubicCongestionControl.initialRtt = 100us */
+    bool cubic_congestion_control_measure_rtt;        /* aeron.CubicCongestionControl.measureRtt = true */
+    bool cubic_congestion_control_tcp_mode;           /* aeron.CubicCongestionControl.tcpMode = false */
     size_t to_driver_buffer_length;         /* aeron.conductor.buffer.length = 1MB + trailer*/
     size_t to_clients_buffer_length;        /* aeron.clients.buffer.length = 1MB + trailer */
     size_t counters_values_buffer_length;   /* aeron.counters.buffer.length = 1MB */
@@ -96,6 +107,13 @@ typedef struct aeron_driver_context_stct
     size_t send_to_sm_poll_ratio;           /* aeron.send.to.status.poll.ratio = 4 */
     size_t initial_window_length;           /* aeron.rcv.initial.window.length = 128KB */
     size_t loss_report_length;              /* aeron.loss.report.buffer.length = 1MB */
+    size_t retransmit_budget_length;        /* aeron.retransmit.budget.length = 64KB */
+    size_t log_buffer_pool_size;            /* aeron.log.buffer.pool.size = 0, per term length */
+    size_t file_page_size;                  /* aeron.file.page.size = 4KB, raised to the hugetlbfs page size */
+    int32_t term_buffer_numa_node;          /* aeron.term.buffer.numa.node = -1 for no preference */
+    int32_t ipc_term_buffer_numa_node;      /* aeron.ipc.term.buffer.numa.node = -1 for no preference */
+    size_t receiver_shard_count;            /* aeron.receiver.shard.count = 1, DEDICATED threading mode only */
+    size_t sender_shard_count;              /* aeron.sender.shard.count = 1, DEDICATED threading mode only */
     uint8_t multicast_ttl;                  /* aeron.socket.multicast.ttl = 0 */
 
     aeron_mapped_file_t cnc_map;
@@ -109,21 +127,33 @@ typedef struct aeron_driver_context_stct
 
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
+    aeron_clock_func_t epoch_nano_clock;
 
     aeron_spsc_concurrent_array_queue_t sender_command_queue;
     aeron_spsc_concurrent_array_queue_t receiver_command_queue;
     aeron_mpsc_concurrent_array_queue_t conductor_command_queue;
 
-    aeron_idle_strategy_func_t conductor_idle_strategy_func;
+    aeron_idle_strategy_func_t conductor_idle_strategy_func;      /* aeron.conductor.idle.strategy = yielding */
     void *conductor_idle_strategy_state;
-    aeron_idle_strategy_func_t shared_idle_strategy_func;
+    aeron_idle_strategy_func_t shared_idle_strategy_func;         /* aeron.shared.idle.strategy = yielding */
     void *shared_idle_strategy_state;
-    aeron_idle_strategy_func_t shared_network_idle_strategy_func;
+    aeron_idle_strategy_func_t shared_network_idle_strategy_func; /* aeron.sharednetwork.idle.strategy = yielding */
     void *shared_network_idle_strategy_state;
-    aeron_idle_strategy_func_t sender_idle_strategy_func;
+    aeron_idle_strategy_func_t sender_idle_strategy_func;         /* aeron.sender.idle.strategy = noop */
     void *sender_idle_strategy_state;
-    aeron_idle_strategy_func_t receiver_idle_strategy_func;
+    const char *sender_idle_strategy_name;
+    aeron_idle_strategy_func_t receiver_idle_strategy_func;       /* aeron.receiver.idle.strategy = noop */
     void *receiver_idle_strategy_state;
+    const char *receiver_idle_strategy_name;
+    aeron_idle_strategy_func_t log_buffer_pool_idle_strategy_func; /* aeron.log.buffer.pool.idle.strategy = backoff */
+    void *log_buffer_pool_idle_strategy_state;
+
+    const char *conductor_cpu_affinity;       /* aeron.conductor.cpu.affinity = unpinned, a list such as 2 or 0,4-7 */
+    const char *sender_cpu_affinity;          /* aeron.sender.cpu.affinity = unpinned, a list per shard split by / */
+    const char *receiver_cpu_affinity;        /* aeron.receiver.cpu.affinity = unpinned, a list per shard split by / */
+    const char *shared_cpu_affinity;          /* aeron.shared.cpu.affinity = unpinned */
+    const char *shared_network_cpu_affinity;  /* aeron.sharednetwork.cpu.affinity = unpinned */
+    const char *log_buffer_pool_cpu_affinity; /* aeron.log.buffer.pool.cpu.affinity = unpinned */
 
     aeron_usable_fs_space_func_t usable_fs_space_func;
     aeron_map_raw_log_func_t map_raw_log_func;
@@ -136,7 +166,10 @@ typedef struct aeron_driver_context_stct
 
     aeron_driver_conductor_proxy_t *conductor_proxy;
     aeron_driver_sender_proxy_t *sender_proxy;
+    aeron_driver_sender_proxy_t *sender_shard_proxies[AERON_DRIVER_MAX_SHARDS];
     aeron_driver_receiver_proxy_t *receiver_proxy;
+    aeron_driver_receiver_proxy_t *receiver_shard_proxies[AERON_DRIVER_MAX_SHARDS];
+    aeron_log_buffer_pool_t *log_buffer_pool;
 
     aeron_driver_conductor_to_driver_interceptor_func_t to_driver_interceptor_func;
     aeron_driver_conductor_to_client_interceptor_func_t to_client_interceptor_func;
@@ -147,6 +180,9 @@ aeron_driver_context_t;
 
 void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context);
 
+bool aeron_config_parse_bool(const char *str, bool def);
+uint64_t aeron_config_parse_uint64(const char *str, uint64_t def, uint64_t min, uint64_t max);
+
 inline uint8_t *aeron_cnc_to_driver_buffer(aeron_cnc_metadata_t *metadata)
 {
     return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH;
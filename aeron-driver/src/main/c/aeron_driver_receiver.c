@@ -39,7 +39,7 @@ int aeron_driver_receiver_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&receiver->poller) < 0)
+    if (aeron_udp_transport_poller_init(&receiver->poller, context->udp_transport_io_uring) < 0)
     {
         return -1;
     }
@@ -66,6 +66,7 @@ int aeron_driver_receiver_init(
 
     receiver->context = context;
     receiver->error_log = error_log;
+    receiver->shard_idle_strategy_state = NULL;
 
     receiver->receiver_proxy.command_queue = &context->receiver_command_queue;
     receiver->receiver_proxy.fail_counter =
@@ -80,6 +81,27 @@ int aeron_driver_receiver_init(
     return 0;
 }
 
+int aeron_driver_receiver_shard_init(
+    aeron_driver_receiver_t *receiver,
+    aeron_driver_context_t *context,
+    aeron_system_counters_t *system_counters,
+    aeron_distinct_error_log_t *error_log)
+{
+    if (aeron_driver_receiver_init(receiver, context, system_counters, error_log) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_spsc_concurrent_array_queue_init(&receiver->shard_command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    receiver->receiver_proxy.command_queue = &receiver->shard_command_queue;
+
+    return 0;
+}
+
 void aeron_driver_receiver_on_command(void *clientd, volatile void *item)
 {
     aeron_command_base_t *cmd = (aeron_command_base_t *)item;
@@ -103,6 +125,8 @@ int aeron_driver_receiver_do_work(void *clientd)
         mmsghdr[i].msg_hdr.msg_namelen = sizeof(receiver->recv_buffers.addrs[i]);
         mmsghdr[i].msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
         mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        mmsghdr[i].msg_hdr.msg_control = receiver->recv_buffers.controls[i].buffer;
+        mmsghdr[i].msg_hdr.msg_controllen = sizeof(receiver->recv_buffers.controls[i]);
         mmsghdr[i].msg_hdr.msg_flags = 0;
         mmsghdr[i].msg_len = 0;
     }
@@ -121,6 +145,8 @@ int aeron_driver_receiver_do_work(void *clientd)
 
     work_count += (poll_result < 0) ? 0 : poll_result;
 
+    const int64_t now_ns = receiver->context->nano_clock();
+
     for (size_t i = 0, length = receiver->images.length; i < length; i++)
     {
         aeron_publication_image_t *image = receiver->images.array[i].image;
@@ -136,12 +162,18 @@ int aeron_driver_receiver_do_work(void *clientd)
         int send_nak_result = aeron_publicaion_image_send_pending_loss(image);
         if (send_nak_result < 0)
         {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send SM: %s", aeron_errmsg());
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send NAK: %s", aeron_errmsg());
         }
 
-        /* TODO: initiate RTTM */
-
         work_count += (send_nak_result < 0) ? 0 : send_nak_result;
+
+        int initiate_rttm_result = aeron_publication_image_initiate_rttm(image, now_ns);
+        if (initiate_rttm_result < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send RTTM: %s", aeron_errmsg());
+        }
+
+        work_count += (initiate_rttm_result < 0) ? 0 : initiate_rttm_result;
     }
 
     /* TODO: check pending status messages */
@@ -163,6 +195,12 @@ void aeron_driver_receiver_on_close(void *clientd)
     aeron_free(receiver->images.array);
 
     aeron_udp_transport_poller_close(&receiver->poller);
+
+    if (&receiver->shard_command_queue == receiver->receiver_proxy.command_queue)
+    {
+        aeron_spsc_concurrent_array_queue_close(&receiver->shard_command_queue);
+        aeron_free(receiver->shard_idle_strategy_state);
+    }
 }
 
 void aeron_driver_receiver_on_add_endpoint(void *clientd, void *command)
@@ -37,11 +37,16 @@ typedef struct aeron_driver_receiver_stct
     aeron_driver_receiver_proxy_t receiver_proxy;
     aeron_udp_transport_poller_t poller;
 
+    /* used instead of the context queue by shards after the first, along with their own idle strategy state */
+    aeron_spsc_concurrent_array_queue_t shard_command_queue;
+    void *shard_idle_strategy_state;
+
     struct aeron_driver_receiver_buffers_stct
     {
         uint8_t *buffers[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
         struct iovec iov[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
         struct sockaddr_storage addrs[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
+        aeron_udp_channel_transport_control_t controls[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
     }
     recv_buffers;
 
@@ -79,6 +84,16 @@ int aeron_driver_receiver_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log);
 
+/*
+ * Init a receiver shard beyond the first. It polls only the endpoints assigned to it and takes commands for them
+ * from its own queue.
+ */
+int aeron_driver_receiver_shard_init(
+    aeron_driver_receiver_t *receiver,
+    aeron_driver_context_t *context,
+    aeron_system_counters_t *system_counters,
+    aeron_distinct_error_log_t *error_log);
+
 int aeron_driver_receiver_do_work(void *clientd);
 void aeron_driver_receiver_on_close(void *clientd);
 
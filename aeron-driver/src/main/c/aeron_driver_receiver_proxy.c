@@ -29,6 +29,19 @@ void aeron_driver_receiver_proxy_offer(aeron_driver_receiver_proxy_t *receiver_p
     }
 }
 
+aeron_driver_receiver_proxy_t *aeron_driver_receiver_proxy_for_channel(
+    aeron_driver_context_t *context, aeron_udp_channel_t *channel)
+{
+    if (context->receiver_shard_count <= 1)
+    {
+        return context->receiver_proxy;
+    }
+
+    int shard_index = aeron_udp_channel_shard_index(channel, context->receiver_shard_count);
+
+    return shard_index < 0 ? NULL : context->receiver_shard_proxies[shard_index];
+}
+
 void aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t *cmd)
 {
@@ -18,6 +18,7 @@
 #define AERON_AERON_DRIVER_RECEIVER_PROXY_H
 
 #include "aeron_driver_context.h"
+#include "media/aeron_udp_channel.h"
 
 typedef struct aeron_driver_receiver_stct aeron_driver_receiver_t;
 typedef struct aeron_receive_channel_endpoint_stct aeron_receive_channel_endpoint_t;
@@ -32,6 +33,12 @@ typedef struct aeron_driver_receiver_proxy_stct
 }
 aeron_driver_receiver_proxy_t;
 
+/*
+ * Proxy of the receiver shard that owns endpoints of the channel, or NULL if the channel names a shard not in range.
+ */
+aeron_driver_receiver_proxy_t *aeron_driver_receiver_proxy_for_channel(
+    aeron_driver_context_t *context, aeron_udp_channel_t *channel);
+
 void aeron_driver_receiver_proxy_on_delete_create_publication_image_cmd(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t *cmd);
 
@@ -40,7 +40,7 @@ int aeron_driver_sender_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log)
 {
-    if (aeron_udp_transport_poller_init(&sender->poller) < 0)
+    if (aeron_udp_transport_poller_init(&sender->poller, context->udp_transport_io_uring) < 0)
     {
         return -1;
     }
@@ -63,6 +63,7 @@ int aeron_driver_sender_init(
 
     sender->context = context;
     sender->error_log = error_log;
+    sender->shard_idle_strategy_state = NULL;
     sender->sender_proxy.sender = sender;
     sender->sender_proxy.command_queue = &context->sender_command_queue;
     sender->sender_proxy.fail_counter =
@@ -87,6 +88,27 @@ int aeron_driver_sender_init(
     return 0;
 }
 
+int aeron_driver_sender_shard_init(
+    aeron_driver_sender_t *sender,
+    aeron_driver_context_t *context,
+    aeron_system_counters_t *system_counters,
+    aeron_distinct_error_log_t *error_log)
+{
+    if (aeron_driver_sender_init(sender, context, system_counters, error_log) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_spsc_concurrent_array_queue_init(&sender->shard_command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    sender->sender_proxy.command_queue = &sender->shard_command_queue;
+
+    return 0;
+}
+
 void aeron_driver_sender_on_command(void *clientd, volatile void *item)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
@@ -159,6 +181,12 @@ void aeron_driver_sender_on_close(void *clientd)
 
     aeron_udp_transport_poller_close(&sender->poller);
     aeron_free(sender->network_publicaitons.array);
+
+    if (&sender->shard_command_queue == sender->sender_proxy.command_queue)
+    {
+        aeron_spsc_concurrent_array_queue_close(&sender->shard_command_queue);
+        aeron_free(sender->shard_idle_strategy_state);
+    }
 }
 
 void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
@@ -276,7 +304,18 @@ int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
         }
     }
 
-    aeron_counter_add_ordered(sender->total_bytes_sent_counter, bytes_sent);
+    /* the counter has a single writer unless the senders are sharded */
+    if (sender->context->sender_shard_count > 1)
+    {
+        if (bytes_sent > 0)
+        {
+            aeron_counter_increment(sender->total_bytes_sent_counter, bytes_sent);
+        }
+    }
+    else
+    {
+        aeron_counter_add_ordered(sender->total_bytes_sent_counter, bytes_sent);
+    }
 
     return bytes_sent;
 }
@@ -37,6 +37,10 @@ typedef struct aeron_driver_sender_stct
     aeron_driver_sender_proxy_t sender_proxy;
     aeron_udp_transport_poller_t poller;
 
+    /* used instead of the context queue by shards after the first, along with their own idle strategy state */
+    aeron_spsc_concurrent_array_queue_t shard_command_queue;
+    void *shard_idle_strategy_state;
+
     struct aeron_driver_sender_network_publications_stct
     {
         aeron_driver_sender_network_publication_entry_t *array;
@@ -85,6 +89,16 @@ int aeron_driver_sender_init(
     aeron_system_counters_t *system_counters,
     aeron_distinct_error_log_t *error_log);
 
+/*
+ * Init a sender shard beyond the first. It sends for and polls control messages of only the endpoints assigned to
+ * it, and takes commands for them from its own queue.
+ */
+int aeron_driver_sender_shard_init(
+    aeron_driver_sender_t *sender,
+    aeron_driver_context_t *context,
+    aeron_system_counters_t *system_counters,
+    aeron_distinct_error_log_t *error_log);
+
 int aeron_driver_sender_do_work(void *clientd);
 void aeron_driver_sender_on_close(void *clientd);
 
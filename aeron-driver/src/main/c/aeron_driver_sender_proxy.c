@@ -27,6 +27,19 @@ void aeron_driver_sender_proxy_offer(aeron_driver_sender_proxy_t *sender_proxy,
     }
 }
 
+aeron_driver_sender_proxy_t *aeron_driver_sender_proxy_for_channel(
+    aeron_driver_context_t *context, aeron_udp_channel_t *channel)
+{
+    if (context->sender_shard_count <= 1)
+    {
+        return context->sender_proxy;
+    }
+
+    int shard_index = aeron_udp_channel_shard_index(channel, context->sender_shard_count);
+
+    return shard_index < 0 ? NULL : context->sender_shard_proxies[shard_index];
+}
+
 void aeron_driver_sender_proxy_add_endpoint(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint)
 {
@@ -31,6 +31,12 @@ typedef struct aeron_driver_sender_proxy_stct
 }
 aeron_driver_sender_proxy_t;
 
+/*
+ * Proxy of the sender shard that owns endpoints of the channel, or NULL if the channel names a shard not in range.
+ */
+aeron_driver_sender_proxy_t *aeron_driver_sender_proxy_for_channel(
+    aeron_driver_context_t *context, aeron_udp_channel_t *channel);
+
 void aeron_driver_sender_proxy_add_endpoint(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint);
 
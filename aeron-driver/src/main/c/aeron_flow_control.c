@@ -23,8 +23,10 @@
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
 #include "aeron_flow_control.h"
 #include "aeron_alloc.h"
+#include "aeron_driver_context.h"
 
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_load(const char *strategy_name)
 {
@@ -81,7 +83,8 @@ int aeron_unicast_flow_control_strategy_supplier(
     int32_t stream_id,
     int64_t registration_id,
     int32_t initial_term_id,
-    size_t term_buffer_capacity)
+    size_t term_buffer_capacity,
+    aeron_driver_context_t *context)
 {
     aeron_flow_control_strategy_t *_strategy;
 
@@ -105,7 +108,8 @@ int aeron_max_multicast_flow_control_strategy_supplier(
     int32_t stream_id,
     int64_t registration_id,
     int32_t initial_term_id,
-    size_t term_buffer_capacity)
+    size_t term_buffer_capacity,
+    aeron_driver_context_t *context)
 {
     aeron_flow_control_strategy_t *_strategy;
 
@@ -122,3 +126,169 @@ int aeron_max_multicast_flow_control_strategy_supplier(
     *strategy = _strategy;
     return 0;
 }
+
+typedef struct aeron_min_flow_control_strategy_receiver_stct
+{
+    int64_t last_position;
+    int64_t last_position_plus_window;
+    int64_t time_of_last_status_message_ns;
+    int64_t receiver_id;
+}
+aeron_min_flow_control_strategy_receiver_t;
+
+/*
+ * Paces the sender to the slowest receiver that has sent a status message within the receiver timeout.
+ * Receivers are tracked by receiver_id and dropped from the set once they time out.
+ */
+typedef struct aeron_min_flow_control_strategy_state_stct
+{
+    struct aeron_min_flow_control_strategy_receivers_stct
+    {
+        aeron_min_flow_control_strategy_receiver_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    receivers;
+
+    int64_t receiver_timeout_ns;
+}
+aeron_min_flow_control_strategy_state_t;
+
+int64_t aeron_min_flow_control_strategy_on_idle(
+    void *state,
+    int64_t now_ns,
+    int64_t snd_lmt)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
+    aeron_min_flow_control_strategy_receiver_t *receivers = strategy_state->receivers.array;
+    int64_t min_position = INT64_MAX;
+
+    for (int last_index = (int)strategy_state->receivers.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_min_flow_control_strategy_receiver_t *receiver = &receivers[i];
+
+        if ((receiver->time_of_last_status_message_ns + strategy_state->receiver_timeout_ns) - now_ns < 0)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)receivers, sizeof(aeron_min_flow_control_strategy_receiver_t), (size_t)i, (size_t)last_index);
+            last_index--;
+            strategy_state->receivers.length--;
+        }
+        else
+        {
+            min_position = receiver->last_position_plus_window < min_position ?
+                receiver->last_position_plus_window : min_position;
+        }
+    }
+
+    return strategy_state->receivers.length > 0 ? min_position : snd_lmt;
+}
+
+int64_t aeron_min_flow_control_strategy_on_sm(
+    void *state,
+    const uint8_t *sm,
+    size_t length,
+    struct sockaddr_storage *recv_addr,
+    int64_t snd_lmt,
+    int32_t initial_term_id,
+    size_t position_bits_to_shift,
+    int64_t now_ns)
+{
+    aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)sm;
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
+
+    const int64_t position = aeron_logbuffer_compute_position(
+        status_message_header->consumption_term_id,
+        status_message_header->consumption_term_offset,
+        position_bits_to_shift,
+        initial_term_id);
+    const int64_t window_length = status_message_header->receiver_window;
+    const int64_t receiver_id = status_message_header->receiver_id;
+    bool is_existing = false;
+    int64_t min_position = INT64_MAX;
+
+    for (size_t i = 0; i < strategy_state->receivers.length; i++)
+    {
+        aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+
+        if (receiver_id == receiver->receiver_id)
+        {
+            receiver->last_position = position > receiver->last_position ? position : receiver->last_position;
+            receiver->last_position_plus_window = position + window_length;
+            receiver->time_of_last_status_message_ns = now_ns;
+            is_existing = true;
+        }
+
+        min_position = receiver->last_position_plus_window < min_position ?
+            receiver->last_position_plus_window : min_position;
+    }
+
+    if (!is_existing)
+    {
+        int ensure_capacity_result = 0;
+        AERON_ARRAY_ENSURE_CAPACITY(
+            ensure_capacity_result, strategy_state->receivers, aeron_min_flow_control_strategy_receiver_t);
+
+        if (ensure_capacity_result >= 0)
+        {
+            aeron_min_flow_control_strategy_receiver_t *receiver =
+                &strategy_state->receivers.array[strategy_state->receivers.length++];
+
+            receiver->last_position = position;
+            receiver->last_position_plus_window = position + window_length;
+            receiver->time_of_last_status_message_ns = now_ns;
+            receiver->receiver_id = receiver_id;
+        }
+
+        min_position = (position + window_length) < min_position ? (position + window_length) : min_position;
+    }
+
+    return snd_lmt > min_position ? snd_lmt : min_position;
+}
+
+int aeron_min_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
+{
+    aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)strategy->state;
+
+    aeron_free(strategy_state->receivers.array);
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+    return 0;
+}
+
+int aeron_min_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity,
+    aeron_driver_context_t *context)
+{
+    aeron_flow_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_flow_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_strategy->state, sizeof(aeron_min_flow_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->on_idle = aeron_min_flow_control_strategy_on_idle;
+    _strategy->on_status_message = aeron_min_flow_control_strategy_on_sm;
+    _strategy->fini = aeron_min_flow_control_strategy_fini;
+
+    aeron_min_flow_control_strategy_state_t *state = (aeron_min_flow_control_strategy_state_t *)_strategy->state;
+
+    state->receivers.array = NULL;
+    state->receivers.length = 0;
+    state->receivers.capacity = 0;
+    state->receiver_timeout_ns = (int64_t)context->min_flow_control_receiver_timeout_ns;
+
+    *strategy = _strategy;
+    return 0;
+}
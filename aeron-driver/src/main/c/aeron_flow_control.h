@@ -21,6 +21,7 @@
 #include "aeron_driver_common.h"
 
 typedef struct aeron_flow_control_strategy_stct aeron_flow_control_strategy_t;
+typedef struct aeron_driver_context_stct aeron_driver_context_t;
 
 typedef int64_t (*aeron_flow_control_strategy_on_idle_func_t)(
     void *state,
@@ -55,8 +56,18 @@ typedef int (*aeron_flow_control_strategy_supplier_func_t)(
     int32_t stream_id,
     int64_t registration_id,
     int32_t initial_term_id,
-    size_t term_buffer_capacity);
+    size_t term_buffer_capacity,
+    aeron_driver_context_t *context);
 
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_load(const char *strategy_name);
 
+int aeron_min_multicast_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity,
+    aeron_driver_context_t *context);
+
 #endif //AERON_AERON_FLOW_CONTROL_H
@@ -0,0 +1,247 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sched.h>
+#include <time.h>
+#include "aeron_idle_strategy.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "aeron_position.h"
+#include "util/aeron_error.h"
+
+void aeron_idle_strategy_backoff_state_init(
+    aeron_idle_strategy_backoff_state_t *state,
+    uint64_t max_spins,
+    uint64_t max_yields,
+    uint64_t min_park_period_ns,
+    uint64_t max_park_period_ns,
+    uint64_t spin_limit)
+{
+    state->max_spins = max_spins;
+    state->max_yields = max_yields;
+    state->min_park_period_ns = min_park_period_ns;
+    state->max_park_period_ns = max_park_period_ns < min_park_period_ns ? min_park_period_ns : max_park_period_ns;
+    state->spin_limit = spin_limit < max_spins ? max_spins : spin_limit;
+    state->spins = 0;
+    state->yields = 0;
+    state->park_period_ns = min_park_period_ns;
+    state->phase_start_ns = 0;
+    state->phase = AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE;
+
+    for (int phase = AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE; phase <= AERON_IDLE_STRATEGY_BACKOFF_PARKING; phase++)
+    {
+        state->local_phase_time_ns[phase] = 0;
+        state->phase_time_ns[phase] = &state->local_phase_time_ns[phase];
+    }
+}
+
+inline static void aeron_idle_strategy_backoff_end_phase(aeron_idle_strategy_backoff_state_t *state, int64_t now_ns)
+{
+    aeron_counter_add_ordered(state->phase_time_ns[state->phase], now_ns - state->phase_start_ns);
+    state->phase_start_ns = now_ns;
+}
+
+inline static int aeron_idle_strategy_backoff_reset(aeron_idle_strategy_backoff_state_t *state)
+{
+    int phase = state->phase;
+
+    if (AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE != phase)
+    {
+        aeron_idle_strategy_backoff_end_phase(state, aeron_nanoclock());
+        state->phase = AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE;
+    }
+
+    return phase;
+}
+
+void aeron_idle_strategy_backoff_idle(void *state, int work_count)
+{
+    aeron_idle_strategy_backoff_state_t *backoff = (aeron_idle_strategy_backoff_state_t *)state;
+
+    if (work_count > 0)
+    {
+        aeron_idle_strategy_backoff_reset(backoff);
+        return;
+    }
+
+    switch (backoff->phase)
+    {
+        case AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE:
+            backoff->phase = AERON_IDLE_STRATEGY_BACKOFF_SPINNING;
+            backoff->phase_start_ns = aeron_nanoclock();
+            backoff->spins = 0;
+            /* fall through */
+
+        case AERON_IDLE_STRATEGY_BACKOFF_SPINNING:
+            if (backoff->spins++ < backoff->max_spins)
+            {
+                __asm__ volatile("pause\n": : :"memory");
+                break;
+            }
+
+            aeron_idle_strategy_backoff_end_phase(backoff, aeron_nanoclock());
+            backoff->phase = AERON_IDLE_STRATEGY_BACKOFF_YIELDING;
+            backoff->yields = 0;
+            /* fall through */
+
+        case AERON_IDLE_STRATEGY_BACKOFF_YIELDING:
+            if (backoff->yields++ < backoff->max_yields)
+            {
+                sched_yield();
+                break;
+            }
+
+            aeron_idle_strategy_backoff_end_phase(backoff, aeron_nanoclock());
+            backoff->phase = AERON_IDLE_STRATEGY_BACKOFF_PARKING;
+            backoff->park_period_ns = backoff->min_park_period_ns;
+            /* fall through */
+
+        default:
+        {
+            struct timespec ts =
+                {
+                    .tv_sec = (time_t)(backoff->park_period_ns / 1000000000),
+                    .tv_nsec = (long)(backoff->park_period_ns % 1000000000)
+                };
+
+            nanosleep(&ts, NULL);
+            backoff->park_period_ns = (backoff->park_period_ns << 1) < backoff->max_park_period_ns ?
+                (backoff->park_period_ns << 1) : backoff->max_park_period_ns;
+            break;
+        }
+    }
+}
+
+void aeron_idle_strategy_adaptive_idle(void *state, int work_count)
+{
+    aeron_idle_strategy_backoff_state_t *backoff = (aeron_idle_strategy_backoff_state_t *)state;
+
+    if (work_count > 0)
+    {
+        switch (aeron_idle_strategy_backoff_reset(backoff))
+        {
+            case AERON_IDLE_STRATEGY_BACKOFF_YIELDING:
+                /* work arrived soon after spinning stopped so a longer spin would have caught it */
+                backoff->max_spins = (backoff->max_spins << 1) < backoff->spin_limit ?
+                    (backoff->max_spins << 1) : backoff->spin_limit;
+                backoff->max_spins = backoff->max_spins < 1 ? 1 : backoff->max_spins;
+                break;
+
+            case AERON_IDLE_STRATEGY_BACKOFF_PARKING:
+                /* gaps between work are long enough that spinning only burns the core */
+                backoff->max_spins = (backoff->max_spins >> 1) > 1 ? (backoff->max_spins >> 1) : 1;
+                break;
+
+            default:
+                break;
+        }
+
+        return;
+    }
+
+    aeron_idle_strategy_backoff_idle(state, work_count);
+}
+
+int aeron_idle_strategy_backoff_init(void **state)
+{
+    aeron_idle_strategy_backoff_state_t *backoff = NULL;
+
+    if (aeron_alloc((void **)&backoff, sizeof(aeron_idle_strategy_backoff_state_t)) < 0)
+    {
+        return -1;
+    }
+
+    aeron_idle_strategy_backoff_state_init(
+        backoff,
+        aeron_config_parse_uint64(
+            getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR),
+            AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_DEFAULT,
+            0,
+            INT32_MAX),
+        aeron_config_parse_uint64(
+            getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR),
+            AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_DEFAULT,
+            0,
+            INT32_MAX),
+        aeron_config_parse_uint64(
+            getenv(AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR),
+            AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_NS_DEFAULT,
+            1,
+            INT64_MAX),
+        aeron_config_parse_uint64(
+            getenv(AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR),
+            AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_NS_DEFAULT,
+            1,
+            INT64_MAX),
+        aeron_config_parse_uint64(
+            getenv(AERON_IDLE_STRATEGY_ADAPTIVE_SPIN_LIMIT_ENV_VAR),
+            AERON_IDLE_STRATEGY_ADAPTIVE_SPIN_LIMIT_DEFAULT,
+            1,
+            INT32_MAX));
+
+    *state = backoff;
+    return 0;
+}
+
+int aeron_idle_strategy_counters_allocate(
+    aeron_idle_strategy_func_t idle_strategy,
+    void *idle_strategy_state,
+    aeron_counters_manager_t *counters_manager,
+    const char *role_name)
+{
+    static const char *phase_names[] =
+        {
+            NULL,
+            AERON_COUNTER_AGENT_IDLE_SPIN_TIME_NAME,
+            AERON_COUNTER_AGENT_IDLE_YIELD_TIME_NAME,
+            AERON_COUNTER_AGENT_IDLE_PARK_TIME_NAME
+        };
+
+    if (NULL == counters_manager || NULL == role_name)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_idle_strategy_counters_allocate: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    /* only the backoff strategies measure the time spent in each phase */
+    if (aeron_idle_strategy_backoff_idle != idle_strategy && aeron_idle_strategy_adaptive_idle != idle_strategy)
+    {
+        return 0;
+    }
+
+    aeron_idle_strategy_backoff_state_t *backoff = (aeron_idle_strategy_backoff_state_t *)idle_strategy_state;
+
+    for (int phase = AERON_IDLE_STRATEGY_BACKOFF_SPINNING; phase <= AERON_IDLE_STRATEGY_BACKOFF_PARKING; phase++)
+    {
+        int32_t counter_id = aeron_counter_agent_idle_time_allocate(
+            counters_manager, phase_names[phase], phase, role_name);
+
+        if (counter_id < 0)
+        {
+            return -1;
+        }
+
+        backoff->phase_time_ns[phase] = aeron_counter_addr(counters_manager, counter_id);
+    }
+
+    return 0;
+}
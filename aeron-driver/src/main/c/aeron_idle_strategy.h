@@ -0,0 +1,82 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_IDLE_STRATEGY_H
+#define AERON_AERON_IDLE_STRATEGY_H
+
+#include <stdint.h>
+#include "aeron_driver_common.h"
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS"
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS"
+#define AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD"
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_ENV_VAR "AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD"
+#define AERON_IDLE_STRATEGY_ADAPTIVE_SPIN_LIMIT_ENV_VAR "AERON_IDLE_STRATEGY_ADAPTIVE_SPIN_LIMIT"
+
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_SPINS_DEFAULT (10)
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_YIELDS_DEFAULT (5)
+#define AERON_IDLE_STRATEGY_BACKOFF_MIN_PARK_PERIOD_NS_DEFAULT (1000)
+#define AERON_IDLE_STRATEGY_BACKOFF_MAX_PARK_PERIOD_NS_DEFAULT (1000 * 1000)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_SPIN_LIMIT_DEFAULT (10 * 1000)
+
+#define AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE 0
+#define AERON_IDLE_STRATEGY_BACKOFF_SPINNING 1
+#define AERON_IDLE_STRATEGY_BACKOFF_YIELDING 2
+#define AERON_IDLE_STRATEGY_BACKOFF_PARKING 3
+
+/*
+ * State for the backoff strategy which spins, then yields, then parks with an exponentially growing period.
+ * Time spent in each phase is measured only on phase transitions and accumulated into phase_time_ns, which points
+ * at fields of the state until counters are allocated for the agent. The adaptive variant moves max_spins between
+ * 1 and spin_limit depending on which phase work arrived in.
+ */
+typedef struct aeron_idle_strategy_backoff_state_stct
+{
+    uint64_t max_spins;
+    uint64_t max_yields;
+    uint64_t min_park_period_ns;
+    uint64_t max_park_period_ns;
+    uint64_t spin_limit;
+    uint64_t spins;
+    uint64_t yields;
+    uint64_t park_period_ns;
+    int64_t phase_start_ns;
+    int64_t *phase_time_ns[AERON_IDLE_STRATEGY_BACKOFF_PARKING + 1];
+    int64_t local_phase_time_ns[AERON_IDLE_STRATEGY_BACKOFF_PARKING + 1];
+    int phase;
+}
+aeron_idle_strategy_backoff_state_t;
+
+void aeron_idle_strategy_backoff_state_init(
+    aeron_idle_strategy_backoff_state_t *state,
+    uint64_t max_spins,
+    uint64_t max_yields,
+    uint64_t min_park_period_ns,
+    uint64_t max_park_period_ns,
+    uint64_t spin_limit);
+
+int aeron_idle_strategy_backoff_init(void **state);
+void aeron_idle_strategy_backoff_idle(void *state, int work_count);
+void aeron_idle_strategy_adaptive_idle(void *state, int work_count);
+
+int aeron_idle_strategy_counters_allocate(
+    aeron_idle_strategy_func_t idle_strategy,
+    void *idle_strategy_state,
+    aeron_counters_manager_t *counters_manager,
+    const char *role_name);
+
+#endif //AERON_AERON_IDLE_STRATEGY_H
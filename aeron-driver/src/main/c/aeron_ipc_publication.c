@@ -22,6 +22,7 @@
 #include "aeron_alloc.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_log_buffer_pool.h"
 #include "util/aeron_error.h"
 
 int aeron_ipc_publication_create(
@@ -41,7 +42,8 @@ int aeron_ipc_publication_create(
         aeron_ipc_publication_location(path, sizeof(path), context->aeron_dir, session_id, stream_id, registration_id);
     aeron_ipc_publication_t *_pub = NULL;
     const uint64_t usable_fs_space = context->usable_fs_space_func(context->aeron_dir);
-    const uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_buffer_length);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(
+        (uint64_t)term_buffer_length, context->file_page_size);
 
     *publication = NULL;
 
@@ -65,7 +67,8 @@ int aeron_ipc_publication_create(
         return -1;
     }
 
-    if (context->map_raw_log_func(&_pub->mapped_raw_log, path, context->term_buffer_sparse_file, term_buffer_length) < 0)
+    if (aeron_log_buffer_pool_map_raw_log(
+        context, &_pub->mapped_raw_log, path, term_buffer_length, context->ipc_term_buffer_numa_node) < 0)
     {
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
@@ -82,6 +85,8 @@ int aeron_ipc_publication_create(
     _pub->log_meta_data->term_tail_counters[0] = (int64_t)initial_term_id << 32;
     _pub->log_meta_data->initialTerm_id = initial_term_id;
     _pub->log_meta_data->mtu_length = (int32_t)mtu_length;
+    _pub->log_meta_data->term_length = (int32_t)term_buffer_length;
+    _pub->log_meta_data->page_size = (int32_t)context->file_page_size;
     _pub->log_meta_data->correlation_id = registration_id;
     _pub->log_meta_data->time_of_last_status_message = 0;
     _pub->log_meta_data->end_of_stream_position = INT64_MAX;
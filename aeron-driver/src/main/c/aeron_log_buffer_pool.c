@@ -0,0 +1,214 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/stat.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include "aeron_log_buffer_pool.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+int aeron_log_buffer_pool_init(aeron_log_buffer_pool_t *pool, aeron_driver_context_t *context)
+{
+    char buffer[AERON_MAX_PATH];
+
+    pool->aeron_dir = context->aeron_dir;
+    pool->map_raw_log_func = context->map_raw_log_func;
+    pool->map_raw_log_close_func = context->map_raw_log_close_func;
+    pool->usable_fs_space_func = context->usable_fs_space_func;
+    pool->pool_size = context->log_buffer_pool_size;
+    pool->page_size = context->file_page_size;
+    pool->next_file_id = 0;
+    pool->use_sparse_files = context->term_buffer_sparse_file;
+
+    for (size_t i = 0; i < AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS; i++)
+    {
+        pool->partitions[i].term_length = 0;
+        pool->partitions[i].numa_node = AERON_NUMA_NODE_NONE;
+
+        if (aeron_spsc_concurrent_array_queue_init(&pool->partitions[i].available_queue, pool->pool_size) < 0)
+        {
+            return -1;
+        }
+    }
+
+    pool->partitions[0].term_length = context->term_buffer_length;
+    pool->partitions[0].numa_node = context->term_buffer_numa_node;
+    if (context->ipc_term_buffer_length != context->term_buffer_length ||
+        context->ipc_term_buffer_numa_node != context->term_buffer_numa_node)
+    {
+        pool->partitions[1].term_length = context->ipc_term_buffer_length;
+        pool->partitions[1].numa_node = context->ipc_term_buffer_numa_node;
+    }
+
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", pool->aeron_dir, AERON_LOG_BUFFER_POOL_DIR);
+    if (mkdir(buffer, S_IRWXU) != 0 && EEXIST != errno)
+    {
+        int errcode = errno;
+        aeron_set_err(errcode, "mkdir %s: %s", buffer, strerror(errcode));
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_log_buffer_pool_entry_delete(aeron_log_buffer_pool_t *pool, aeron_log_buffer_pool_entry_t *entry)
+{
+    pool->map_raw_log_close_func(&entry->mapped_raw_log);
+    unlink(entry->path);
+    aeron_free(entry);
+}
+
+static int aeron_log_buffer_pool_add(
+    aeron_log_buffer_pool_t *pool, aeron_log_buffer_pool_partition_t *partition, uint64_t term_length, int32_t numa_node)
+{
+    aeron_log_buffer_pool_entry_t *entry = NULL;
+
+    if (pool->usable_fs_space_func(pool->aeron_dir) <
+        aeron_logbuffer_compute_log_length(term_length, pool->page_size))
+    {
+        return 0;
+    }
+
+    if (aeron_alloc((void **)&entry, sizeof(aeron_log_buffer_pool_entry_t)) < 0)
+    {
+        return -1;
+    }
+
+    snprintf(
+        entry->path, sizeof(entry->path) - 1,
+        "%s/" AERON_LOG_BUFFER_POOL_DIR "/%" PRIx64 "-%" PRIx64 ".logbuffer",
+        pool->aeron_dir, term_length, pool->next_file_id++);
+
+    if (pool->map_raw_log_func(
+        &entry->mapped_raw_log, entry->path, pool->use_sparse_files, term_length, pool->page_size, numa_node) < 0)
+    {
+        aeron_free(entry);
+        return -1;
+    }
+
+    if (aeron_spsc_concurrent_array_queue_offer(&partition->available_queue, entry) != AERON_OFFER_SUCCESS)
+    {
+        aeron_log_buffer_pool_entry_delete(pool, entry);
+        return 0;
+    }
+
+    return 1;
+}
+
+int aeron_log_buffer_pool_do_work(void *clientd)
+{
+    aeron_log_buffer_pool_t *pool = (aeron_log_buffer_pool_t *)clientd;
+    int work_count = 0;
+
+    for (size_t i = 0; i < AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS; i++)
+    {
+        aeron_log_buffer_pool_partition_t *partition = &pool->partitions[i];
+        uint64_t term_length;
+
+        /* numa_node is written before term_length is published */
+        AERON_GET_VOLATILE(term_length, partition->term_length);
+
+        /* one file per partition per duty cycle so a newly registered term length does not wait on the others */
+        if (0 != term_length &&
+            aeron_spsc_concurrent_array_queue_size(&partition->available_queue) < pool->pool_size)
+        {
+            int result = aeron_log_buffer_pool_add(pool, partition, term_length, partition->numa_node);
+            work_count += result > 0 ? result : 0;
+        }
+    }
+
+    return work_count;
+}
+
+static void aeron_log_buffer_pool_delete_available_entry(void *clientd, volatile void *item)
+{
+    aeron_log_buffer_pool_entry_delete((aeron_log_buffer_pool_t *)clientd, (aeron_log_buffer_pool_entry_t *)item);
+}
+
+void aeron_log_buffer_pool_on_close(void *clientd)
+{
+    aeron_log_buffer_pool_t *pool = (aeron_log_buffer_pool_t *)clientd;
+
+    for (size_t i = 0; i < AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS; i++)
+    {
+        aeron_spsc_concurrent_array_queue_drain_all(
+            &pool->partitions[i].available_queue, aeron_log_buffer_pool_delete_available_entry, pool);
+        aeron_spsc_concurrent_array_queue_close(&pool->partitions[i].available_queue);
+    }
+}
+
+static void aeron_log_buffer_pool_take_entry(void *clientd, volatile void *item)
+{
+    *(aeron_log_buffer_pool_entry_t **)clientd = (aeron_log_buffer_pool_entry_t *)item;
+}
+
+static aeron_log_buffer_pool_entry_t *aeron_log_buffer_pool_take(
+    aeron_log_buffer_pool_t *pool, uint64_t term_length, int32_t numa_node)
+{
+    aeron_log_buffer_pool_entry_t *entry = NULL;
+
+    for (size_t i = 0; i < AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS; i++)
+    {
+        aeron_log_buffer_pool_partition_t *partition = &pool->partitions[i];
+
+        if (term_length == partition->term_length && numa_node == partition->numa_node)
+        {
+            aeron_spsc_concurrent_array_queue_drain(
+                &partition->available_queue, aeron_log_buffer_pool_take_entry, &entry, 1);
+            return entry;
+        }
+
+        if (0 == partition->term_length)
+        {
+            partition->numa_node = numa_node;
+            AERON_PUT_ORDERED(partition->term_length, term_length);
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+int aeron_log_buffer_pool_map_raw_log(
+    aeron_driver_context_t *context,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    int32_t numa_node)
+{
+    aeron_log_buffer_pool_t *pool = context->log_buffer_pool;
+    aeron_log_buffer_pool_entry_t *entry = NULL;
+
+    if (NULL != pool && NULL != (entry = aeron_log_buffer_pool_take(pool, term_length, numa_node)))
+    {
+        /* the mapping survives the rename so the pre-faulted pages come with it */
+        if (rename(entry->path, path) == 0)
+        {
+            memcpy(mapped_raw_log, &entry->mapped_raw_log, sizeof(aeron_mapped_raw_log_t));
+            aeron_free(entry);
+            return 0;
+        }
+
+        aeron_log_buffer_pool_entry_delete(pool, entry);
+    }
+
+    return context->map_raw_log_func(
+        mapped_raw_log, path, context->term_buffer_sparse_file, term_length, context->file_page_size, numa_node);
+}
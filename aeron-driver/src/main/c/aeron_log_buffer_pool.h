@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_LOG_BUFFER_POOL_H
+#define AERON_AERON_LOG_BUFFER_POOL_H
+
+#include "aeron_driver_context.h"
+
+#define AERON_LOG_BUFFER_POOL_DIR "pool"
+#define AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS (8)
+
+typedef struct aeron_log_buffer_pool_entry_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char path[AERON_MAX_PATH];
+}
+aeron_log_buffer_pool_entry_t;
+
+/*
+ * Pre-mapped and, unless sparse files are used, pre-faulted log files of a single term length and NUMA node. Files
+ * are created by the pool agent and taken by the conductor, so term_length and numa_node are written only by the
+ * conductor and the queue is single producer, single consumer. A term_length of 0 marks an unused partition.
+ */
+typedef struct aeron_log_buffer_pool_partition_stct
+{
+    aeron_spsc_concurrent_array_queue_t available_queue;
+    uint64_t term_length;
+    int32_t numa_node;
+}
+aeron_log_buffer_pool_partition_t;
+
+typedef struct aeron_log_buffer_pool_stct
+{
+    aeron_log_buffer_pool_partition_t partitions[AERON_LOG_BUFFER_POOL_MAX_TERM_LENGTHS];
+    const char *aeron_dir;
+    aeron_map_raw_log_func_t map_raw_log_func;
+    aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_usable_fs_space_func_t usable_fs_space_func;
+    size_t pool_size;
+    uint64_t page_size;
+    int64_t next_file_id;
+    bool use_sparse_files;
+}
+aeron_log_buffer_pool_t;
+
+int aeron_log_buffer_pool_init(aeron_log_buffer_pool_t *pool, aeron_driver_context_t *context);
+
+int aeron_log_buffer_pool_do_work(void *clientd);
+void aeron_log_buffer_pool_on_close(void *clientd);
+
+/*
+ * Map the raw log at path using a file from the pool when one of the right term length and NUMA node is available,
+ * otherwise fall back to creating it with the map_raw_log_func of the context. A miss on a term length and node the
+ * pool does not yet hold registers them so the pool agent starts filling it.
+ */
+int aeron_log_buffer_pool_map_raw_log(
+    aeron_driver_context_t *context,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    int32_t numa_node);
+
+#endif //AERON_AERON_LOG_BUFFER_POOL_H
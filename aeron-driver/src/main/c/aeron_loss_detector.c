@@ -19,6 +19,7 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 #include "aeron_loss_detector.h"
 #include "aeronmd.h"
 
@@ -32,14 +33,35 @@ int aeron_loss_detector_init(
     detector->delay_generator = delay_generator;
     detector->on_gap_detected = on_gap_detected;
     detector->on_gap_detected_clientd = on_gap_detected_clientd;
-    detector->expiry = AERON_LOSS_DETECTOR_TIMER_INACTIVE;
-    detector->active_gap.term_offset = -1;
-    detector->scanned_gap.term_offset = -1;
+    detector->scanned_gap_count = 0;
+    detector->active_gap_count = 0;
     detector->should_feedback_immediately = should_immediate_feedback;
 
     return 0;
 }
 
+static void aeron_loss_detector_update_active_gaps(aeron_loss_detector_t *detector, bool *loss_found, int64_t now_ns)
+{
+    for (size_t i = 0, length = detector->scanned_gap_count; i < length; i++)
+    {
+        aeron_loss_detector_gap_t *scanned_gap = &detector->scanned_gaps[i];
+        aeron_loss_detector_gap_t *active_gap = aeron_loss_detector_find_active_gap(detector, scanned_gap);
+
+        if (NULL != active_gap)
+        {
+            scanned_gap->expiry = active_gap->expiry;
+        }
+        else
+        {
+            aeron_loss_detector_activate_gap(detector, scanned_gap, now_ns);
+            *loss_found = true;
+        }
+    }
+
+    memcpy(detector->active_gaps, detector->scanned_gaps, sizeof(aeron_loss_detector_gap_t) * detector->scanned_gap_count);
+    detector->active_gap_count = detector->scanned_gap_count;
+}
+
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
     bool *loss_found,
@@ -54,6 +76,8 @@ int32_t aeron_loss_detector_scan(
     *loss_found = false;
     int32_t rebuild_offset = (int32_t)(rebuild_position & term_length_mask);
 
+    detector->scanned_gap_count = 0;
+
     if (rebuild_position < hwm_position)
     {
         const int32_t rebuild_term_count = (int32_t)(rebuild_position >> position_bits_to_shift);
@@ -71,18 +95,30 @@ int32_t aeron_loss_detector_scan(
                 limit_offset,
                 aeron_loss_detector_on_gap,
                 detector);
-        if (rebuild_offset < limit_offset)
+
+        int32_t scan_offset = rebuild_offset;
+        while (scan_offset < limit_offset && detector->scanned_gap_count < AERON_LOSS_DETECTOR_MAX_GAPS)
         {
-            if (!aeron_loss_detector_gaps_match(detector))
+            aeron_loss_detector_gap_t *last_gap = &detector->scanned_gaps[detector->scanned_gap_count - 1];
+
+            scan_offset = last_gap->term_offset + (int32_t)last_gap->length;
+            if (scan_offset < limit_offset)
             {
-                aeron_loss_detector_activate_gap(detector, now_ns);
-                *loss_found = true;
+                scan_offset =
+                    aeron_term_gap_scanner_scan_for_gap(
+                        buffer,
+                        rebuild_term_id,
+                        scan_offset,
+                        limit_offset,
+                        aeron_loss_detector_on_gap,
+                        detector);
             }
-
-            aeron_loss_detector_check_timer_expiry(detector, now_ns);
         }
     }
 
+    aeron_loss_detector_update_active_gaps(detector, loss_found, now_ns);
+    aeron_loss_detector_check_timer_expiry(detector, now_ns);
+
     return rebuild_offset;
 }
 
@@ -117,6 +153,8 @@ int64_t aeron_loss_detector_nak_multicast_delay_generator()
 
 extern int64_t aeron_loss_detector_nak_unicast_delay_generator();
 extern void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
-extern bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector);
-extern void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns);
+extern aeron_loss_detector_gap_t *aeron_loss_detector_find_active_gap(
+    aeron_loss_detector_t *detector, aeron_loss_detector_gap_t *scanned_gap);
+extern void aeron_loss_detector_activate_gap(
+    aeron_loss_detector_t *detector, aeron_loss_detector_gap_t *gap, int64_t now_ns);
 extern void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns);
@@ -29,19 +29,22 @@ typedef struct aeron_loss_detector_gap_stct
     int32_t term_id;
     int32_t term_offset;
     size_t length;
+    int64_t expiry;
 }
 aeron_loss_detector_gap_t;
 
 #define AERON_LOSS_DETECTOR_TIMER_INACTIVE (-1)
+#define AERON_LOSS_DETECTOR_MAX_GAPS (16)
 
 typedef struct aeron_loss_detector_stct
 {
     aeron_feedback_delay_generator_func_t delay_generator;
     aeron_term_gap_scanner_on_gap_detected_func_t on_gap_detected;
     void *on_gap_detected_clientd;
-    aeron_loss_detector_gap_t scanned_gap;
-    aeron_loss_detector_gap_t active_gap;
-    int64_t expiry;
+    aeron_loss_detector_gap_t scanned_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    aeron_loss_detector_gap_t active_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    size_t scanned_gap_count;
+    size_t active_gap_count;
     bool should_feedback_immediately;
 }
 aeron_loss_detector_t;
@@ -81,43 +84,57 @@ inline void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t t
 {
     aeron_loss_detector_t *detector = (aeron_loss_detector_t *)clientd;
 
-    detector->scanned_gap.term_id = term_id;
-    detector->scanned_gap.term_offset = term_offset;
-    detector->scanned_gap.length = length;
+    if (detector->scanned_gap_count < AERON_LOSS_DETECTOR_MAX_GAPS)
+    {
+        aeron_loss_detector_gap_t *gap = &detector->scanned_gaps[detector->scanned_gap_count++];
+
+        gap->term_id = term_id;
+        gap->term_offset = term_offset;
+        gap->length = length;
+        gap->expiry = AERON_LOSS_DETECTOR_TIMER_INACTIVE;
+    }
 }
 
-inline bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector)
+inline aeron_loss_detector_gap_t *aeron_loss_detector_find_active_gap(
+    aeron_loss_detector_t *detector, aeron_loss_detector_gap_t *scanned_gap)
 {
-    return detector->active_gap.term_id == detector->scanned_gap.term_id &&
-        detector->active_gap.term_offset == detector->scanned_gap.term_offset;
+    for (size_t i = 0, length = detector->active_gap_count; i < length; i++)
+    {
+        aeron_loss_detector_gap_t *active_gap = &detector->active_gaps[i];
+
+        if (active_gap->term_id == scanned_gap->term_id && active_gap->term_offset == scanned_gap->term_offset)
+        {
+            return active_gap;
+        }
+    }
+
+    return NULL;
 }
 
-inline void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns)
+inline void aeron_loss_detector_activate_gap(
+    aeron_loss_detector_t *detector, aeron_loss_detector_gap_t *gap, int64_t now_ns)
 {
-    detector->active_gap.term_id = detector->scanned_gap.term_id;
-    detector->active_gap.term_offset = detector->scanned_gap.term_offset;
-    detector->active_gap.length = detector->scanned_gap.length;
-
     if (detector->should_feedback_immediately)
     {
-        detector->expiry = now_ns;
+        gap->expiry = now_ns;
     }
     else
     {
-        detector->expiry = now_ns + detector->delay_generator();
+        gap->expiry = now_ns + detector->delay_generator();
     }
 }
 
 inline void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns)
 {
-    if (now_ns >= detector->expiry)
+    for (size_t i = 0, length = detector->active_gap_count; i < length; i++)
     {
-        detector->on_gap_detected(
-            detector->on_gap_detected_clientd,
-            detector->active_gap.term_id,
-            detector->active_gap.term_offset,
-            detector->active_gap.length);
-        detector->expiry = now_ns + detector->delay_generator();
+        aeron_loss_detector_gap_t *gap = &detector->active_gaps[i];
+
+        if (now_ns >= gap->expiry)
+        {
+            detector->on_gap_detected(detector->on_gap_detected_clientd, gap->term_id, gap->term_offset, gap->length);
+            gap->expiry = now_ns + detector->delay_generator();
+        }
     }
 }
 
@@ -22,6 +22,7 @@
 #include <errno.h>
 #include <string.h>
 #include <sys/socket.h>
+#include <netinet/udp.h>
 #include "concurrent/aeron_term_scanner.h"
 #include "util/aeron_netutil.h"
 #include "util/aeron_error.h"
@@ -29,6 +30,7 @@
 #include "aeron_alloc.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_log_buffer_pool.h"
 
 #if !defined(HAVE_RECVMMSG)
 struct mmsghdr
@@ -67,7 +69,8 @@ int aeron_network_publication_create(
             registration_id);
     aeron_network_publication_t *_pub = NULL;
     const uint64_t usable_fs_space = context->usable_fs_space_func(context->aeron_dir);
-    const uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_buffer_length);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(
+        (uint64_t)term_buffer_length, context->file_page_size);
     const int64_t now_ns = context->nano_clock();
 
     *publication = NULL;
@@ -95,6 +98,11 @@ int aeron_network_publication_create(
     if (aeron_retransmit_handler_init(
         &_pub->retransmit_handler,
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_MERGED),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_LINGERED),
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_DROPPED),
+        aeron_retransmit_handler_max_retransmit_actions(
+            aeron_network_publication_term_window_length(context, term_buffer_length), mtu_length),
         AERON_RETRANSMIT_HANDLER_DEFAULT_LINGER_TIMEOUT_NS) < 0)
     {
         aeron_free(_pub->log_file_name);
@@ -103,7 +111,8 @@ int aeron_network_publication_create(
         return -1;
     }
 
-    if (context->map_raw_log_func(&_pub->mapped_raw_log, path, context->term_buffer_sparse_file, term_buffer_length) < 0)
+    if (aeron_log_buffer_pool_map_raw_log(
+        context, &_pub->mapped_raw_log, path, term_buffer_length, context->term_buffer_numa_node) < 0)
     {
         aeron_free(_pub->log_file_name);
         aeron_free(_pub);
@@ -120,6 +129,8 @@ int aeron_network_publication_create(
     _pub->log_meta_data->term_tail_counters[0] = (int64_t)initial_term_id << 32;
     _pub->log_meta_data->initialTerm_id = initial_term_id;
     _pub->log_meta_data->mtu_length = (int32_t)mtu_length;
+    _pub->log_meta_data->term_length = (int32_t)term_buffer_length;
+    _pub->log_meta_data->page_size = (int32_t)context->file_page_size;
     _pub->log_meta_data->correlation_id = registration_id;
     _pub->log_meta_data->time_of_last_status_message = 0;
     aeron_logbuffer_fill_default_header(
@@ -154,6 +165,9 @@ int aeron_network_publication_create(
     _pub->term_length_mask = (int32_t)term_buffer_length - 1;
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_buffer_length);
     _pub->mtu_length = mtu_length;
+    _pub->retransmit_budget_length = context->retransmit_budget_length;
+    _pub->retransmit_budget_remaining = context->retransmit_budget_length;
+    _pub->pending_retransmits_length = 0;
     _pub->term_window_length = (int64_t)aeron_network_publication_term_window_length(context, term_buffer_length);
     _pub->linger_timeout_ns = (int64_t)context->publication_linger_timeout_ns;
     _pub->time_of_last_send_or_heartbeat_ns = now_ns - AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS - 1;
@@ -165,11 +179,14 @@ int aeron_network_publication_create(
     _pub->track_sender_limits = true;
     _pub->has_sender_released = false;
 
+    _pub->has_shared_system_counters = context->sender_shard_count > 1;
     _pub->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
     _pub->heartbeats_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_HEARTBEATS_SENT);
     _pub->sender_flow_control_limits_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SENDER_FLOW_CONTROL_LIMITS);
     _pub->retransmits_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_SENT);
+    _pub->retransmits_dropped_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_DROPPED);
 
     *publication = _pub;
     return 0;
@@ -201,6 +218,19 @@ void aeron_network_publication_close(aeron_counters_manager_t *counters_manager,
     aeron_free(publication);
 }
 
+static inline void aeron_network_publication_increment_system_counter(
+    aeron_network_publication_t *publication, int64_t *counter, int64_t value)
+{
+    if (publication->has_shared_system_counters)
+    {
+        aeron_counter_increment(counter, value);
+    }
+    else
+    {
+        aeron_counter_ordered_increment(counter, value);
+    }
+}
+
 int aeron_network_publication_setup_message_check(
     aeron_network_publication_t *publication, int64_t now_ns, int32_t active_term_id, int32_t term_offset)
 {
@@ -300,24 +330,43 @@ int aeron_network_publication_heartbeat_message_check(
             }
         }
 
-        aeron_counter_ordered_increment(publication->heartbeats_sent_counter, 1);
+        aeron_network_publication_increment_system_counter(publication, publication->heartbeats_sent_counter, 1);
         publication->time_of_last_send_or_heartbeat_ns = now_ns;
     }
 
     return bytes_sent;
 }
 
+static size_t aeron_network_publication_max_segments_per_message(aeron_network_publication_t *publication)
+{
+    if (!publication->endpoint->transport.gso_enabled)
+    {
+        return 1;
+    }
+
+    size_t max_segments = AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_LENGTH / publication->mtu_length;
+
+    if (max_segments > AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS)
+    {
+        max_segments = AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS;
+    }
+
+    return max_segments > 0 ? max_segments : 1;
+}
+
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
 {
     const size_t term_length = (size_t)publication->term_length_mask + 1;
+    const size_t max_segments = aeron_network_publication_max_segments_per_message(publication);
     int result = 0, vlen = 0, bytes_sent = 0;
     int32_t available_window = (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
     int64_t highest_pos = snd_pos;
-    struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    size_t iov_count = 0;
+    struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND * AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS];
     struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
 
-    for (size_t i = 0; i < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND && available_window > 0; i++)
+    while (available_window > 0)
     {
         size_t scan_limit =
             (size_t)available_window < publication->mtu_length ? (size_t)available_window : publication->mtu_length;
@@ -331,14 +380,37 @@ int aeron_network_publication_send_data(
 
         if (available > 0)
         {
-            iov[i].iov_base = ptr;
-            iov[i].iov_len = available;
-            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
-            mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_len = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
-            vlen++;
+            /*
+             * With GSO a run of equal length chunks goes out as one message which the kernel segments, only the
+             * last segment of a message may be shorter.
+             */
+            struct msghdr *last = vlen > 0 ? &mmsghdr[vlen - 1].msg_hdr : NULL;
+
+            if (NULL != last &&
+                last->msg_iovlen < max_segments &&
+                iov[iov_count - 1].iov_len == last->msg_iov[0].iov_len &&
+                available <= last->msg_iov[0].iov_len)
+            {
+                last->msg_iovlen++;
+            }
+            else if (vlen < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND)
+            {
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[iov_count];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_len = 0;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                vlen++;
+            }
+            else
+            {
+                break;
+            }
+
+            iov[iov_count].iov_base = ptr;
+            iov[iov_count].iov_len = available;
+            iov_count++;
 
             bytes_sent += available;
             available_window -= available + padding;
@@ -352,6 +424,27 @@ int aeron_network_publication_send_data(
         }
     }
 
+#if defined(HAVE_UDP_GSO)
+    aeron_udp_channel_transport_control_t controls[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+
+    for (int i = 0; i < vlen; i++)
+    {
+        if (mmsghdr[i].msg_hdr.msg_iovlen > 1)
+        {
+            uint16_t segment_length = (uint16_t)mmsghdr[i].msg_hdr.msg_iov[0].iov_len;
+
+            mmsghdr[i].msg_hdr.msg_control = controls[i].buffer;
+            mmsghdr[i].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(segment_length));
+
+            struct cmsghdr *cmsg = CMSG_FIRSTHDR(&mmsghdr[i].msg_hdr);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(segment_length));
+            memcpy(CMSG_DATA(cmsg), &segment_length, sizeof(segment_length));
+        }
+    }
+#endif
+
     if (vlen > 0)
     {
         if ((result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen)) != vlen)
@@ -369,7 +462,8 @@ int aeron_network_publication_send_data(
 
     if (available_window <= 0)
     {
-        aeron_counter_ordered_increment(publication->sender_flow_control_limits_counter, 1);
+        aeron_network_publication_increment_system_counter(
+            publication, publication->sender_flow_control_limits_counter, 1);
         publication->track_sender_limits = false;
     }
 
@@ -384,6 +478,12 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
             snd_pos, publication->position_bits_to_shift, publication->initial_term_id);
     int32_t term_offset = (int32_t)snd_pos & publication->term_length_mask;
 
+    publication->retransmit_budget_remaining = publication->retransmit_budget_length;
+    if (aeron_network_publication_resend_pending(publication) < 0)
+    {
+        return -1;
+    }
+
     if (publication->should_send_setup_frame)
     {
         if (aeron_network_publication_setup_message_check(publication, now_ns, active_term_id, term_offset) < 0)
@@ -417,6 +517,56 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
     return bytes_sent;
 }
 
+static int aeron_network_publication_resend_batch(
+    aeron_network_publication_t *publication, struct mmsghdr *mmsghdr, size_t vlen)
+{
+    int result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, vlen);
+
+    if (result >= 0 && result != (int)vlen)
+    {
+        aeron_counter_increment(publication->short_sends_counter, 1);
+    }
+
+    return result;
+}
+
+static void aeron_network_publication_defer_resend(
+    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, size_t length)
+{
+    const int64_t end_offset = (int64_t)term_offset + (int64_t)length;
+
+    for (size_t i = 0; i < publication->pending_retransmits_length; i++)
+    {
+        aeron_network_publication_pending_retransmit_t *pending = &publication->pending_retransmits[i];
+        const int64_t pending_end_offset = (int64_t)pending->term_offset + (int64_t)pending->length;
+
+        /* an overlapping or adjacent range of the same term is merged so repeated NAKs do not fill the queue */
+        if (pending->term_id == term_id && term_offset <= pending_end_offset && end_offset >= pending->term_offset)
+        {
+            const int32_t merged_offset = term_offset < pending->term_offset ? term_offset : pending->term_offset;
+            const int64_t merged_end_offset = end_offset > pending_end_offset ? end_offset : pending_end_offset;
+
+            pending->term_offset = merged_offset;
+            pending->length = (size_t)(merged_end_offset - merged_offset);
+            return;
+        }
+    }
+
+    if (publication->pending_retransmits_length < AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS)
+    {
+        aeron_network_publication_pending_retransmit_t *pending =
+            &publication->pending_retransmits[publication->pending_retransmits_length++];
+
+        pending->term_id = term_id;
+        pending->term_offset = term_offset;
+        pending->length = length;
+    }
+    else
+    {
+        aeron_counter_increment(publication->retransmits_dropped_counter, 1);
+    }
+}
+
 int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
@@ -429,16 +579,26 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
 
     if (resend_position < sender_position && resend_position >= (sender_position - (int32_t)term_length))
     {
-        const size_t index = aeron_logbuffer_index_by_position(resend_position, publication->position_bits_to_shift);
+        if (0 == publication->retransmit_budget_remaining)
+        {
+            aeron_network_publication_defer_resend(publication, term_id, term_offset, length);
+            return 0;
+        }
 
+        const size_t index = aeron_logbuffer_index_by_position(resend_position, publication->position_bits_to_shift);
+        struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND];
+        struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND];
+        /* where each frame of the batch starts, to rewind to the first one not sent */
+        int32_t frame_offsets[AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND];
+        size_t frame_remaining_bytes[AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND];
+        size_t frame_budgets[AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND];
         size_t remaining_bytes = length;
-        int32_t bytes_sent = 0;
+        size_t vlen = 0;
+        int64_t frames_sent = 0;
         int32_t offset = term_offset;
 
-        do
+        while (remaining_bytes > 0 && publication->retransmit_budget_remaining > 0)
         {
-            offset += bytes_sent;
-
             uint8_t *ptr = publication->mapped_raw_log.term_buffers[index].addr + offset;
             const size_t term_length_left = term_length - (size_t)offset;
             size_t padding = 0;
@@ -447,40 +607,97 @@ int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t ter
                 aeron_term_scanner_scan_for_availability(ptr, term_length_left, publication->mtu_length, &padding);
             if (available <= 0)
             {
-                break;
+                remaining_bytes = 0;
+            }
+            else
+            {
+                const size_t bytes_covered = available + padding;
+                const size_t budget = available < publication->retransmit_budget_remaining ?
+                    available : publication->retransmit_budget_remaining;
+
+                iov[vlen].iov_base = ptr;
+                iov[vlen].iov_len = available;
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                mmsghdr[vlen].msg_len = 0;
+                frame_offsets[vlen] = offset;
+                frame_remaining_bytes[vlen] = remaining_bytes;
+                frame_budgets[vlen] = budget;
+                vlen++;
+
+                offset += (int32_t)bytes_covered;
+                remaining_bytes = bytes_covered < remaining_bytes ? remaining_bytes - bytes_covered : 0;
+                publication->retransmit_budget_remaining -= budget;
             }
 
-            struct iovec iov[1];
-            struct msghdr msghdr;
+            if (vlen > 0 &&
+                (AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND == vlen ||
+                0 == remaining_bytes ||
+                0 == publication->retransmit_budget_remaining))
+            {
+                result = aeron_network_publication_resend_batch(publication, mmsghdr, vlen);
+                const size_t sent = result > 0 ? (size_t)result : 0;
 
-            iov[0].iov_base = ptr;
-            iov[0].iov_len = available;
-            msghdr.msg_iov = iov;
-            msghdr.msg_iovlen = 1;
-            msghdr.msg_control = NULL;
-            msghdr.msg_flags = 0;
+                frames_sent += (int64_t)sent;
 
-            int sendmsg_result;
-            if ((sendmsg_result = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)iov[0].iov_len)
-            {
-                if (sendmsg_result >= 0)
+                if (sent < vlen)
                 {
-                    aeron_counter_increment(publication->short_sends_counter, 1);
-                    break;
-                }
-                else
-                {
-                    result = -1;
+                    /* the frames not sent are deferred along with the rest of the range */
+                    offset = frame_offsets[sent];
+                    remaining_bytes = frame_remaining_bytes[sent];
+
+                    for (size_t i = sent; i < vlen; i++)
+                    {
+                        publication->retransmit_budget_remaining += frame_budgets[i];
+                    }
+
+                    vlen = 0;
                     break;
                 }
+
+                vlen = 0;
             }
+        }
 
-            bytes_sent = (int32_t)(available + padding);
-            remaining_bytes -= bytes_sent;
+        if (remaining_bytes > 0)
+        {
+            aeron_network_publication_defer_resend(publication, term_id, offset, remaining_bytes);
+        }
+
+        if (frames_sent > 0)
+        {
+            aeron_network_publication_increment_system_counter(
+                publication, publication->retransmits_sent_counter, frames_sent);
         }
-        while (remaining_bytes > 0);
 
-        aeron_counter_ordered_increment(publication->retransmits_sent_counter, 1);
+        result = result < 0 ? result : 0;
+    }
+
+    return result;
+}
+
+int aeron_network_publication_resend_pending(aeron_network_publication_t *publication)
+{
+    aeron_network_publication_pending_retransmit_t pending[AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS];
+    const size_t length = publication->pending_retransmits_length;
+    int result = 0;
+
+    if (length > 0)
+    {
+        memcpy(pending, publication->pending_retransmits, sizeof(pending[0]) * length);
+        publication->pending_retransmits_length = 0;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            if (aeron_network_publication_resend(
+                publication, pending[i].term_id, pending[i].term_offset, pending[i].length) < 0)
+            {
+                result = -1;
+            }
+        }
     }
 
     return result;
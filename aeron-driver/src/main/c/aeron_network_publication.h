@@ -39,6 +39,16 @@ aeron_network_publication_status_t;
 #define AERON_NETWORK_PUBLICATION_CONNECTION_TIMEOUT_MS (5 * 1000L)
 
 #define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND (2)
+#define AERON_NETWORK_PUBLICATION_MAX_RETRANSMIT_MESSAGES_PER_SEND (16)
+#define AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS (16)
+
+typedef struct aeron_network_publication_pending_retransmit_stct
+{
+    int32_t term_id;
+    int32_t term_offset;
+    size_t length;
+}
+aeron_network_publication_pending_retransmit_t;
 
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
@@ -85,6 +95,10 @@ typedef struct aeron_network_publication_stct
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     size_t mtu_length;
+    size_t retransmit_budget_length;
+    size_t retransmit_budget_remaining;
+    size_t pending_retransmits_length;
+    aeron_network_publication_pending_retransmit_t pending_retransmits[AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS];
     bool is_exclusive;
     bool should_send_setup_frame;
     bool is_connected;
@@ -93,10 +107,13 @@ typedef struct aeron_network_publication_stct
     bool has_sender_released;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
 
+    /* system counters have more than one writer when the sender is sharded */
+    bool has_shared_system_counters;
     int64_t *short_sends_counter;
     int64_t *heartbeats_sent_counter;
     int64_t *sender_flow_control_limits_counter;
     int64_t *retransmits_sent_counter;
+    int64_t *retransmits_dropped_counter;
 }
 aeron_network_publication_t;
 
@@ -129,6 +146,10 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset);
 
+int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
+
+int aeron_network_publication_resend_pending(aeron_network_publication_t *publication);
+
 void aeron_network_publication_on_nak(
     aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length);
 
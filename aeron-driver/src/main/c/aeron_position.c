@@ -39,6 +39,14 @@ typedef struct aeron_channel_endpoint_status_key_layout_stct
     char channel[sizeof(((aeron_counter_metadata_descriptor_t *)0)->key)];
 }
 aeron_channel_endpoint_status_key_layout_t;
+
+typedef struct aeron_agent_idle_time_key_layout_stct
+{
+    int32_t idle_phase;
+    int32_t role_name_length;
+    char role_name[sizeof(((aeron_counter_metadata_descriptor_t *)0)->key) - (2 * sizeof(int32_t))];
+}
+aeron_agent_idle_time_key_layout_t;
 #pragma pack(pop)
 
 static void aeron_stream_position_counter_key_func(uint8_t *key, size_t key_max_length, void *clientd)
@@ -190,6 +198,60 @@ int32_t aeron_counter_receiver_position_allocate(
         "");
 }
 
+int32_t aeron_counter_receiver_rtt_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_RTT_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
+int32_t aeron_counter_receiver_rtt_variance_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_RTT_VARIANCE_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
+int32_t aeron_counter_receiver_socket_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    return aeron_stream_position_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_SOCKET_LATENCY_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel,
+        "");
+}
+
 static void aeron_channel_endpopint_status_key_func(uint8_t *key, size_t key_max_length, void *clientd)
 {
     aeron_channel_endpoint_status_key_layout_t *layout = (aeron_channel_endpoint_status_key_layout_t *)clientd;
@@ -237,3 +299,35 @@ int32_t aeron_counter_receive_channel_status_allocate(
         AERON_COUNTER_RECEIVE_CHANNEL_STATUS_TYPE_ID,
         channel);
 }
+
+static void aeron_agent_idle_time_key_func(uint8_t *key, size_t key_max_length, void *clientd)
+{
+    aeron_agent_idle_time_key_layout_t *layout = (aeron_agent_idle_time_key_layout_t *)clientd;
+
+    memcpy(key, layout, key_max_length);
+}
+
+int32_t aeron_counter_agent_idle_time_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t idle_phase,
+    const char *role_name)
+{
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(label, sizeof(label), "%s: %s", name, role_name);
+    aeron_agent_idle_time_key_layout_t layout =
+        {
+            .idle_phase = idle_phase,
+            .role_name_length = (int32_t)strlen(role_name)
+        };
+
+    strncpy(layout.role_name, role_name, sizeof(layout.role_name) - 1);
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        label,
+        (size_t)label_length,
+        AERON_COUNTER_AGENT_IDLE_TIME_TYPE_ID,
+        aeron_agent_idle_time_key_func,
+        &layout);
+}
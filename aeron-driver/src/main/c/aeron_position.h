@@ -96,12 +96,39 @@ int32_t aeron_counter_receiver_position_allocate(
     int32_t stream_id,
     const char *channel);
 
+#define AERON_COUNTER_RECEIVER_RTT_NAME "rcv-rtt"
+#define AERON_COUNTER_RECEIVER_RTT_VARIANCE_NAME "rcv-rtt-var"
+#define AERON_COUNTER_RECEIVER_SOCKET_LATENCY_NAME "rcv-socket-latency"
+
+int32_t aeron_counter_receiver_rtt_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+int32_t aeron_counter_receiver_rtt_variance_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+int32_t aeron_counter_receiver_socket_latency_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
 #define AERON_COUNTER_SEND_CHANNEL_STATUS_NAME "snd-channel"
 #define AERON_COUNTER_SEND_CHANNEL_STATUS_TYPE_ID (6)
 
 #define AERON_COUNTER_RECEIVE_CHANNEL_STATUS_NAME "rcv-channel"
 #define AERON_COUNTER_RECEIVE_CHANNEL_STATUS_TYPE_ID (7)
 
+#define AERON_COUNTER_PER_IMAGE_TYPE_ID (10)
+
 #define AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_INITIALIZING (0)
 #define AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ERRORED (-1)
 #define AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE (1)
@@ -115,4 +142,16 @@ int32_t aeron_counter_receive_channel_status_allocate(
     aeron_counters_manager_t *counters_manager,
     const char *channel);
 
+#define AERON_COUNTER_AGENT_IDLE_SPIN_TIME_NAME "idle-spin-ns"
+#define AERON_COUNTER_AGENT_IDLE_YIELD_TIME_NAME "idle-yield-ns"
+#define AERON_COUNTER_AGENT_IDLE_PARK_TIME_NAME "idle-park-ns"
+/* kept clear of the type ids the Java driver and client assign */
+#define AERON_COUNTER_AGENT_IDLE_TIME_TYPE_ID (50)
+
+int32_t aeron_counter_agent_idle_time_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t idle_phase,
+    const char *role_name);
+
 #endif //AERON_AERON_POSITION_H
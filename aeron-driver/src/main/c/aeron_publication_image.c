@@ -20,6 +20,7 @@
 #include "aeron_publication_image.h"
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_log_buffer_pool.h"
 
 int aeron_publication_image_create(
     aeron_publication_image_t **image,
@@ -33,6 +34,9 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_counter_t *rcv_rtt_counter,
+    aeron_counter_t *rcv_rtt_variance_counter,
+    aeron_counter_t *rcv_socket_latency_counter,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -54,7 +58,8 @@ int aeron_publication_image_create(
             correlation_id);
     aeron_publication_image_t *_image = NULL;
     const uint64_t usable_fs_space = context->usable_fs_space_func(context->aeron_dir);
-    const uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_buffer_length);
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(
+        (uint64_t)term_buffer_length, context->file_page_size);
     bool is_multicast = endpoint->conductor_fields.udp_channel->multicast;
     int64_t now_ns = context->nano_clock();
 
@@ -91,7 +96,8 @@ int aeron_publication_image_create(
         return -1;
     }
 
-    if (context->map_raw_log_func(&_image->mapped_raw_log, path, context->term_buffer_sparse_file, (uint64_t)term_buffer_length) < 0)
+    if (aeron_log_buffer_pool_map_raw_log(
+        context, &_image->mapped_raw_log, path, (uint64_t)term_buffer_length, context->term_buffer_numa_node) < 0)
     {
         aeron_free(_image->log_file_name);
         aeron_free(_image);
@@ -107,6 +113,8 @@ int aeron_publication_image_create(
 
     _image->log_meta_data->initialTerm_id = initial_term_id;
     _image->log_meta_data->mtu_length = sender_mtu_length;
+    _image->log_meta_data->term_length = (int32_t)term_buffer_length;
+    _image->log_meta_data->page_size = (int32_t)context->file_page_size;
     _image->log_meta_data->correlation_id = correlation_id;
     _image->log_meta_data->time_of_last_status_message = 0;
     _image->log_meta_data->end_of_stream_position = INT64_MAX;
@@ -119,6 +127,7 @@ int aeron_publication_image_create(
     _image->loss_reporter_offset = -1;
     _image->nano_clock = context->nano_clock;
     _image->epoch_clock = context->epoch_clock;
+    _image->epoch_nano_clock = context->epoch_nano_clock;
     _image->conductor_fields.subscribeable.array = NULL;
     _image->conductor_fields.subscribeable.length = 0;
     _image->conductor_fields.subscribeable.capacity = 0;
@@ -135,6 +144,12 @@ int aeron_publication_image_create(
     _image->rcv_hwm_position.value_addr = rcv_hwm_position->value_addr;
     _image->rcv_pos_position.counter_id = rcv_pos_position->counter_id;
     _image->rcv_pos_position.value_addr = rcv_pos_position->value_addr;
+    _image->rcv_rtt_counter.counter_id = rcv_rtt_counter->counter_id;
+    _image->rcv_rtt_counter.value_addr = rcv_rtt_counter->value_addr;
+    _image->rcv_rtt_variance_counter.counter_id = rcv_rtt_variance_counter->counter_id;
+    _image->rcv_rtt_variance_counter.value_addr = rcv_rtt_variance_counter->value_addr;
+    _image->rcv_socket_latency_counter.counter_id = rcv_socket_latency_counter->counter_id;
+    _image->rcv_socket_latency_counter.value_addr = rcv_socket_latency_counter->value_addr;
     _image->initial_term_id = initial_term_id;
     _image->term_length_mask = (int32_t)term_buffer_length - 1;
     _image->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_buffer_length);
@@ -145,6 +160,7 @@ int aeron_publication_image_create(
     memcpy(&_image->control_address, control_address, sizeof(_image->control_address));
     memcpy(&_image->source_address, source_address, sizeof(_image->source_address));
 
+    _image->has_shared_system_counters = context->receiver_shard_count > 1;
     _image->heartbeats_received_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_HEARTBEATS_RECEIVED);
     _image->flow_control_under_runs_counter =
@@ -162,9 +178,8 @@ int aeron_publication_image_create(
 
     _image->begin_loss_change = -1;
     _image->end_loss_change = -1;
-    _image->loss_term_id = active_term_id;
-    _image->loss_term_offset = initial_term_offset;
-    _image->loss_length = 0;
+    _image->loss_gap_count = 0;
+    _image->pending_loss_gap_count = 0;
 
     _image->begin_sm_change = -1;
     _image->end_sm_change = -1;
@@ -173,11 +188,15 @@ int aeron_publication_image_create(
         _image->congestion_control->initial_window_length(_image->congestion_control->state);
     _image->last_packet_timestamp_ns = now_ns;
     _image->last_status_mesage_timestamp = 0;
+    _image->smoothed_rtt_ns = 0;
+    _image->rtt_variance_ns = 0;
     _image->conductor_fields.clean_position = initial_position;
     _image->conductor_fields.time_of_last_status_change_ns = now_ns;
 
     aeron_counter_set_ordered(_image->rcv_hwm_position.value_addr, initial_position);
     aeron_counter_set_ordered(_image->rcv_pos_position.value_addr, initial_position);
+    aeron_counter_set_ordered(_image->rcv_rtt_counter.value_addr, 0);
+    aeron_counter_set_ordered(_image->rcv_rtt_variance_counter.value_addr, 0);
 
     *image = _image;
     return 0;
@@ -191,6 +210,12 @@ int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, ae
 
         aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_hwm_position.counter_id);
         aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_pos_position.counter_id);
+        aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_rtt_counter.counter_id);
+        aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_rtt_variance_counter.counter_id);
+        if (image->rcv_socket_latency_counter.counter_id >= 0)
+        {
+            aeron_counters_manager_free(counters_manager, (int32_t)image->rcv_socket_latency_counter.counter_id);
+        }
 
         for (size_t i = 0, length = subscribeable->length; i < length; i++)
         {
@@ -228,15 +253,14 @@ void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int
 {
     aeron_publication_image_t *image = (aeron_publication_image_t *)clientd;
 
-    const int64_t change_number = image->begin_loss_change + 1;
-
-    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
-
-    image->loss_term_id = term_id;
-    image->loss_term_offset = term_offset;
-    image->loss_length = length;
+    if (image->pending_loss_gap_count < AERON_LOSS_DETECTOR_MAX_GAPS)
+    {
+        aeron_loss_detector_gap_t *gap = &image->pending_loss_gaps[image->pending_loss_gap_count++];
 
-    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+        gap->term_id = term_id;
+        gap->term_offset = term_offset;
+        gap->length = length;
+    }
 
     if (image->loss_reporter_offset >= 0)
     {
@@ -267,6 +291,26 @@ void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int
     }
 }
 
+void aeron_publication_image_schedule_pending_loss(aeron_publication_image_t *image)
+{
+    if (image->pending_loss_gap_count > 0)
+    {
+        const int64_t change_number = image->begin_loss_change + 1;
+
+        AERON_PUT_ORDERED(image->begin_loss_change, change_number);
+
+        memcpy(
+            image->loss_gaps,
+            image->pending_loss_gaps,
+            sizeof(aeron_loss_detector_gap_t) * image->pending_loss_gap_count);
+        image->loss_gap_count = image->pending_loss_gap_count;
+
+        AERON_PUT_ORDERED(image->end_loss_change, change_number);
+
+        image->pending_loss_gap_count = 0;
+    }
+}
+
 void aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout)
 {
@@ -299,6 +343,8 @@ void aeron_publication_image_track_rebuild(
             image->position_bits_to_shift,
             image->initial_term_id);
 
+    aeron_publication_image_schedule_pending_loss(image);
+
     const int32_t rebuild_term_offset = (int32_t)(rebuild_position & image->term_length_mask);
     const int64_t new_rebuild_position = (rebuild_position - rebuild_term_offset) + rebuild_offset;
 
@@ -328,7 +374,12 @@ void aeron_publication_image_track_rebuild(
 }
 
 int aeron_publication_image_insert_packet(
-    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, const uint8_t *buffer, size_t length)
+    aeron_publication_image_t *image,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *buffer,
+    size_t length,
+    struct timespec *timestamp)
 {
     const bool is_heartbeat = aeron_publication_image_is_heartbeat(buffer, length);
     const int64_t packet_position =
@@ -346,7 +397,7 @@ int aeron_publication_image_insert_packet(
                 AERON_PUT_ORDERED(image->log_meta_data->end_of_stream_position, packet_position);
             }
 
-            aeron_counter_ordered_increment(image->heartbeats_received_counter, 1);
+            aeron_publication_image_increment_system_counter(image, image->heartbeats_received_counter, 1);
         }
         else
         {
@@ -356,6 +407,14 @@ int aeron_publication_image_insert_packet(
             aeron_term_rebuilder_insert(term_buffer + term_offset, buffer, length);
         }
 
+        if (NULL != timestamp && NULL != image->rcv_socket_latency_counter.value_addr)
+        {
+            const int64_t received_ns = (timestamp->tv_sec * 1000000000L) + timestamp->tv_nsec;
+
+            aeron_counter_set_ordered(
+                image->rcv_socket_latency_counter.value_addr, image->epoch_nano_clock() - received_ns);
+        }
+
         aeron_publication_image_hwm_candidate(image, proposed_position);
     }
 
@@ -368,6 +427,28 @@ int aeron_publication_image_on_rttm(
     const int64_t now_ns = image->nano_clock();
     const int64_t rtt_in_ns = now_ns - header->echo_timestamp - header->reception_delta;
 
+    if (rtt_in_ns < 0)
+    {
+        return 0;
+    }
+
+    /* smoothed RTT and RTT variance as per RFC 6298 */
+    if (0 == image->smoothed_rtt_ns)
+    {
+        image->smoothed_rtt_ns = rtt_in_ns;
+        image->rtt_variance_ns = rtt_in_ns / 2;
+    }
+    else
+    {
+        const int64_t rtt_delta = image->smoothed_rtt_ns - rtt_in_ns;
+
+        image->rtt_variance_ns = ((3 * image->rtt_variance_ns) + (rtt_delta < 0 ? -rtt_delta : rtt_delta)) / 4;
+        image->smoothed_rtt_ns = ((7 * image->smoothed_rtt_ns) + rtt_in_ns) / 8;
+    }
+
+    aeron_counter_set_ordered(image->rcv_rtt_counter.value_addr, image->smoothed_rtt_ns);
+    aeron_counter_set_ordered(image->rcv_rtt_variance_counter.value_addr, image->rtt_variance_ns);
+
     image->congestion_control->on_rttm(image->congestion_control->state, now_ns, rtt_in_ns, addr);
     return 1;
 }
@@ -405,7 +486,7 @@ int aeron_publicaion_image_send_pending_status_message(aeron_publication_image_t
                     receiver_window_length,
                     0);
 
-                aeron_counter_ordered_increment(image->status_messages_sent_counter, 1);
+                aeron_publication_image_increment_system_counter(image, image->status_messages_sent_counter, 1);
 
                 image->last_sm_change_number = change_number;
                 work_count = send_sm_result < 0 ? send_sm_result : 1;
@@ -425,25 +506,29 @@ int aeron_publicaion_image_send_pending_loss(aeron_publication_image_t *image)
 
     if (change_number != image->last_loss_change_number)
     {
-        const int32_t term_id = image->loss_term_id;
-        const int32_t term_offset = image->loss_term_offset;
-        const int32_t length = (int32_t)image->loss_length;
+        aeron_loss_detector_gap_t gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+        const size_t gap_count = image->loss_gap_count;
+
+        memcpy(gaps, image->loss_gaps, sizeof(aeron_loss_detector_gap_t) * gap_count);
 
         aeron_acquire(); /* loadFence */
 
         if (change_number == image->begin_loss_change)
         {
             /* TODO: if not reliable, then don't send, fill gap instead */
-            int send_nak_result = aeron_receive_channel_endpoint_send_nak(
+            int send_nak_result = aeron_receive_channel_endpoint_send_naks(
                 image->endpoint,
                 &image->control_address,
                 image->stream_id,
                 image->session_id,
-                term_id,
-                term_offset,
-                length);
+                gaps,
+                gap_count);
 
-            aeron_counter_ordered_increment(image->status_messages_sent_counter, 1);
+            if (send_nak_result > 0)
+            {
+                aeron_publication_image_increment_system_counter(
+                    image, image->nak_messages_sent_counter, send_nak_result);
+            }
 
             image->last_loss_change_number = change_number;
             work_count = send_nak_result < 0 ? send_nak_result : 1;
@@ -453,6 +538,35 @@ int aeron_publicaion_image_send_pending_loss(aeron_publication_image_t *image)
     return work_count;
 }
 
+int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int64_t now_ns)
+{
+    int work_count = 0;
+
+    if (AERON_PUBLICATION_IMAGE_STATUS_ACTIVE == image->conductor_fields.status &&
+        image->congestion_control->should_measure_rtt(image->congestion_control->state, now_ns))
+    {
+        image->congestion_control->on_rttm_sent(image->congestion_control->state, now_ns);
+
+        int send_rttm_result = aeron_receive_channel_endpoint_send_rttm(
+            image->endpoint,
+            &image->control_address,
+            image->stream_id,
+            image->session_id,
+            now_ns,
+            0,
+            true);
+
+        if (send_rttm_result < 0)
+        {
+            return -1;
+        }
+
+        work_count = 1;
+    }
+
+    return work_count;
+}
+
 void aeron_publication_image_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_publication_image_t *image, int64_t now_ns, int64_t now_ms)
 {
@@ -470,7 +584,7 @@ void aeron_publication_image_on_time_event(
                 image->conductor_fields.time_of_last_status_change_ns = now_ns;
 
                 aeron_driver_receiver_proxy_on_remove_publication_image(
-                    conductor->context->receiver_proxy, image->endpoint, image);
+                    image->endpoint->receiver_proxy, image->endpoint, image);
             }
             break;
         }
@@ -501,6 +615,8 @@ void aeron_publication_image_on_time_event(
 
 extern bool aeron_publication_image_is_heartbeat(const uint8_t *buffer, size_t length);
 extern bool aeron_publication_image_is_end_of_stream(const uint8_t *buffer, size_t length);
+extern void aeron_publication_image_increment_system_counter(
+    aeron_publication_image_t *image, int64_t *counter, int64_t value);
 extern bool aeron_publication_image_is_flow_control_under_run(
     aeron_publication_image_t *image, int64_t window_position, int64_t packet_position);
 extern bool aeron_publication_image_is_flow_control_over_run(
@@ -513,4 +629,6 @@ extern bool aeron_publication_image_is_accepting_subscriptions(aeron_publication
 
 extern const char *aeron_publication_image_log_file_name(aeron_publication_image_t *image);
 extern int64_t aeron_publication_image_registration_id(aeron_publication_image_t *image);
+extern int64_t aeron_publication_image_smoothed_rtt_ns(aeron_publication_image_t *image);
+extern int64_t aeron_publication_image_rtt_variance_ns(aeron_publication_image_t *image);
 extern size_t aeron_publication_image_num_subscriptions(aeron_publication_image_t *image);
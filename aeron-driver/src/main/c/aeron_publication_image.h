@@ -55,12 +55,16 @@ typedef struct aeron_publication_image_stct
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t rcv_hwm_position;
     aeron_position_t rcv_pos_position;
+    aeron_counter_t rcv_rtt_counter;
+    aeron_counter_t rcv_rtt_variance_counter;
+    aeron_counter_t rcv_socket_latency_counter;
     aeron_logbuffer_metadata_t *log_meta_data;
 
     aeron_receive_channel_endpoint_t *endpoint;
     aeron_congestion_control_strategy_t *congestion_control;
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
+    aeron_clock_func_t epoch_nano_clock;
 
     aeron_loss_reporter_t *loss_reporter;
     aeron_loss_reporter_entry_offset_t loss_reporter_offset;
@@ -81,6 +85,9 @@ typedef struct aeron_publication_image_stct
     int64_t last_packet_timestamp_ns;
     int64_t last_status_mesage_timestamp;
 
+    int64_t smoothed_rtt_ns;
+    int64_t rtt_variance_ns;
+
     int64_t last_sm_change_number;
     int64_t last_loss_change_number;
 
@@ -89,12 +96,16 @@ typedef struct aeron_publication_image_stct
     int64_t next_sm_position;
     int32_t next_sm_receiver_window_length;
 
+    aeron_loss_detector_gap_t pending_loss_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    size_t pending_loss_gap_count;
+
     volatile int64_t begin_loss_change;
     volatile int64_t end_loss_change;
-    int32_t loss_term_id;
-    int32_t loss_term_offset;
-    size_t loss_length;
+    aeron_loss_detector_gap_t loss_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    size_t loss_gap_count;
 
+    /* system counters have more than one writer when the receiver is sharded */
+    bool has_shared_system_counters;
     int64_t *heartbeats_received_counter;
     int64_t *flow_control_under_runs_counter;
     int64_t *flow_control_over_runs_counter;
@@ -115,6 +126,9 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_counter_t *rcv_rtt_counter,
+    aeron_counter_t *rcv_rtt_variance_counter,
+    aeron_counter_t *rcv_socket_latency_counter,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -130,11 +144,18 @@ void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, i
 
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
+void aeron_publication_image_schedule_pending_loss(aeron_publication_image_t *image);
+
 void aeron_publication_image_track_rebuild(
     aeron_publication_image_t *image, int64_t now_ns, int64_t status_message_timeout);
 
 int aeron_publication_image_insert_packet(
-    aeron_publication_image_t *image, int32_t term_id, int32_t term_offset, const uint8_t *buffer, size_t length);
+    aeron_publication_image_t *image,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *buffer,
+    size_t length,
+    struct timespec *timestamp);
 
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr);
@@ -143,6 +164,8 @@ int aeron_publicaion_image_send_pending_status_message(aeron_publication_image_t
 
 int aeron_publicaion_image_send_pending_loss(aeron_publication_image_t *image);
 
+int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int64_t now_ns);
+
 void aeron_publication_image_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_publication_image_t *image, int64_t now_ns, int64_t now_ms);
 
@@ -157,6 +180,19 @@ inline bool aeron_publication_image_is_end_of_stream(const uint8_t *buffer, size
         (AERON_DATA_HEADER_EOS_FLAG | AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG);
 }
 
+inline void aeron_publication_image_increment_system_counter(
+    aeron_publication_image_t *image, int64_t *counter, int64_t value)
+{
+    if (image->has_shared_system_counters)
+    {
+        aeron_counter_increment(counter, value);
+    }
+    else
+    {
+        aeron_counter_ordered_increment(counter, value);
+    }
+}
+
 inline bool aeron_publication_image_is_flow_control_under_run(
     aeron_publication_image_t *image, int64_t window_position, int64_t packet_position)
 {
@@ -164,7 +200,7 @@ inline bool aeron_publication_image_is_flow_control_under_run(
 
     if (is_flow_control_under_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_under_runs_counter, 1);
+        aeron_publication_image_increment_system_counter(image, image->flow_control_under_runs_counter, 1);
     }
 
     return is_flow_control_under_run;
@@ -177,7 +213,7 @@ inline bool aeron_publication_image_is_flow_control_over_run(
 
     if (is_flow_control_over_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_over_runs_counter, 1);
+        aeron_publication_image_increment_system_counter(image, image->flow_control_over_runs_counter, 1);
     }
 
     return is_flow_control_over_run;
@@ -236,6 +272,16 @@ inline int64_t aeron_publication_image_registration_id(aeron_publication_image_t
     return image->conductor_fields.managed_resource.registration_id;
 }
 
+inline int64_t aeron_publication_image_smoothed_rtt_ns(aeron_publication_image_t *image)
+{
+    return aeron_counter_get_volatile(image->rcv_rtt_counter.value_addr);
+}
+
+inline int64_t aeron_publication_image_rtt_variance_ns(aeron_publication_image_t *image)
+{
+    return aeron_counter_get_volatile(image->rcv_rtt_variance_counter.value_addr);
+}
+
 inline size_t aeron_publication_image_num_subscriptions(aeron_publication_image_t *image)
 {
     return image->conductor_fields.subscribeable.length;
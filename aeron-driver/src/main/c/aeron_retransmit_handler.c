@@ -18,36 +18,49 @@
 #include "concurrent/aeron_counters_manager.h"
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
 #include "aeron_retransmit_handler.h"
 
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *retransmits_merged_counter,
+    int64_t *retransmits_lingered_counter,
+    int64_t *retransmits_dropped_counter,
+    size_t max_retransmit_actions,
     int64_t linger_timeout_ns)
 {
-    if (aeron_int64_to_ptr_hash_map_init(
-        &handler->active_retransmits_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    handler->retransmit_actions.array = NULL;
+    handler->retransmit_actions.length = 0;
+    handler->retransmit_actions.capacity = 0;
+
+    if (aeron_array_ensure_capacity(
+        (uint8_t **)&handler->retransmit_actions.array,
+        sizeof(aeron_retransmit_action_t),
+        0,
+        AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS) < 0)
     {
         int errcode = errno;
 
-        aeron_set_err(errcode, "could not init retransmit handler map: %s", strerror(errcode));
+        aeron_set_err(errcode, "could not init retransmit handler actions: %s", strerror(errcode));
         return -1;
     }
 
+    handler->retransmit_actions.capacity = AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS;
+    handler->max_retransmit_actions = max_retransmit_actions;
     handler->invalid_packets_counter = invalid_packets_counter;
+    handler->retransmits_merged_counter = retransmits_merged_counter;
+    handler->retransmits_lingered_counter = retransmits_lingered_counter;
+    handler->retransmits_dropped_counter = retransmits_dropped_counter;
     handler->linger_timeout_ns = linger_timeout_ns;
 
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
-    {
-        handler->retransmit_action_pool[i].state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
-    }
-
     return 0;
 }
 
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler)
 {
-    aeron_int64_to_ptr_hash_map_delete(&handler->active_retransmits_map);
+    aeron_free(handler->retransmit_actions.array);
+    handler->retransmit_actions.array = NULL;
     return 0;
 }
 
@@ -63,17 +76,110 @@ bool aeron_retransmit_handler_is_invalid(aeron_retransmit_handler_t *handler, in
     return is_invalid;
 }
 
-aeron_retransmit_action_t *aeron_retransmit_handler_assign_action(aeron_retransmit_handler_t *handler)
+inline static int aeron_retransmit_handler_compare(
+    aeron_retransmit_action_t *action, int32_t term_id, int32_t term_offset)
 {
-    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+    const int32_t term_id_delta = action->term_id - term_id;
+
+    if (0 != term_id_delta)
     {
-        if (AERON_RETRANSMIT_ACTION_STATE_INACTIVE == handler->retransmit_action_pool[i].state)
+        return term_id_delta;
+    }
+
+    return action->term_offset - term_offset;
+}
+
+/*
+ * Index of the first action that overlaps, or would follow, a range starting at term_id/term_offset.
+ */
+static size_t aeron_retransmit_handler_search(aeron_retransmit_handler_t *handler, int32_t term_id, int32_t term_offset)
+{
+    aeron_retransmit_action_t *actions = handler->retransmit_actions.array;
+    size_t low = 0, high = handler->retransmit_actions.length;
+
+    while (low < high)
+    {
+        const size_t mid = (low + high) >> 1;
+
+        if (aeron_retransmit_handler_compare(&actions[mid], term_id, term_offset) < 0)
+        {
+            low = mid + 1;
+        }
+        else
         {
-            return &handler->retransmit_action_pool[i];
+            high = mid;
         }
     }
 
-    return NULL;
+    if (low > 0)
+    {
+        aeron_retransmit_action_t *previous = &actions[low - 1];
+
+        if (previous->term_id == term_id && (previous->term_offset + (int32_t)previous->length) > term_offset)
+        {
+            low--;
+        }
+    }
+
+    return low;
+}
+
+static int aeron_retransmit_handler_insert_action(
+    aeron_retransmit_handler_t *handler,
+    size_t index,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    int64_t now_ns)
+{
+    if (handler->retransmit_actions.length >= handler->max_retransmit_actions)
+    {
+        aeron_counter_increment(handler->retransmits_dropped_counter, 1);
+        return 0;
+    }
+
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, handler->retransmit_actions, aeron_retransmit_action_t);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    aeron_retransmit_action_t *actions = handler->retransmit_actions.array;
+
+    memmove(
+        &actions[index + 1],
+        &actions[index],
+        sizeof(aeron_retransmit_action_t) * (handler->retransmit_actions.length - index));
+
+    actions[index].term_id = term_id;
+    actions[index].term_offset = term_offset;
+    actions[index].length = length;
+    actions[index].expire_ns = now_ns + handler->linger_timeout_ns;
+    handler->retransmit_actions.length++;
+
+    return 1;
+}
+
+static int aeron_retransmit_handler_resend_range(
+    aeron_retransmit_handler_t *handler,
+    size_t index,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd)
+{
+    const int insert_result =
+        aeron_retransmit_handler_insert_action(handler, index, term_id, term_offset, length, now_ns);
+
+    if (insert_result <= 0)
+    {
+        return insert_result;
+    }
+
+    return resend(resend_clientd, term_id, term_offset, length) < 0 ? -1 : 1;
 }
 
 int aeron_retransmit_handler_on_nak(
@@ -86,74 +192,106 @@ int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd)
 {
-    int result = 0;
-
     if (!aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
     {
-        const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(term_id, term_offset);
+        const size_t term_length_left = term_length - term_offset;
+        const int32_t end_offset = term_offset + (int32_t)(length < term_length_left ? length : term_length_left);
+        int32_t offset = term_offset;
+        bool is_merged = false;
 
-        if (NULL == aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key) &&
-            handler->active_retransmits_map.size < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+        size_t index = aeron_retransmit_handler_search(handler, term_id, term_offset);
+
+        while (offset < end_offset && index < handler->retransmit_actions.length)
         {
-            aeron_retransmit_action_t *action = aeron_retransmit_handler_assign_action(handler);
+            aeron_retransmit_action_t *action = &handler->retransmit_actions.array[index];
 
-            if (NULL == action)
+            if (action->term_id != term_id || action->term_offset >= end_offset)
             {
-                aeron_set_err(EINVAL, "%s", "could not assign retransmit action");
-                return -1;
+                break;
             }
 
-            const size_t term_length_left = term_length - term_offset;
+            if (action->term_offset > offset)
+            {
+                int resend_result = aeron_retransmit_handler_resend_range(
+                    handler,
+                    index,
+                    term_id,
+                    offset,
+                    (size_t)(action->term_offset - offset),
+                    now_ns,
+                    resend,
+                    resend_clientd);
+
+                if (resend_result < 0)
+                {
+                    return -1;
+                }
+
+                index += resend_result;
+            }
 
-            action->term_id = term_id;
-            action->term_offset = term_offset;
-            action->length = length < term_length_left ? length : term_length_left;
+            const int32_t action_end_offset =
+                handler->retransmit_actions.array[index].term_offset +
+                (int32_t)handler->retransmit_actions.array[index].length;
 
-            result = resend(resend_clientd, term_id, term_offset, action->length);
-            action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
-            action->expire_ns = now_ns + handler->linger_timeout_ns;
+            offset = action_end_offset > offset ? action_end_offset : offset;
+            is_merged = true;
+            index++;
+        }
 
-            if (aeron_int64_to_ptr_hash_map_put(&handler->active_retransmits_map, key, action) < 0)
+        if (offset < end_offset)
+        {
+            if (aeron_retransmit_handler_resend_range(
+                handler,
+                index,
+                term_id,
+                offset,
+                (size_t)(end_offset - offset),
+                now_ns,
+                resend,
+                resend_clientd) < 0)
             {
-                int errcode = errno;
-
-                aeron_set_err(errcode, "could not put retransmit handler map: %s", strerror(errcode));
                 return -1;
             }
+
+            if (is_merged)
+            {
+                aeron_counter_increment(handler->retransmits_merged_counter, 1);
+            }
+        }
+        else
+        {
+            aeron_counter_increment(handler->retransmits_lingered_counter, 1);
         }
     }
 
-    return result;
+    return 0;
 }
 
 int aeron_retransmit_handler_process_timeouts(
     aeron_retransmit_handler_t *handler,
     int64_t now_ns)
 {
-    int result = 0;
-    size_t num_active_actions = handler->active_retransmits_map.size;
+    aeron_retransmit_action_t *actions = handler->retransmit_actions.array;
+    const size_t length = handler->retransmit_actions.length;
+    size_t retained = 0;
 
-    if (num_active_actions > 0)
+    for (size_t i = 0; i < length; i++)
     {
-        for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS && num_active_actions > 0; i++)
+        if (now_ns <= actions[i].expire_ns)
         {
-            aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
-
-            if (AERON_RETRANSMIT_ACTION_STATE_LINGERING == action->state)
+            if (retained != i)
             {
-                if (now_ns > action->expire_ns)
-                {
-                    const int64_t key = aeron_int64_to_ptr_hash_map_compound_key(action->term_id, action->term_offset);
-
-                    action->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
-                    aeron_int64_to_ptr_hash_map_remove(&handler->active_retransmits_map, key);
-                    result++;
-                }
-
-                num_active_actions--;
+                actions[retained] = actions[i];
             }
+
+            retained++;
         }
     }
 
-    return result;
+    handler->retransmit_actions.length = retained;
+
+    return (int)(length - retained);
 }
+
+extern size_t aeron_retransmit_handler_max_retransmit_actions(size_t term_window_length, size_t mtu_length);
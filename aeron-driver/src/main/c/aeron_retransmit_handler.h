@@ -19,46 +19,56 @@
 
 #include <stdint.h>
 #include <stddef.h>
-#include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "aeron_driver_common.h"
 #include "aeronmd.h"
 
-typedef enum aeron_retransmit_action_state_enum
-{
-    AERON_RETRANSMIT_ACTION_STATE_LINGERING,
-    AERON_RETRANSMIT_ACTION_STATE_INACTIVE,
-}
-aeron_retransmit_action_state_t;
-
 typedef struct aeron_retransmit_action_stct
 {
     int64_t expire_ns;
     int32_t term_id;
     int32_t term_offset;
     size_t length;
-    aeron_retransmit_action_state_t state;
 }
 aeron_retransmit_action_t;
 
-#define AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS (16)
+#define AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS (16)
 #define AERON_RETRANSMIT_HANDLER_DEFAULT_LINGER_TIMEOUT_NS (60 * 1000 * 1000L)
 
 typedef int (*aeron_retransmit_handler_resend_func_t)(
     void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
+/*
+ * Lingering retransmit actions are kept as a set of disjoint ranges sorted by term_id then term_offset.
+ * A NAK only resends the parts of its range not already covered by a lingering action, so overlapping
+ * NAKs from many receivers result in a single retransmit of each range.
+ */
 typedef struct aeron_retransmit_handler_stct
 {
-    aeron_retransmit_action_t retransmit_action_pool[AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS];
-    aeron_int64_to_ptr_hash_map_t active_retransmits_map;
+    struct aeron_retransmit_handler_actions_stct
+    {
+        aeron_retransmit_action_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    retransmit_actions;
+
+    size_t max_retransmit_actions;
     int64_t linger_timeout_ns;
 
     int64_t *invalid_packets_counter;
+    int64_t *retransmits_merged_counter;
+    int64_t *retransmits_lingered_counter;
+    int64_t *retransmits_dropped_counter;
 }
 aeron_retransmit_handler_t;
 
 int aeron_retransmit_handler_init(
     aeron_retransmit_handler_t *handler,
     int64_t *invalid_packets_counter,
+    int64_t *retransmits_merged_counter,
+    int64_t *retransmits_lingered_counter,
+    int64_t *retransmits_dropped_counter,
+    size_t max_retransmit_actions,
     int64_t linger_timeout_ns);
 
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler);
@@ -77,4 +87,12 @@ int aeron_retransmit_handler_process_timeouts(
     aeron_retransmit_handler_t *handler,
     int64_t now_ns);
 
+inline size_t aeron_retransmit_handler_max_retransmit_actions(size_t term_window_length, size_t mtu_length)
+{
+    const size_t max_actions = term_window_length / mtu_length;
+
+    return max_actions < AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS ?
+        AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS : max_actions;
+}
+
 #endif //AERON_AERON_RETRANSMIT_HANDLER_H
@@ -45,7 +45,10 @@ typedef enum aeron_system_counter_enum_stct
     AERON_SYSTEM_COUNTER_UNBLOCKED_COMMANDS = 20,
     AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY = 21,
     AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY = 22,
-    AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23
+    AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23,
+    AERON_SYSTEM_COUNTER_RETRANSMITS_MERGED = 24,
+    AERON_SYSTEM_COUNTER_RETRANSMITS_LINGERED = 25,
+    AERON_SYSTEM_COUNTER_RETRANSMITS_DROPPED = 26
 }
 aeron_system_counter_enum_t;
 
@@ -47,12 +47,39 @@ typedef struct aeron_driver_stct aeron_driver_t;
 #define AERON_SOCKET_MULTICAST_TTL_ENV_VAR "AERON_SOCKET_MULTICAST_TTL"
 #define AERON_SEND_TO_STATUS_POLL_RATIO_ENV_VAR "AERON_SEND_TO_STATUS_POLL_RATIO"
 #define AERON_RCV_STATUS_MESSAGE_TIMEOUT_ENV_VAR "AERON_RCV_STATUS_MESSAGE_TIMEOUT"
+#define AERON_RCV_RTT_MEASUREMENT_INTERVAL_ENV_VAR "AERON_RCV_RTT_MEASUREMENT_INTERVAL"
 #define AERON_MULTICAST_FLOWCONTROL_SUPPLIER_ENV_VAR "AERON_MULTICAST_FLOWCONTROL_SUPPLIER"
 #define AERON_UNICAST_FLOWCONTROL_SUPPLIER_ENV_VAR "AERON_UNICAST_FLOWCONTROL_SUPPLIER"
+#define AERON_MIN_MULTICAST_FLOWCONTROL_RECEIVER_TIMEOUT_ENV_VAR "AERON_MIN_MULTICAST_FLOWCONTROL_RECEIVER_TIMEOUT"
 #define AERON_IMAGE_LIVENESS_TIMEOUT_ENV_VAR "AERON_IMAGE_LIVENESS_TIMEOUT"
 #define AERON_RCV_INITIAL_WINDOW_LENGTH_ENV_VAR "AERON_RCV_INITIAL_WINDOW_LENGTH"
 #define AERON_CONGESTIONCONTROL_SUPPLIER_ENV_VAR "AERON_CONGESTIONCONTROL_SUPPLIER"
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_MEASURERTT"
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_INITIALRTT"
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_TCPMODE"
 #define AERON_LOSS_REPORT_BUFFER_LENGTH_ENV_VAR "AERON_LOSS_REPORT_BUFFER_LENGTH"
+#define AERON_RETRANSMIT_BUDGET_LENGTH_ENV_VAR "AERON_RETRANSMIT_BUDGET_LENGTH"
+#define AERON_UDP_TRANSPORT_IO_URING_ENV_VAR "AERON_UDP_TRANSPORT_IO_URING"
+#define AERON_UDP_GSO_ENV_VAR "AERON_UDP_GSO"
+#define AERON_RCV_TIMESTAMPS_ENV_VAR "AERON_RCV_TIMESTAMPS"
+#define AERON_CONDUCTOR_IDLE_STRATEGY_ENV_VAR "AERON_CONDUCTOR_IDLE_STRATEGY"
+#define AERON_SENDER_IDLE_STRATEGY_ENV_VAR "AERON_SENDER_IDLE_STRATEGY"
+#define AERON_RECEIVER_IDLE_STRATEGY_ENV_VAR "AERON_RECEIVER_IDLE_STRATEGY"
+#define AERON_SHARED_IDLE_STRATEGY_ENV_VAR "AERON_SHARED_IDLE_STRATEGY"
+#define AERON_SHAREDNETWORK_IDLE_STRATEGY_ENV_VAR "AERON_SHAREDNETWORK_IDLE_STRATEGY"
+#define AERON_LOG_BUFFER_POOL_SIZE_ENV_VAR "AERON_LOG_BUFFER_POOL_SIZE"
+#define AERON_LOG_BUFFER_POOL_IDLE_STRATEGY_ENV_VAR "AERON_LOG_BUFFER_POOL_IDLE_STRATEGY"
+#define AERON_FILE_PAGE_SIZE_ENV_VAR "AERON_FILE_PAGE_SIZE"
+#define AERON_TERM_BUFFER_NUMA_NODE_ENV_VAR "AERON_TERM_BUFFER_NUMA_NODE"
+#define AERON_IPC_TERM_BUFFER_NUMA_NODE_ENV_VAR "AERON_IPC_TERM_BUFFER_NUMA_NODE"
+#define AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CONDUCTOR_CPU_AFFINITY"
+#define AERON_SENDER_CPU_AFFINITY_ENV_VAR "AERON_SENDER_CPU_AFFINITY"
+#define AERON_RECEIVER_CPU_AFFINITY_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY"
+#define AERON_SHARED_CPU_AFFINITY_ENV_VAR "AERON_SHARED_CPU_AFFINITY"
+#define AERON_SHAREDNETWORK_CPU_AFFINITY_ENV_VAR "AERON_SHAREDNETWORK_CPU_AFFINITY"
+#define AERON_LOG_BUFFER_POOL_CPU_AFFINITY_ENV_VAR "AERON_LOG_BUFFER_POOL_CPU_AFFINITY"
+#define AERON_RECEIVER_SHARD_COUNT_ENV_VAR "AERON_RECEIVER_SHARD_COUNT"
+#define AERON_SENDER_SHARD_COUNT_ENV_VAR "AERON_SENDER_SHARD_COUNT"
 
 #define AERON_IPC_CHANNEL "aeron:ipc"
 #define AERON_SPY_PREFIX "aeron-spy:"
@@ -78,6 +105,7 @@ typedef int64_t (*aeron_clock_func_t)();
 
 int64_t aeron_nanoclock();
 int64_t aeron_epochclock();
+int64_t aeron_epochnanoclock();
 
 typedef void (*aeron_log_func_t)(const char *);
 bool aeron_is_driver_active(const char *dirname, int64_t timeout, int64_t now, aeron_log_func_t log_func);
@@ -39,12 +39,15 @@ aeron_int64_to_ptr_hash_map_t;
 
 inline size_t aeron_int64_to_ptr_hash_map_hash_key(int64_t key, size_t mask)
 {
-    return (key * 31) & mask;
+    /* fold the high word in so compound keys that differ only in it do not share a chain */
+    uint64_t hash = (uint64_t)key ^ ((uint64_t)key >> 32);
+
+    return (size_t)(hash * 31) & mask;
 }
 
 inline int64_t aeron_int64_to_ptr_hash_map_compound_key(int32_t high, int32_t low)
 {
-    return ((int64_t)high << 32) | (low);
+    return (int64_t)(((uint64_t)(uint32_t)high << 32) | (uint32_t)low);
 }
 
 inline int aeron_int64_to_ptr_hash_map_init(aeron_int64_to_ptr_hash_map_t *map, size_t initial_capacity, float load_factor)
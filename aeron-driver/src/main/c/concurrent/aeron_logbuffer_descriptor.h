@@ -26,6 +26,8 @@
 #define AERON_LOGBUFFER_TERM_MIN_LENGTH (64 * 1024)
 #define AERON_LOGBUFFER_TERM_MAX_LENGTH (1024 * 1024 * 1024)
 #define AERON_LOGBUFFER_DEFAULT_FRAME_HEADER_MAX_LENGTH  (AERON_CACHE_LINE_LENGTH * 2)
+#define AERON_PAGE_MIN_SIZE (4 * 1024)
+#define AERON_PAGE_MAX_SIZE (1024 * 1024 * 1024)
 
 #define AERON_MAX_UDP_PAYLOAD_LENGTH (65504)
 
@@ -43,7 +45,9 @@ typedef struct aeron_logbuffer_metadata_stct
     int32_t initialTerm_id;
     int32_t default_frame_header_length;
     int32_t mtu_length;
-    uint8_t pad3[(AERON_CACHE_LINE_LENGTH) - (5 * sizeof(int32_t))];
+    int32_t term_length;
+    int32_t page_size;
+    uint8_t pad3[(AERON_CACHE_LINE_LENGTH) - (7 * sizeof(int32_t))];
 }
 aeron_logbuffer_metadata_t;
 #pragma pack(pop)
@@ -52,6 +56,14 @@ aeron_logbuffer_metadata_t;
 
 #define AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_length) ((term_length * AERON_LOGBUFFER_PARTITION_COUNT) + AERON_LOGBUFFER_META_DATA_LENGTH)
 
+/* logs are only padded to a multiple of the page size for huge pages so logs for small pages keep their length */
+inline uint64_t aeron_logbuffer_compute_log_length(uint64_t term_length, uint64_t page_size)
+{
+    uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_length);
+
+    return page_size > AERON_PAGE_MIN_SIZE ? AERON_ALIGN(log_length, page_size) : log_length;
+}
+
 #define AERON_LOGBUFFER_ACTIVE_PARTITION_INDEX_VOLATILE(d,m) (AERON_GET_VOLATILE(d,(m->active_partition_index)))
 
 #define AERON_LOGBUFFER_FRAME_ALIGNMENT (32)
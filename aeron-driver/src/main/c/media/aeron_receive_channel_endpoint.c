@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
 #include <aeron_driver_receiver.h>
 #include <stdio.h>
 #include "aeron_system_counters.h"
@@ -24,6 +28,14 @@
 #include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "media/aeron_receive_channel_endpoint.h"
 
+#if !defined(HAVE_RECVMMSG)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
 int aeron_receive_channel_endpoint_create(
     aeron_receive_channel_endpoint_t **endpoint,
     aeron_udp_channel_t *channel,
@@ -32,6 +44,12 @@ int aeron_receive_channel_endpoint_create(
     aeron_driver_context_t *context)
 {
     aeron_receive_channel_endpoint_t *_endpoint = NULL;
+    aeron_driver_receiver_proxy_t *receiver_proxy = aeron_driver_receiver_proxy_for_channel(context, channel);
+
+    if (NULL == receiver_proxy)
+    {
+        return -1;
+    }
 
     if (aeron_alloc((void **)&_endpoint, sizeof(aeron_receive_channel_endpoint_t)) < 0)
     {
@@ -42,7 +60,7 @@ int aeron_receive_channel_endpoint_create(
     }
 
     if (aeron_data_packet_dispatcher_init(
-        &_endpoint->dispatcher, context->conductor_proxy, context->receiver_proxy->receiver) < 0)
+        &_endpoint->dispatcher, context->conductor_proxy, receiver_proxy->receiver) < 0)
     {
         return -1;
     }
@@ -76,6 +94,19 @@ int aeron_receive_channel_endpoint_create(
         return -1;
     }
 
+    if (aeron_uri_gso(&channel->uri, context->udp_gso) &&
+        aeron_udp_channel_transport_enable_gro(&_endpoint->transport) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
+    if (context->receiver_timestamps && aeron_udp_channel_transport_enable_timestamps(&_endpoint->transport) < 0)
+    {
+        aeron_receive_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
     _endpoint->transport.dispatch_clientd = _endpoint;
     _endpoint->has_receiver_released = false;
 
@@ -83,8 +114,9 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
     _endpoint->receiver_id = context->receiver_id;
-    _endpoint->receiver_proxy = context->receiver_proxy;
+    _endpoint->receiver_proxy = receiver_proxy;
 
+    _endpoint->has_shared_system_counters = context->receiver_shard_count > 1;
     _endpoint->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
     _endpoint->possible_ttl_asymmetry_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY);
@@ -206,6 +238,57 @@ int aeron_receive_channel_endpoint_send_nak(
     return bytes_sent;
 }
 
+int aeron_receive_channel_endpoint_send_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    aeron_loss_detector_gap_t *gaps,
+    size_t gap_count)
+{
+    uint8_t buffer[AERON_LOSS_DETECTOR_MAX_GAPS][sizeof(aeron_nak_header_t)];
+    struct iovec iov[AERON_LOSS_DETECTOR_MAX_GAPS];
+    struct mmsghdr mmsghdr[AERON_LOSS_DETECTOR_MAX_GAPS];
+    size_t vlen = gap_count < AERON_LOSS_DETECTOR_MAX_GAPS ? gap_count : AERON_LOSS_DETECTOR_MAX_GAPS;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        aeron_nak_header_t *nak_header = (aeron_nak_header_t *)buffer[i];
+
+        nak_header->frame_header.frame_length = sizeof(aeron_nak_header_t);
+        nak_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        nak_header->frame_header.flags = 0;
+        nak_header->frame_header.type = AERON_HDR_TYPE_NAK;
+        nak_header->session_id = session_id;
+        nak_header->stream_id = stream_id;
+        nak_header->term_id = gaps[i].term_id;
+        nak_header->term_offset = gaps[i].term_offset;
+        nak_header->length = (int32_t)gaps[i].length;
+
+        iov[i].iov_base = buffer[i];
+        iov[i].iov_len = sizeof(aeron_nak_header_t);
+        mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        mmsghdr[i].msg_hdr.msg_flags = 0;
+        mmsghdr[i].msg_hdr.msg_name = addr;
+        mmsghdr[i].msg_hdr.msg_namelen = AERON_ADDR_LEN(addr);
+        mmsghdr[i].msg_hdr.msg_control = NULL;
+        mmsghdr[i].msg_hdr.msg_controllen = 0;
+        mmsghdr[i].msg_len = 0;
+    }
+
+    int result = 0;
+    if (vlen > 0 && (result = aeron_udp_channel_transport_sendmmsg(&endpoint->transport, mmsghdr, vlen)) != (int)vlen)
+    {
+        if (result >= 0)
+        {
+            aeron_counter_increment(endpoint->short_sends_counter, 1);
+        }
+    }
+
+    return result;
+}
+
 int aeron_receive_channel_endpoint_send_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -252,7 +335,12 @@ int aeron_receive_channel_endpoint_send_rttm(
 }
 
 void aeron_receive_channel_endpoint_dispatch(
-    void *receiver_clientd, void *endpoint_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp)
 {
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)receiver_clientd;
     aeron_frame_header_t *frame_header = (aeron_frame_header_t *)buffer;
@@ -270,7 +358,7 @@ void aeron_receive_channel_endpoint_dispatch(
         case AERON_HDR_TYPE_DATA:
             if (length >= sizeof(aeron_data_header_t))
             {
-                if (aeron_receive_channel_endpoint_on_data(endpoint, buffer, length, addr) < 0)
+                if (aeron_receive_channel_endpoint_on_data(endpoint, buffer, length, addr, timestamp) < 0)
                 {
                     AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_data: %s", aeron_errmsg());
                 }
@@ -315,11 +403,16 @@ void aeron_receive_channel_endpoint_dispatch(
 }
 
 int aeron_receive_channel_endpoint_on_data(
-    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    aeron_receive_channel_endpoint_t *endpoint,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp)
 {
     aeron_data_header_t *data_header = (aeron_data_header_t *)buffer;
 
-    return aeron_data_packet_dispatcher_on_data(&endpoint->dispatcher, endpoint, data_header, buffer, length, addr);
+    return aeron_data_packet_dispatcher_on_data(
+        &endpoint->dispatcher, endpoint, data_header, buffer, length, addr, timestamp);
 }
 
 int aeron_receive_channel_endpoint_on_setup(
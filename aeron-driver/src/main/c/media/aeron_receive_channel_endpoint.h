@@ -23,6 +23,7 @@
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_driver_context.h"
 #include "aeron_system_counters.h"
+#include "aeron_loss_detector.h"
 
 typedef enum aeron_receive_channel_endpoint_status_enum
 {
@@ -56,6 +57,7 @@ typedef struct aeron_receive_channel_endpoint_stct
     aeron_driver_receiver_proxy_t *receiver_proxy;
     int64_t receiver_id;
     bool has_receiver_released;
+    bool has_shared_system_counters;
 
     int64_t *short_sends_counter;
     int64_t *possible_ttl_asymmetry_counter;
@@ -93,6 +95,14 @@ int aeron_receive_channel_endpoint_send_nak(
     int32_t term_offset,
     int32_t length);
 
+int aeron_receive_channel_endpoint_send_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    aeron_loss_detector_gap_t *gaps,
+    size_t gap_count);
+
 int aeron_receive_channel_endpoint_send_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -103,10 +113,19 @@ int aeron_receive_channel_endpoint_send_rttm(
     bool is_reply);
 
 void aeron_receive_channel_endpoint_dispatch(
-    void *receiver_clientd, void *endpoint_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp);
 
 int aeron_receive_channel_endpoint_on_data(
-    aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+    aeron_receive_channel_endpoint_t *endpoint,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp);
 
 int aeron_receive_channel_endpoint_on_setup(
     aeron_receive_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
@@ -44,6 +44,12 @@ int aeron_send_channel_endpoint_create(
     aeron_driver_context_t *context)
 {
     aeron_send_channel_endpoint_t *_endpoint = NULL;
+    aeron_driver_sender_proxy_t *sender_proxy = aeron_driver_sender_proxy_for_channel(context, channel);
+
+    if (NULL == sender_proxy)
+    {
+        return -1;
+    }
 
     if (aeron_alloc((void **)&_endpoint, sizeof(aeron_send_channel_endpoint_t)) < 0)
     {
@@ -71,6 +77,13 @@ int aeron_send_channel_endpoint_create(
         return -1;
     }
 
+    if (aeron_uri_gso(&channel->uri, context->udp_gso) &&
+        aeron_udp_channel_transport_enable_gso(&_endpoint->transport) < 0)
+    {
+        aeron_send_channel_endpoint_delete(NULL, _endpoint);
+        return -1;
+    }
+
     if (aeron_int64_to_ptr_hash_map_init(
         &_endpoint->publication_dispatch_map, 8, AERON_INT64_TO_PTR_HASH_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
@@ -79,6 +92,7 @@ int aeron_send_channel_endpoint_create(
     }
 
     _endpoint->transport.dispatch_clientd = _endpoint;
+    _endpoint->sender_proxy = sender_proxy;
     _endpoint->has_sender_released = false;
 
     _endpoint->channel_status.counter_id = status_indicator->counter_id;
@@ -160,7 +174,12 @@ int aeron_send_channel_endpoint_remove_publication(
 }
 
 void aeron_send_channel_endpoint_dispatch(
-    void *sender_clientd, void *endpoint_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
+    void *sender_clientd,
+    void *endpoint_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)sender_clientd;
     aeron_frame_header_t *frame_header = (aeron_frame_header_t *)buffer;
@@ -40,6 +40,7 @@ typedef struct aeron_send_channel_endpoint_stct
     aeron_udp_channel_transport_t transport;
     aeron_int64_to_ptr_hash_map_t publication_dispatch_map;
     aeron_counter_t channel_status;
+    aeron_driver_sender_proxy_t *sender_proxy;
     bool has_sender_released;
 }
 aeron_send_channel_endpoint_t;
@@ -65,7 +66,12 @@ int aeron_send_channel_endpoint_remove_publication(
     aeron_send_channel_endpoint_t *endpoint, aeron_network_publication_t *publication);
 
 void aeron_send_channel_endpoint_dispatch(
-    void *sender_clientd, void *endpoint_clientd, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
+    void *sender_clientd,
+    void *endpoint_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    struct timespec *timestamp);
 
 void aeron_send_channel_endpoint_on_nak(
     aeron_send_channel_endpoint_t *endpoint, uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
@@ -18,6 +18,7 @@
 #include <errno.h>
 #include <netdb.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "aeron_alloc.h"
 #include "util/aeron_strutil.h"
 #include "uri/aeron_uri.h"
@@ -310,3 +311,30 @@ void aeron_udp_channel_delete(aeron_udp_channel_t *channel)
 {
     aeron_free(channel);
 }
+
+int aeron_udp_channel_shard_index(aeron_udp_channel_t *channel, size_t shard_count)
+{
+    if (shard_count <= 1)
+    {
+        return 0;
+    }
+
+    if (NULL != channel->uri.params.udp.shard_key)
+    {
+        char *end = NULL;
+        unsigned long long shard = strtoull(channel->uri.params.udp.shard_key, &end, 10);
+
+        if (end == channel->uri.params.udp.shard_key || '\0' != *end || shard >= shard_count)
+        {
+            aeron_set_err(
+                EINVAL,
+                "%s=%s not in range of %zu shards: %s",
+                AERON_UDP_CHANNEL_SHARD_KEY, channel->uri.params.udp.shard_key, shard_count, channel->original_uri);
+            return -1;
+        }
+
+        return (int)shard;
+    }
+
+    return (int)(aeron_fnv_64a_buf((uint8_t *)channel->canonical_form, channel->canonical_length) % shard_count);
+}
@@ -41,4 +41,11 @@ aeron_udp_channel_t;
 int aeron_udp_channel_parse(const char *uri, size_t uri_length, aeron_udp_channel_t **channel);
 void aeron_udp_channel_delete(aeron_udp_channel_t *channel);
 
+/*
+ * Index of the driver agent shard that owns endpoints of this channel. Given explicitly by the shard param of the URI,
+ * otherwise by a hash of the canonical form so all channels to the same endpoint land on the same shard.
+ * Returns -1 if the shard param is not a shard in range.
+ */
+int aeron_udp_channel_shard_index(aeron_udp_channel_t *channel, size_t shard_count);
+
 #endif //AERON_AERON_UDP_CHANNEL_H
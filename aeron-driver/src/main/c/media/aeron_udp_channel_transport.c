@@ -25,10 +25,12 @@
 #include <net/if.h>
 #include <fcntl.h>
 #include <netinet/ip.h>
+#include <netinet/udp.h>
 #include <errno.h>
 #include "util/aeron_error.h"
 #include "util/aeron_netutil.h"
 #include "aeron_udp_channel_transport.h"
+#include "media/aeron_udp_transport_io_uring.h"
 
 #if !defined(HAVE_RECVMMSG)
 struct mmsghdr
@@ -52,6 +54,10 @@ int aeron_udp_channel_transport_init(
     struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)bind_addr;
 
     transport->fd = -1;
+    transport->io_uring = NULL;
+    transport->gso_enabled = false;
+    transport->gro_enabled = false;
+    transport->timestamps_enabled = false;
     if ((transport->fd = socket(bind_addr->ss_family, SOCK_DGRAM, 0)) < 0)
     {
         goto error;
@@ -234,6 +240,104 @@ int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
     return 0;
 }
 
+int aeron_udp_channel_transport_enable_gso(aeron_udp_channel_transport_t *transport)
+{
+#if defined(HAVE_UDP_GSO)
+    transport->gso_enabled = true;
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "UDP_SEGMENT not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_enable_gro(aeron_udp_channel_transport_t *transport)
+{
+#if defined(HAVE_UDP_GSO)
+    int enable = 1;
+
+    if (setsockopt(transport->fd, SOL_UDP, UDP_GRO, &enable, sizeof(enable)) < 0)
+    {
+        aeron_set_err(errno, "setsockopt(UDP_GRO): %s", strerror(errno));
+        return -1;
+    }
+
+    transport->gro_enabled = true;
+    return 0;
+#else
+    aeron_set_err(ENOTSUP, "%s", "UDP_GRO not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_enable_timestamps(aeron_udp_channel_transport_t *transport)
+{
+    int enable = 1;
+
+    if (setsockopt(transport->fd, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0)
+    {
+        aeron_set_err(errno, "setsockopt(SO_TIMESTAMPNS): %s", strerror(errno));
+        return -1;
+    }
+
+    transport->timestamps_enabled = true;
+    return 0;
+}
+
+int aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    uint8_t *buffer,
+    size_t length,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    size_t segment_length = length;
+    struct timespec timestamp_storage;
+    struct timespec *timestamp = NULL;
+
+    if ((transport->gro_enabled || transport->timestamps_enabled) && msghdr->msg_controllen > 0)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msghdr); NULL != cmsg; cmsg = CMSG_NXTHDR(msghdr, cmsg))
+        {
+#if defined(HAVE_UDP_GSO)
+            if (SOL_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+            {
+                int gso_size;
+
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                if (gso_size > 0)
+                {
+                    segment_length = (size_t)gso_size;
+                }
+            }
+#endif
+            if (SOL_SOCKET == cmsg->cmsg_level && SCM_TIMESTAMPNS == cmsg->cmsg_type)
+            {
+                memcpy(&timestamp_storage, CMSG_DATA(cmsg), sizeof(timestamp_storage));
+                timestamp = &timestamp_storage;
+            }
+        }
+    }
+
+    int count = 0;
+    for (size_t offset = 0; offset < length; offset += segment_length)
+    {
+        const size_t remaining = length - offset;
+
+        recv_func(
+            clientd,
+            transport->dispatch_clientd,
+            buffer + offset,
+            remaining < segment_length ? remaining : segment_length,
+            msghdr->msg_name,
+            timestamp);
+        count++;
+    }
+
+    return count;
+}
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
@@ -265,12 +369,13 @@ int aeron_udp_channel_transport_recvmmsg(
     {
         for (size_t i = 0, length = result; i < length; i++)
         {
-            recv_func(
-                clientd,
-                transport->dispatch_clientd,
+            aeron_udp_channel_transport_dispatch(
+                transport,
+                &msgvec[i].msg_hdr,
                 msgvec[i].msg_hdr.msg_iov[0].iov_base,
                 msgvec[i].msg_len,
-                msgvec[i].msg_hdr.msg_name);
+                recv_func,
+                clientd);
         }
 
         return result;
@@ -300,12 +405,13 @@ int aeron_udp_channel_transport_recvmmsg(
         }
 
         msgvec[i].msg_len = (unsigned int)result;
-        recv_func(
-            clientd,
-            transport->dispatch_clientd,
+        aeron_udp_channel_transport_dispatch(
+            transport,
+            &msgvec[i].msg_hdr,
             msgvec[i].msg_hdr.msg_iov[0].iov_base,
             msgvec[i].msg_len,
-            msgvec[i].msg_hdr.msg_name);
+            recv_func,
+            clientd);
         work_count++;
     }
 
@@ -318,6 +424,13 @@ int aeron_udp_channel_transport_sendmmsg(
     struct mmsghdr *msgvec,
     size_t vlen)
 {
+#if defined(HAVE_IO_URING)
+    if (NULL != transport->io_uring)
+    {
+        return aeron_udp_transport_io_uring_sendmmsg(transport->io_uring, transport->fd, msgvec, vlen);
+    }
+#endif
+
 #if defined(HAVE_RECVMMSG)
     int sendmmsg_result = sendmmsg(transport->fd, msgvec, vlen, 0);
     if (sendmmsg_result < 0)
@@ -19,15 +19,40 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <time.h>
 
 #include "aeron_driver_common.h"
 
 typedef int aeron_fd_t;
 
+/*
+ * Space reserved for ancillary data on receive, e.g. the UDP_GRO segment size.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH (64)
+
+/*
+ * Largest payload a single UDP_SEGMENT send may carry, below the 64KB IP datagram limit.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_LENGTH (63 * 1024)
+#define AERON_UDP_CHANNEL_TRANSPORT_GSO_MAX_SEGMENTS (64)
+
+typedef union aeron_udp_channel_transport_control_un
+{
+    size_t align;
+    uint8_t buffer[AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH];
+}
+aeron_udp_channel_transport_control_t;
+
+struct aeron_udp_transport_io_uring_stct;
+
 typedef struct aeron_udp_channel_transport_stct
 {
     aeron_fd_t fd;
     void *dispatch_clientd;
+    struct aeron_udp_transport_io_uring_stct *io_uring;
+    bool gso_enabled;
+    bool gro_enabled;
+    bool timestamps_enabled;
 }
 aeron_udp_channel_transport_t;
 
@@ -44,7 +69,28 @@ int aeron_udp_channel_transport_init(
 
 int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport);
 
-typedef void (*aeron_udp_transport_recv_func_t)(void *, void *, uint8_t *, size_t, struct sockaddr_storage *);
+int aeron_udp_channel_transport_enable_gso(aeron_udp_channel_transport_t *transport);
+int aeron_udp_channel_transport_enable_gro(aeron_udp_channel_transport_t *transport);
+int aeron_udp_channel_transport_enable_timestamps(aeron_udp_channel_transport_t *transport);
+
+/*
+ * The timestamp is the kernel receive time (CLOCK_REALTIME) when receive timestamps are enabled, otherwise NULL.
+ */
+typedef void (*aeron_udp_transport_recv_func_t)(
+    void *, void *, uint8_t *, size_t, struct sockaddr_storage *, struct timespec *);
+
+/*
+ * Dispatch a received datagram, splitting it back into its original datagrams when the kernel coalesced them
+ * with UDP_GRO. The source address is taken from msghdr->msg_name and any ancillary data, segment size and kernel
+ * receive timestamp, from msghdr->msg_control.
+ */
+int aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    uint8_t *buffer,
+    size_t length,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
 
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
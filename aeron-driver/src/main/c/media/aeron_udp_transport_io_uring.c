@@ -0,0 +1,655 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#if defined(HAVE_IO_URING)
+
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/socket.h>
+#include "util/aeron_error.h"
+#include "concurrent/aeron_atomic.h"
+#include "aeron_alloc.h"
+#include "media/aeron_udp_transport_io_uring.h"
+
+#if !defined(HAVE_RECVMMSG)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA (1)
+#define AERON_UDP_TRANSPORT_IO_URING_BATCH_SHIFT (32)
+#define AERON_UDP_TRANSPORT_IO_URING_INDEX_MASK (0xFFFFFFFFULL)
+
+typedef struct aeron_udp_transport_io_uring_removal_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    bool is_removed;
+    bool is_cancel_complete;
+    int cancel_result;
+}
+aeron_udp_transport_io_uring_removal_t;
+
+static int aeron_io_uring_enter(aeron_io_uring_t *ring, unsigned int to_submit, unsigned int min_complete)
+{
+    ring->enter_count++;
+
+    int result = (int)syscall(
+        __NR_io_uring_enter, ring->ring_fd, to_submit, min_complete, IORING_ENTER_GETEVENTS, NULL, 0);
+
+    if (result < 0)
+    {
+        int errcode = errno;
+
+        if (EINTR == errcode || EAGAIN == errcode || EBUSY == errcode)
+        {
+            return 0;
+        }
+
+        aeron_set_err(errcode, "io_uring_enter: %s", strerror(errcode));
+        return -1;
+    }
+
+    return result;
+}
+
+static void *aeron_io_uring_mmap(aeron_io_uring_t *ring, size_t length, off_t offset)
+{
+    void *addr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, offset);
+
+    if (MAP_FAILED == addr)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "io_uring mmap: %s", strerror(errcode));
+        return NULL;
+    }
+
+    return addr;
+}
+
+static int aeron_io_uring_init(aeron_io_uring_t *ring, unsigned int entries)
+{
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(aeron_io_uring_t));
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+
+    if ((ring->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "io_uring_setup: %s", strerror(errcode));
+        return -1;
+    }
+
+    ring->sq_entries = params.sq_entries;
+    ring->sq_ring_length = params.sq_off.array + (params.sq_entries * sizeof(unsigned int));
+    ring->cq_ring_length = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ring->sqes_length = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    if ((ring->sq_ring_addr = aeron_io_uring_mmap(ring, ring->sq_ring_length, IORING_OFF_SQ_RING)) == NULL ||
+        (ring->cq_ring_addr = aeron_io_uring_mmap(ring, ring->cq_ring_length, IORING_OFF_CQ_RING)) == NULL ||
+        (ring->sqes = aeron_io_uring_mmap(ring, ring->sqes_length, IORING_OFF_SQES)) == NULL)
+    {
+        return -1;
+    }
+
+    uint8_t *sq_ring = (uint8_t *)ring->sq_ring_addr;
+    uint8_t *cq_ring = (uint8_t *)ring->cq_ring_addr;
+
+    ring->sq_head = (unsigned int *)(sq_ring + params.sq_off.head);
+    ring->sq_tail = (unsigned int *)(sq_ring + params.sq_off.tail);
+    ring->sq_ring_mask = (unsigned int *)(sq_ring + params.sq_off.ring_mask);
+    ring->sq_flags = (unsigned int *)(sq_ring + params.sq_off.flags);
+    ring->sq_array = (unsigned int *)(sq_ring + params.sq_off.array);
+    ring->cq_head = (unsigned int *)(cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned int *)(cq_ring + params.cq_off.tail);
+    ring->cq_ring_mask = (unsigned int *)(cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_ring + params.cq_off.cqes);
+
+    for (unsigned int i = 0; i < params.sq_entries; i++)
+    {
+        ring->sq_array[i] = i;
+    }
+
+    return 0;
+}
+
+static void aeron_io_uring_close(aeron_io_uring_t *ring)
+{
+    if (NULL != ring->sqes)
+    {
+        munmap(ring->sqes, ring->sqes_length);
+    }
+
+    if (NULL != ring->cq_ring_addr)
+    {
+        munmap(ring->cq_ring_addr, ring->cq_ring_length);
+    }
+
+    if (NULL != ring->sq_ring_addr)
+    {
+        munmap(ring->sq_ring_addr, ring->sq_ring_length);
+    }
+
+    if (ring->ring_fd >= 0)
+    {
+        close(ring->ring_fd);
+    }
+
+    ring->ring_fd = -1;
+}
+
+static struct io_uring_sqe *aeron_io_uring_get_sqe(aeron_io_uring_t *ring)
+{
+    unsigned int head;
+    AERON_GET_VOLATILE(head, *(volatile unsigned int *)ring->sq_head);
+
+    const unsigned int next = *ring->sq_tail + ring->to_submit;
+
+    if ((next - head) >= ring->sq_entries)
+    {
+        return NULL;
+    }
+
+    struct io_uring_sqe *sqe = &ring->sqes[next & *ring->sq_ring_mask];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->to_submit++;
+
+    return sqe;
+}
+
+static int aeron_io_uring_submit(aeron_io_uring_t *ring, unsigned int min_complete)
+{
+    unsigned int head;
+    AERON_GET_VOLATILE(head, *(volatile unsigned int *)ring->sq_head);
+
+    const unsigned int tail = *ring->sq_tail + ring->to_submit;
+
+    AERON_PUT_ORDERED(*(volatile unsigned int *)ring->sq_tail, tail);
+    ring->to_submit = 0;
+
+    return aeron_io_uring_enter(ring, tail - head, min_complete);
+}
+
+static bool aeron_io_uring_needs_enter(aeron_io_uring_t *ring)
+{
+    unsigned int sq_flags;
+    AERON_GET_VOLATILE(sq_flags, *(volatile unsigned int *)ring->sq_flags);
+
+    return ring->to_submit > 0 || (sq_flags & IORING_SQ_TASKRUN);
+}
+
+static void aeron_udp_transport_io_uring_recycle_buffer(aeron_udp_transport_io_uring_t *io_uring, uint16_t bid)
+{
+    struct io_uring_buf *buf =
+        &io_uring->buf_ring->bufs[io_uring->buf_ring_tail & (AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT - 1)];
+
+    buf->addr = (uint64_t)(uintptr_t)(io_uring->recv_buffers + (bid * AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_LENGTH));
+    buf->len = (uint32_t)AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_LENGTH;
+    buf->bid = bid;
+    io_uring->buf_ring_tail++;
+}
+
+static void aeron_udp_transport_io_uring_publish_buffers(aeron_udp_transport_io_uring_t *io_uring)
+{
+    AERON_PUT_ORDERED(*(volatile uint16_t *)&io_uring->buf_ring->tail, io_uring->buf_ring_tail);
+}
+
+static int aeron_udp_transport_io_uring_arm_recv(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    struct io_uring_sqe *sqe = aeron_io_uring_get_sqe(&io_uring->recv_ring);
+
+    if (NULL == sqe)
+    {
+        if (aeron_io_uring_submit(&io_uring->recv_ring, 0) < 0)
+        {
+            return -1;
+        }
+
+        if ((sqe = aeron_io_uring_get_sqe(&io_uring->recv_ring)) == NULL)
+        {
+            aeron_set_err(EBUSY, "%s", "io_uring submission queue full");
+            return -1;
+        }
+    }
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = transport->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&io_uring->recv_msghdr;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+    sqe->user_data = (uint64_t)(uintptr_t)transport;
+
+    return 0;
+}
+
+static bool aeron_udp_transport_io_uring_is_transient(int32_t res)
+{
+    return -ENOBUFS == res || -EINTR == res || -EAGAIN == res;
+}
+
+static int aeron_udp_transport_io_uring_on_recv_cqe(
+    aeron_udp_transport_io_uring_t *io_uring,
+    uint64_t user_data,
+    int32_t res,
+    uint32_t flags,
+    aeron_udp_transport_io_uring_removal_t *removal)
+{
+    if (AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA == user_data)
+    {
+        if (NULL != removal)
+        {
+            removal->is_cancel_complete = true;
+            removal->cancel_result = res;
+        }
+
+        return 0;
+    }
+
+    aeron_udp_channel_transport_t *transport = (aeron_udp_channel_transport_t *)(uintptr_t)user_data;
+    const bool is_removing = NULL != removal && removal->transport == transport;
+    int work_count = 0;
+
+    if (flags & IORING_CQE_F_BUFFER)
+    {
+        const uint16_t bid = (uint16_t)(flags >> IORING_CQE_BUFFER_SHIFT);
+
+        if (res > 0 && !is_removing && NULL != io_uring->recv_func)
+        {
+            uint8_t *buffer = io_uring->recv_buffers + (bid * AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_LENGTH);
+            struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buffer;
+
+            if (0 == (out->flags & MSG_TRUNC))
+            {
+                uint8_t *name = buffer + sizeof(struct io_uring_recvmsg_out);
+                uint8_t *control = name + io_uring->recv_msghdr.msg_namelen;
+                uint8_t *payload = control + io_uring->recv_msghdr.msg_controllen;
+                struct msghdr msghdr;
+
+                memset(&msghdr, 0, sizeof(msghdr));
+                msghdr.msg_name = name;
+                msghdr.msg_control = control;
+                msghdr.msg_controllen = out->controllen;
+
+                aeron_udp_channel_transport_dispatch(
+                    transport, &msghdr, payload, out->payloadlen, io_uring->recv_func, io_uring->recv_clientd);
+                work_count = 1;
+            }
+        }
+
+        aeron_udp_transport_io_uring_recycle_buffer(io_uring, bid);
+    }
+
+    if (0 == (flags & IORING_CQE_F_MORE))
+    {
+        if (is_removing)
+        {
+            removal->is_removed = true;
+        }
+        else if (res < 0 && !aeron_udp_transport_io_uring_is_transient(res))
+        {
+            /* re-arming would only fail the same way on every poll, so the transport stops receiving */
+            aeron_set_err(-res, "io_uring recvmsg fd=%d: %s", transport->fd, strerror(-res));
+            return -1;
+        }
+        else if (aeron_udp_transport_io_uring_arm_recv(io_uring, transport) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return work_count;
+}
+
+static int aeron_udp_transport_io_uring_reap(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_transport_io_uring_removal_t *removal)
+{
+    aeron_io_uring_t *ring = &io_uring->recv_ring;
+    int work_count = 0, result = 0;
+    unsigned int head = *ring->cq_head, tail;
+
+    AERON_GET_VOLATILE(tail, *(volatile unsigned int *)ring->cq_tail);
+
+    for (; head != tail; head++)
+    {
+        struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_ring_mask];
+
+        if ((result = aeron_udp_transport_io_uring_on_recv_cqe(
+            io_uring, cqe->user_data, cqe->res, cqe->flags, removal)) < 0)
+        {
+            head++;
+            break;
+        }
+
+        work_count += result;
+    }
+
+    AERON_PUT_ORDERED(*(volatile unsigned int *)ring->cq_head, head);
+    aeron_udp_transport_io_uring_publish_buffers(io_uring);
+
+    return result < 0 ? -1 : work_count;
+}
+
+int aeron_udp_transport_io_uring_init(aeron_udp_transport_io_uring_t *io_uring)
+{
+    memset(io_uring, 0, sizeof(aeron_udp_transport_io_uring_t));
+    io_uring->recv_ring.ring_fd = -1;
+    io_uring->send_ring.ring_fd = -1;
+
+    if (aeron_io_uring_init(&io_uring->recv_ring, AERON_UDP_TRANSPORT_IO_URING_RECV_RING_ENTRIES) < 0 ||
+        aeron_io_uring_init(&io_uring->send_ring, AERON_UDP_TRANSPORT_IO_URING_SEND_RING_ENTRIES) < 0)
+    {
+        aeron_udp_transport_io_uring_close(io_uring);
+        return -1;
+    }
+
+    io_uring->buf_ring_length = sizeof(struct io_uring_buf) * AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT;
+
+    int result;
+    if ((result = posix_memalign(
+        (void **)&io_uring->buf_ring, (size_t)sysconf(_SC_PAGESIZE), io_uring->buf_ring_length)) != 0)
+    {
+        io_uring->buf_ring = NULL;
+        aeron_set_err(result, "could not allocate io_uring buffer ring: %s", strerror(result));
+        aeron_udp_transport_io_uring_close(io_uring);
+        return -1;
+    }
+
+    memset(io_uring->buf_ring, 0, io_uring->buf_ring_length);
+
+    if (aeron_alloc(
+        (void **)&io_uring->recv_buffers,
+        AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT * AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_LENGTH) < 0)
+    {
+        aeron_udp_transport_io_uring_close(io_uring);
+        return -1;
+    }
+
+    struct io_uring_buf_reg reg;
+
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)io_uring->buf_ring;
+    reg.ring_entries = AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT;
+    reg.bgid = AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+
+    if (syscall(__NR_io_uring_register, io_uring->recv_ring.ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "io_uring_register(IORING_REGISTER_PBUF_RING): %s", strerror(errcode));
+        aeron_udp_transport_io_uring_close(io_uring);
+        return -1;
+    }
+
+    for (uint16_t i = 0; i < AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT; i++)
+    {
+        aeron_udp_transport_io_uring_recycle_buffer(io_uring, i);
+    }
+
+    aeron_udp_transport_io_uring_publish_buffers(io_uring);
+
+    io_uring->recv_msghdr.msg_namelen = sizeof(struct sockaddr_storage);
+    io_uring->recv_msghdr.msg_controllen = sizeof(aeron_udp_channel_transport_control_t);
+
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_close(aeron_udp_transport_io_uring_t *io_uring)
+{
+    aeron_io_uring_close(&io_uring->recv_ring);
+    aeron_io_uring_close(&io_uring->send_ring);
+
+    free(io_uring->buf_ring);
+    io_uring->buf_ring = NULL;
+    aeron_free(io_uring->recv_buffers);
+    io_uring->recv_buffers = NULL;
+
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_add(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    if (aeron_udp_transport_io_uring_arm_recv(io_uring, transport) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_io_uring_submit(&io_uring->recv_ring, 0) < 0 ? -1 : 0;
+}
+
+int aeron_udp_transport_io_uring_remove(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_io_uring_removal_t removal =
+        {
+            .transport = transport,
+            .is_removed = false,
+            .is_cancel_complete = false,
+            .cancel_result = 0
+        };
+
+    struct io_uring_sqe *sqe = aeron_io_uring_get_sqe(&io_uring->recv_ring);
+
+    if (NULL == sqe)
+    {
+        if (aeron_io_uring_submit(&io_uring->recv_ring, 0) < 0 ||
+            (sqe = aeron_io_uring_get_sqe(&io_uring->recv_ring)) == NULL)
+        {
+            return -1;
+        }
+    }
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)transport;
+    sqe->user_data = AERON_UDP_TRANSPORT_IO_URING_CANCEL_USER_DATA;
+
+    /* other transports may complete while draining, those are dispatched as they would be on poll */
+    while (!removal.is_removed && !(removal.is_cancel_complete && -ENOENT == removal.cancel_result))
+    {
+        if (aeron_io_uring_submit(&io_uring->recv_ring, 1) < 0 ||
+            aeron_udp_transport_io_uring_reap(io_uring, &removal) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_udp_transport_io_uring_poll(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_transport_recv_func_t recv_func, void *clientd)
+{
+    aeron_io_uring_t *ring = &io_uring->recv_ring;
+
+    io_uring->recv_func = recv_func;
+    io_uring->recv_clientd = clientd;
+
+    if (aeron_io_uring_needs_enter(ring) && aeron_io_uring_submit(ring, 0) < 0)
+    {
+        return -1;
+    }
+
+    int work_count = aeron_udp_transport_io_uring_reap(io_uring, NULL);
+
+    if (work_count >= 0 && ring->to_submit > 0 && aeron_io_uring_submit(ring, 0) < 0)
+    {
+        return -1;
+    }
+
+    return work_count;
+}
+
+static size_t aeron_udp_transport_io_uring_reap_sends(aeron_io_uring_t *ring, uint64_t batch, int32_t *results)
+{
+    size_t completed = 0;
+    unsigned int head = *ring->cq_head, tail;
+
+    AERON_GET_VOLATILE(tail, *(volatile unsigned int *)ring->cq_tail);
+
+    for (; head != tail; head++)
+    {
+        struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_ring_mask];
+
+        /* completions of an earlier batch that returned early are dropped */
+        if ((cqe->user_data & ~AERON_UDP_TRANSPORT_IO_URING_INDEX_MASK) == batch)
+        {
+            results[cqe->user_data & AERON_UDP_TRANSPORT_IO_URING_INDEX_MASK] = cqe->res;
+            completed++;
+        }
+    }
+
+    AERON_PUT_ORDERED(*(volatile unsigned int *)ring->cq_head, head);
+
+    return completed;
+}
+
+int aeron_udp_transport_io_uring_sendmmsg(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_fd_t fd, struct mmsghdr *msgvec, size_t vlen)
+{
+    aeron_io_uring_t *ring = &io_uring->send_ring;
+    int32_t results[AERON_UDP_TRANSPORT_IO_URING_SEND_RING_ENTRIES];
+    const uint64_t batch = (uint64_t)(++io_uring->send_batch_id) << AERON_UDP_TRANSPORT_IO_URING_BATCH_SHIFT;
+    struct io_uring_sqe *last_sqe = NULL;
+    size_t length = vlen < AERON_UDP_TRANSPORT_IO_URING_SEND_RING_ENTRIES ?
+        vlen : AERON_UDP_TRANSPORT_IO_URING_SEND_RING_ENTRIES;
+    size_t submitted = 0, completed = 0;
+    unsigned int retries = 0;
+    bool is_failed = false;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        struct io_uring_sqe *sqe = aeron_io_uring_get_sqe(ring);
+
+        if (NULL == sqe)
+        {
+            length = i;
+            break;
+        }
+
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = fd;
+        sqe->addr = (uint64_t)(uintptr_t)&msgvec[i].msg_hdr;
+        sqe->len = 1;
+        /*
+         * Linked so frames go out in order. Unlike sendmmsg, which stops at a failed datagram and returns the count
+         * sent before it, a failure such as EAGAIN on a full socket buffer completes every later frame in the batch
+         * with ECANCELED. Only the frames before the failure are reported as sent so the caller retries the rest.
+         */
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->user_data = batch | i;
+        last_sqe = sqe;
+    }
+
+    if (0 == length)
+    {
+        aeron_set_err(EBUSY, "%s", "io_uring send submission queue full");
+        return -1;
+    }
+
+    last_sqe->flags = 0;
+
+    const unsigned int tail = *ring->sq_tail + ring->to_submit;
+
+    AERON_PUT_ORDERED(*(volatile unsigned int *)ring->sq_tail, tail);
+    ring->to_submit = 0;
+
+    while (completed < length && !is_failed)
+    {
+        unsigned int head;
+        AERON_GET_VOLATILE(head, *(volatile unsigned int *)ring->sq_head);
+
+        /* the rest of a partially submitted batch only goes once the first part is done, to keep the order */
+        const unsigned int to_submit = completed == submitted ? tail - head : 0;
+        const unsigned int min_complete = (unsigned int)(0 == to_submit ? submitted - completed : length - completed);
+
+        /*
+         * Submitting and waiting for the whole batch in the one io_uring_enter costs the same single syscall as
+         * sendmmsg. The kernel does not wait when it accepts only part of a submission so that part is waited on
+         * before the rest is submitted.
+         */
+        int result = aeron_io_uring_enter(ring, to_submit, min_complete);
+
+        if (to_submit > 0)
+        {
+            if (result > 0)
+            {
+                submitted += (size_t)result;
+                retries = 0;
+            }
+            else if (result < 0 || ++retries > AERON_UDP_TRANSPORT_IO_URING_SUBMIT_RETRIES)
+            {
+                if (0 == result)
+                {
+                    aeron_set_err(EBUSY, "%s", "io_uring send submission not accepted");
+                }
+
+                /* the kernel only reads the submission queue within io_uring_enter so the rest can be taken back */
+                AERON_GET_VOLATILE(head, *(volatile unsigned int *)ring->sq_head);
+                AERON_PUT_ORDERED(*(volatile unsigned int *)ring->sq_tail, head);
+                is_failed = true;
+            }
+        }
+        else if (result < 0)
+        {
+            /* any still in flight are dropped when reaped by a later batch */
+            is_failed = true;
+            break;
+        }
+
+        completed += aeron_udp_transport_io_uring_reap_sends(ring, batch, results);
+    }
+
+    int sent = 0;
+    for (size_t i = 0; i < completed; i++)
+    {
+        if (results[i] < 0)
+        {
+            if (0 == i)
+            {
+                aeron_set_err(-results[i], "sendmsg: %s", strerror(-results[i]));
+                return -1;
+            }
+
+            break;
+        }
+
+        msgvec[i].msg_len = (unsigned int)results[i];
+        sent++;
+    }
+
+    return 0 == sent && is_failed ? -1 : sent;
+}
+
+#endif
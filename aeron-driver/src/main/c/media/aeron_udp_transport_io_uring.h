@@ -0,0 +1,110 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_UDP_TRANSPORT_IO_URING_H
+#define AERON_AERON_UDP_TRANSPORT_IO_URING_H
+
+#if defined(HAVE_IO_URING)
+
+#include <linux/io_uring.h>
+#include "media/aeron_udp_channel_transport.h"
+
+#define AERON_UDP_TRANSPORT_IO_URING_RECV_RING_ENTRIES (256)
+#define AERON_UDP_TRANSPORT_IO_URING_SEND_RING_ENTRIES (64)
+#define AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_COUNT (64)
+#define AERON_UDP_TRANSPORT_IO_URING_MAX_UDP_PACKET_LENGTH (64 * 1024)
+#define AERON_UDP_TRANSPORT_IO_URING_BUFFER_GROUP_ID (0)
+#define AERON_UDP_TRANSPORT_IO_URING_SUBMIT_RETRIES (16)
+
+/*
+ * Each provided receive buffer holds the io_uring_recvmsg_out header, the source address, ancillary data, and the
+ * datagram.
+ */
+#define AERON_UDP_TRANSPORT_IO_URING_RECV_BUFFER_LENGTH \
+    (sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_storage) + \
+    sizeof(aeron_udp_channel_transport_control_t) + AERON_UDP_TRANSPORT_IO_URING_MAX_UDP_PACKET_LENGTH)
+
+typedef struct aeron_io_uring_stct
+{
+    int ring_fd;
+    unsigned int sq_entries;
+    unsigned int to_submit;
+
+    unsigned int *sq_head;
+    unsigned int *sq_tail;
+    unsigned int *sq_ring_mask;
+    unsigned int *sq_flags;
+    unsigned int *sq_array;
+    struct io_uring_sqe *sqes;
+
+    unsigned int *cq_head;
+    unsigned int *cq_tail;
+    unsigned int *cq_ring_mask;
+    struct io_uring_cqe *cqes;
+
+    void *sq_ring_addr;
+    size_t sq_ring_length;
+    void *cq_ring_addr;
+    size_t cq_ring_length;
+    size_t sqes_length;
+
+    /* io_uring_enter calls made on the ring, to measure syscalls per send batch or poll */
+    uint64_t enter_count;
+}
+aeron_io_uring_t;
+
+/*
+ * A receive ring keeps a multishot recvmsg posted on every transport, drawing from a shared ring of provided
+ * buffers, so polling all endpoints needs at most one io_uring_enter. A separate send ring submits batches of
+ * linked sendmsg requests and waits for them in the same io_uring_enter so callers keep the synchronous, in order,
+ * sendmmsg semantics for one syscall per batch. A failed send cancels the rest of its batch rather than leaving a
+ * partial count as sendmmsg does. Each batch tags its completions with its own id so any left over from a failed
+ * batch are not counted by the next.
+ */
+typedef struct aeron_udp_transport_io_uring_stct
+{
+    aeron_io_uring_t recv_ring;
+    aeron_io_uring_t send_ring;
+
+    struct io_uring_buf_ring *buf_ring;
+    size_t buf_ring_length;
+    uint8_t *recv_buffers;
+    uint16_t buf_ring_tail;
+    uint32_t send_batch_id;
+
+    struct msghdr recv_msghdr;
+    aeron_udp_transport_recv_func_t recv_func;
+    void *recv_clientd;
+}
+aeron_udp_transport_io_uring_t;
+
+int aeron_udp_transport_io_uring_init(aeron_udp_transport_io_uring_t *io_uring);
+int aeron_udp_transport_io_uring_close(aeron_udp_transport_io_uring_t *io_uring);
+
+int aeron_udp_transport_io_uring_add(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport);
+int aeron_udp_transport_io_uring_remove(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_io_uring_poll(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_udp_transport_recv_func_t recv_func, void *clientd);
+
+int aeron_udp_transport_io_uring_sendmmsg(
+    aeron_udp_transport_io_uring_t *io_uring, aeron_fd_t fd, struct mmsghdr *msgvec, size_t vlen);
+
+#endif
+
+#endif //AERON_AERON_UDP_TRANSPORT_IO_URING_H
@@ -15,16 +15,44 @@
  */
 
 #include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include "util/aeron_error.h"
 #include "util/aeron_arrayutil.h"
 #include "aeron_alloc.h"
 #include "media/aeron_udp_transport_poller.h"
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
+int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller, bool use_io_uring)
 {
     poller->transports.array = NULL;
     poller->transports.length = 0;
     poller->transports.capacity = 0;
 
+#if defined(HAVE_IO_URING)
+    poller->io_uring = NULL;
+
+    if (use_io_uring)
+    {
+        if (aeron_alloc((void **)&poller->io_uring, sizeof(aeron_udp_transport_io_uring_t)) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_udp_transport_io_uring_init(poller->io_uring) < 0)
+        {
+            aeron_free(poller->io_uring);
+            poller->io_uring = NULL;
+            return -1;
+        }
+    }
+#else
+    if (use_io_uring)
+    {
+        aeron_set_err(ENOTSUP, "%s", "io_uring UDP transport not supported on this platform");
+        return -1;
+    }
+#endif
+
 #if defined(HAVE_EPOLL)
     if ((poller->epoll_fd = epoll_create1(0)) < 0)
     {
@@ -41,6 +69,15 @@ int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller)
 
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller)
 {
+#if defined(HAVE_IO_URING)
+    if (NULL != poller->io_uring)
+    {
+        aeron_udp_transport_io_uring_close(poller->io_uring);
+        aeron_free(poller->io_uring);
+        poller->io_uring = NULL;
+    }
+#endif
+
     aeron_free(poller->transports.array);
 #if defined(HAVE_EPOLL)
     close(poller->epoll_fd);
@@ -64,6 +101,21 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
 
     poller->transports.array[index].transport = transport;
 
+#if defined(HAVE_IO_URING)
+    if (NULL != poller->io_uring)
+    {
+        if (aeron_udp_transport_io_uring_add(poller->io_uring, transport) < 0)
+        {
+            return -1;
+        }
+
+        transport->io_uring = poller->io_uring;
+        poller->transports.length++;
+
+        return 0;
+    }
+#endif
+
 #if defined(HAVE_EPOLL)
     size_t new_capacity = poller->transports.capacity;
 
@@ -123,6 +175,18 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
 
     if (index >= 0)
     {
+#if defined(HAVE_IO_URING)
+        if (NULL != poller->io_uring)
+        {
+            if (aeron_udp_transport_io_uring_remove(poller->io_uring, transport) < 0)
+            {
+                return -1;
+            }
+
+            transport->io_uring = NULL;
+        }
+#endif
+
         if (aeron_array_remove(
             (uint8_t **)&poller->transports.array,
             sizeof(aeron_udp_channel_transport_entry_t),
@@ -132,6 +196,14 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
             return -1;
         }
 
+#if defined(HAVE_IO_URING)
+        if (NULL != poller->io_uring)
+        {
+            poller->transports.length--;
+            return 0;
+        }
+#endif
+
 #if defined(HAVE_EPOLL)
         if (aeron_array_remove(
             (uint8_t **)&poller->epoll_events,
@@ -179,6 +251,13 @@ int aeron_udp_transport_poller_poll(
 {
     int work_count = 0;
 
+#if defined(HAVE_IO_URING)
+    if (NULL != poller->io_uring)
+    {
+        return aeron_udp_transport_io_uring_poll(poller->io_uring, recv_func, clientd);
+    }
+#endif
+
     if (poller->transports.length <= AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD)
     {
         for (size_t i = 0, length = poller->transports.length; i < length; i++)
@@ -24,6 +24,7 @@
 #endif
 
 #include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_transport_io_uring.h"
 
 #define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD (5)
 
@@ -49,10 +50,14 @@ typedef struct aeron_udp_transport_poller_stct
 #elif defined(HAVE_POLL)
     struct pollfd *pollfds;
 #endif
+
+#if defined(HAVE_IO_URING)
+    aeron_udp_transport_io_uring_t *io_uring;
+#endif
 }
 aeron_udp_transport_poller_t;
 
-int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller);
+int aeron_udp_transport_poller_init(aeron_udp_transport_poller_t *poller, bool use_io_uring);
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller);
 
 int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
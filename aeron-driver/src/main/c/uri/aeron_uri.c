@@ -122,6 +122,14 @@ static int aeron_udp_uri_params_func(void *clientd, const char *key, const char
     {
         params->control_key = value;
     }
+    else if (strcmp(key, AERON_UDP_CHANNEL_GSO_KEY) == 0)
+    {
+        params->gso_key = value;
+    }
+    else if (strcmp(key, AERON_UDP_CHANNEL_SHARD_KEY) == 0)
+    {
+        params->shard_key = value;
+    }
     else
     {
         size_t index = params->additional_params.length;
@@ -147,6 +155,8 @@ int aeron_udp_uri_parse(char *uri, aeron_udp_channel_params_t *params)
     params->interface_key = NULL;
     params->ttl_key = NULL;
     params->control_key = NULL;
+    params->gso_key = NULL;
+    params->shard_key = NULL;
 
     return aeron_uri_parse_params(uri, aeron_udp_uri_params_func, params);
 }
@@ -232,3 +242,15 @@ uint8_t aeron_uri_multicast_ttl(aeron_uri_t *uri)
 
     return result;
 }
+
+bool aeron_uri_gso(aeron_uri_t *uri, bool default_value)
+{
+    bool result = default_value;
+
+    if (AERON_URI_UDP == uri->type && NULL != uri->params.udp.gso_key)
+    {
+        result = strncmp(uri->params.udp.gso_key, "true", strlen("true")) == 0;
+    }
+
+    return result;
+}
@@ -37,6 +37,8 @@ aeron_uri_params_t;
 #define AERON_UDP_CHANNEL_INTERFACE_KEY "interface"
 #define AERON_UDP_CHANNEL_TTL_KEY "ttl"
 #define AERON_UDP_CHANNEL_CONTROL_KEY "control"
+#define AERON_UDP_CHANNEL_GSO_KEY "gso"
+#define AERON_UDP_CHANNEL_SHARD_KEY "shard"
 
 typedef struct aeron_udp_channel_params_stct
 {
@@ -44,6 +46,8 @@ typedef struct aeron_udp_channel_params_stct
     const char *interface_key;
     const char *ttl_key;
     const char *control_key;
+    const char *gso_key;
+    const char *shard_key;
     aeron_uri_params_t additional_params;
 }
 aeron_udp_channel_params_t;
@@ -84,5 +88,6 @@ int aeron_ipc_uri_parse(char *uri, aeron_ipc_channel_params_t *params);
 int aeron_uri_parse(const char *uri, aeron_uri_t *params);
 
 uint8_t aeron_uri_multicast_ttl(aeron_uri_t *uri);
+bool aeron_uri_gso(aeron_uri_t *uri, bool default_value);
 
 #endif //AERON_AERON_URI_H
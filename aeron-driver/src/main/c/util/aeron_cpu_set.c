@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "util/aeron_cpu_set.h"
+#include "util/aeron_error.h"
+
+static int aeron_cpu_set_parse_cpu(const char *str, char **end)
+{
+    if (*str < '0' || *str > '9')
+    {
+        return -1;
+    }
+
+    unsigned long cpu = strtoul(str, end, 10);
+
+    return cpu < AERON_CPU_SET_MAX_CPUS ? (int)cpu : -1;
+}
+
+int aeron_cpu_set_parse(aeron_cpu_set_t *cpu_set, const char *cpu_list)
+{
+    const char *ptr = cpu_list;
+    int count = 0;
+
+    memset(cpu_set, 0, sizeof(aeron_cpu_set_t));
+
+    while (NULL != ptr && '\0' != *ptr)
+    {
+        char *end = NULL;
+        int first = aeron_cpu_set_parse_cpu(ptr, &end), last = first;
+
+        if (first >= 0 && '-' == *end)
+        {
+            last = aeron_cpu_set_parse_cpu(end + 1, &end);
+        }
+
+        if (first < 0 || last < first || (',' != *end && '\0' != *end))
+        {
+            aeron_set_err(EINVAL, "invalid CPU list: %s", cpu_list);
+            return -1;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            count += aeron_cpu_set_is_set(cpu_set, cpu) ? 0 : 1;
+            cpu_set->bits[cpu / 64] |= UINT64_C(1) << (cpu % 64);
+        }
+
+        ptr = (',' == *end) ? end + 1 : end;
+    }
+
+    if (0 == count)
+    {
+        aeron_set_err(EINVAL, "invalid CPU list: %s", NULL == cpu_list ? "" : cpu_list);
+        return -1;
+    }
+
+    return count;
+}
+
+extern bool aeron_cpu_set_is_set(aeron_cpu_set_t *cpu_set, int cpu);
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2014 - 2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_AERON_CPU_SET_H
+#define AERON_AERON_CPU_SET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AERON_CPU_SET_MAX_CPUS (1024)
+
+/* CPUs a thread may run on, independent of cpu_set_t so it can be held without _GNU_SOURCE */
+typedef struct aeron_cpu_set_stct
+{
+    uint64_t bits[AERON_CPU_SET_MAX_CPUS / 64];
+}
+aeron_cpu_set_t;
+
+/*
+ * Parse a CPU list such as "2" or "0,4-7" into cpu_set. Returns the number of CPUs in the set or -1 if the list is
+ * empty, malformed or names a CPU beyond AERON_CPU_SET_MAX_CPUS.
+ */
+int aeron_cpu_set_parse(aeron_cpu_set_t *cpu_set, const char *cpu_list);
+
+inline bool aeron_cpu_set_is_set(aeron_cpu_set_t *cpu_set, int cpu)
+{
+    return (cpu_set->bits[cpu / 64] & (UINT64_C(1) << (cpu % 64))) != 0;
+}
+
+#endif //AERON_AERON_CPU_SET_H
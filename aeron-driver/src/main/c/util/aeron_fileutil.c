@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -21,12 +25,19 @@
 #include <sys/mman.h>
 #include <string.h>
 #include <sys/statvfs.h>
+#if defined(__linux__)
+#include <sys/vfs.h>
+#include <sys/syscall.h>
+#endif
 #include <stdio.h>
 #include <inttypes.h>
 #include <errno.h>
 #include "util/aeron_fileutil.h"
+#include "concurrent/aeron_atomic.h"
 
 #define BLOCK_SIZE (4 * 1024)
+#define AERON_HUGETLBFS_MAGIC (0x958458f6)
+#define AERON_MPOL_PREFERRED (1)
 
 inline static int aeron_mmap(aeron_mapped_file_t *mapping, int fd, off_t offset)
 {
@@ -47,70 +58,40 @@ int aeron_unmap(aeron_mapped_file_t *mapped_file)
     return result;
 }
 
+inline static void aeron_allocate_pages(uint8_t *base, size_t length)
+{
+    for (size_t i = 0; i < length; i += BLOCK_SIZE)
+    {
+        *(base + i) = 0;
+    }
+}
+
 int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes)
 {
     int fd, result = -1;
 
     if ((fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) >= 0)
     {
-        if (lseek(fd, (off_t)(mapped_file->length - 1), SEEK_SET) >= 0)
+        /* hugetlbfs does not support write so the file is extended with ftruncate, which leaves it zeroed */
+        if (ftruncate(fd, (off_t)mapped_file->length) >= 0)
         {
-            if (write(fd, "", 1) > 0)
+            if (aeron_mmap(mapped_file, fd, 0) == 0)
             {
                 if (fill_with_zeroes)
                 {
-                    if (lseek(fd, (off_t)0, SEEK_SET) >= 0)
-                    {
-                        char block[BLOCK_SIZE];
-
-                        memset(block, 0, sizeof(block));
-                        const size_t blocks = mapped_file->length / sizeof(block);
-                        const size_t block_remainder = mapped_file->length % sizeof(block);
-
-                        for (size_t i = 0; i < blocks; i++)
-                        {
-                            if (write(fd, block, sizeof(block)) < (ssize_t) sizeof(block))
-                            {
-                                /* TODO: error */
-                                close(fd);
-                                return -1;
-                            }
-                        }
-
-                        if (block_remainder > 0)
-                        {
-                            if (write(fd, block, block_remainder) < (ssize_t) block_remainder)
-                            {
-                                /* TODO: error */
-                                close(fd);
-                                return -1;
-                            }
-                        }
-                    }
+                    aeron_allocate_pages(mapped_file->addr, mapped_file->length);
                 }
 
-                void *file_mmap = mmap(NULL, mapped_file->length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-                close(fd);
-
-                if (MAP_FAILED != file_mmap)
-                {
-                    mapped_file->addr = file_mmap;
-                    result = 0;
-                }
-                else
-                {
-                    /* TODO: error */
-                }
+                result = 0;
             }
             else
             {
-                close(fd);
+                /* TODO: error */
+                mapped_file->addr = NULL;
             }
         }
-        else
-        {
-            close(fd);
-        }
+
+        close(fd);
     }
     else
     {
@@ -154,12 +135,18 @@ int aeron_map_existing_file(aeron_mapped_file_t *mapped_file, const char *path)
     return result;
 }
 
-inline static void aeron_allocate_pages(uint8_t *base, size_t length)
+uint64_t aeron_hugetlbfs_page_size(const char *path)
 {
-    for (size_t i = 0; i < length; i += BLOCK_SIZE)
+#if defined(__linux__)
+    struct statfs fs;
+
+    if (statfs(path, &fs) == 0 && AERON_HUGETLBFS_MAGIC == (uint64_t)fs.f_type)
     {
-        *(base + i) = 0;
+        return (uint64_t)fs.f_bsize;
     }
+#endif
+
+    return 0;
 }
 
 uint64_t aeron_usable_fs_space(const char *path)
@@ -223,122 +210,173 @@ int aeron_publication_image_location(
         aeron_dir, channel_canonical_form, session_id, stream_id, correlation_id);
 }
 
+inline static void aeron_madvise_huge_pages(aeron_mapped_file_t *mapping, uint64_t page_size)
+{
+#if defined(MADV_HUGEPAGE)
+    /* a hint for transparent huge pages on tmpfs, file systems without them or hugetlbfs ignore it */
+    if (page_size > AERON_PAGE_MIN_SIZE)
+    {
+        madvise(mapping->addr, mapping->length, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+inline static void aeron_mbind_preferred(aeron_mapped_file_t *mapping, int32_t numa_node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    /*
+     * A preference rather than a binding so allocation falls back to other nodes when the node is full. For tmpfs
+     * the policy is held by the file so pages faulted later by clients mapping the log follow it too.
+     */
+    if (numa_node >= 0 && numa_node < AERON_NUMA_MAX_NODES)
+    {
+        static volatile int32_t mbind_failures = 0;
+        unsigned long node_mask = 1UL << numa_node;
+
+        if (syscall(
+            SYS_mbind, mapping->addr, mapping->length, AERON_MPOL_PREFERRED, &node_mask, AERON_NUMA_MAX_NODES + 1, 0) < 0)
+        {
+            int errcode = errno;
+            int32_t previous_failures;
+
+            /* the log is still usable so only the first failure is reported rather than failing the mapping */
+            AERON_GET_AND_ADD_INT32(previous_failures, mbind_failures, 1);
+            if (0 == previous_failures)
+            {
+                fprintf(
+                    stderr,
+                    "WARNING: could not prefer NUMA node %" PRId32 " for log buffers: %s\n",
+                    numa_node,
+                    strerror(errcode));
+            }
+        }
+    }
+#endif
+}
+
 int aeron_map_raw_log(
-    aeron_mapped_raw_log_t *mapped_raw_log, const char *path, bool use_sparse_files, uint64_t term_length)
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size,
+    int32_t numa_node)
 {
     int fd, result = -1;
-    uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_length);
-    uint8_t null_buffer[] = { 0, 0 };
+    uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
 
     if ((fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) >= 0)
     {
-        if (lseek(fd, (off_t)(log_length - 1), SEEK_SET) >= 0)
+        /* hugetlbfs does not support write so the file is extended with ftruncate */
+        if (ftruncate(fd, (off_t)log_length) >= 0)
         {
-            if (write(fd, null_buffer, 1) > 0)
+            if (log_length <= INT32_MAX)
             {
-                if (log_length <= INT32_MAX)
+                mapped_raw_log->num_mapped_files = 1;
+                mapped_raw_log->mapped_files[0].length = log_length;
+                mapped_raw_log->mapped_files[0].addr = NULL;
+
+                int mmap_result = aeron_mmap(&mapped_raw_log->mapped_files[0], fd, 0);
+                close(fd);
+
+                if (mmap_result < 0)
                 {
-                    mapped_raw_log->num_mapped_files = 1;
-                    mapped_raw_log->mapped_files[0].length = log_length;
-                    mapped_raw_log->mapped_files[0].addr = NULL;
+                    return -1;
+                }
 
-                    int mmap_result = aeron_mmap(&mapped_raw_log->mapped_files[0], fd, 0);
-                    close(fd);
+                aeron_madvise_huge_pages(&mapped_raw_log->mapped_files[0], page_size);
+                aeron_mbind_preferred(&mapped_raw_log->mapped_files[0], numa_node);
 
-                    if (mmap_result < 0)
-                    {
-                        return -1;
-                    }
+                if (!use_sparse_files)
+                {
+                    aeron_allocate_pages(mapped_raw_log->mapped_files[0].addr, log_length);
+                }
 
-                    if (!use_sparse_files)
-                    {
-                        aeron_allocate_pages(mapped_raw_log->mapped_files[0].addr, log_length);
-                    }
+                for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+                {
+                    mapped_raw_log->term_buffers[i].addr =
+                        (uint8_t *) mapped_raw_log->mapped_files[0].addr + (i * term_length);
+                    mapped_raw_log->term_buffers[i].length = term_length;
+                }
 
-                    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
-                    {
-                        mapped_raw_log->term_buffers[i].addr =
-                            (uint8_t *) mapped_raw_log->mapped_files[0].addr + (i * term_length);
-                        mapped_raw_log->term_buffers[i].length = term_length;
-                    }
+                mapped_raw_log->log_meta_data.addr =
+                    (uint8_t *) mapped_raw_log->mapped_files[0].addr +
+                        (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+                mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
 
-                    mapped_raw_log->log_meta_data.addr =
-                        (uint8_t *) mapped_raw_log->mapped_files[0].addr +
-                            (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
-                    mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+                mapped_raw_log->term_length = term_length;
 
-                    mapped_raw_log->term_length = term_length;
+                result = 0;
+            }
+            else
+            {
+                const uint64_t meta_data_section_offset = AERON_LOGBUFFER_PARTITION_COUNT * term_length;
+                mapped_raw_log->num_mapped_files = 0;
+                int mmap_result = -1;
 
-                    result = 0;
-                }
-                else
+                for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
                 {
-                    mapped_raw_log->num_mapped_files = 0;
-                    int mmap_result = -1;
+                    mapped_raw_log->mapped_files[i].length = term_length;
+                    mapped_raw_log->mapped_files[i].addr = NULL;
+                    mmap_result = aeron_mmap(&mapped_raw_log->mapped_files[i], fd, (off_t) (i * term_length));
 
-                    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+                    if (mmap_result < 0)
                     {
-                        mapped_raw_log->mapped_files[i].length = term_length;
-                        mapped_raw_log->mapped_files[i].addr = NULL;
-                        mmap_result = aeron_mmap(&mapped_raw_log->mapped_files[i], fd, (off_t) (i * term_length));
+                        break;
+                    }
 
-                        if (mmap_result < 0)
-                        {
-                            break;
-                        }
+                    mapped_raw_log->num_mapped_files++;
 
-                        mapped_raw_log->num_mapped_files++;
+                    aeron_madvise_huge_pages(&mapped_raw_log->mapped_files[i], page_size);
+                    aeron_mbind_preferred(&mapped_raw_log->mapped_files[i], numa_node);
 
-                        if (!use_sparse_files)
-                        {
-                            aeron_allocate_pages(mapped_raw_log->mapped_files[i].addr, log_length);
-                        }
-
-                        mapped_raw_log->term_buffers[i].addr = (uint8_t *) mapped_raw_log->mapped_files[1].addr;
-                        mapped_raw_log->term_buffers[i].length = term_length;
+                    if (!use_sparse_files)
+                    {
+                        aeron_allocate_pages(mapped_raw_log->mapped_files[i].addr, term_length);
                     }
 
-                    mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].length =
-                        AERON_LOGBUFFER_META_DATA_LENGTH;
-                    mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].addr = NULL;
+                    mapped_raw_log->term_buffers[i].addr = (uint8_t *) mapped_raw_log->mapped_files[i].addr;
+                    mapped_raw_log->term_buffers[i].length = term_length;
+                }
 
-                    mmap_result = (mmap_result < 0) ? -1 :
-                        aeron_mmap(
-                            &mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX],
-                            fd,
-                            AERON_LOGBUFFER_PARTITION_COUNT * term_length);
+                /* the section includes any padding to the page size so the meta data is at its end */
+                mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].length =
+                    log_length - meta_data_section_offset;
+                mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].addr = NULL;
 
-                    close(fd);
+                mmap_result = (mmap_result < 0) ? -1 :
+                    aeron_mmap(
+                        &mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX],
+                        fd,
+                        (off_t) meta_data_section_offset);
 
-                    if (mmap_result < 0)
+                close(fd);
+
+                if (mmap_result < 0)
+                {
+                    for (size_t i = 0; i < mapped_raw_log->num_mapped_files; i++)
                     {
-                        for (size_t i = 0; i < mapped_raw_log->num_mapped_files; i++)
+                        if (NULL != mapped_raw_log->mapped_files[i].addr)
                         {
-                            if (NULL != mapped_raw_log->mapped_files[i].addr)
-                            {
-                                munmap(mapped_raw_log->mapped_files[i].addr, mapped_raw_log->mapped_files[i].length);
-                                mapped_raw_log->mapped_files[i].addr = NULL;
-                            }
+                            munmap(mapped_raw_log->mapped_files[i].addr, mapped_raw_log->mapped_files[i].length);
+                            mapped_raw_log->mapped_files[i].addr = NULL;
                         }
-
-                        return -1;
                     }
 
-                    mapped_raw_log->num_mapped_files++;
+                    return -1;
+                }
 
-                    mapped_raw_log->log_meta_data.addr =
-                        (uint8_t *) mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].addr;
-                    mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+                mapped_raw_log->num_mapped_files++;
 
-                    mapped_raw_log->term_length = term_length;
+                mapped_raw_log->log_meta_data.addr =
+                    (uint8_t *) mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].addr +
+                        (mapped_raw_log->mapped_files[AERON_LOG_META_DATA_SECTION_INDEX].length -
+                            AERON_LOGBUFFER_META_DATA_LENGTH);
+                mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
 
-                    result = 0;
-                }
-            }
-            else
-            {
-                /* TODO: grab error */
-                close(fd);
+                mapped_raw_log->term_length = term_length;
+
+                result = 0;
             }
         }
         else
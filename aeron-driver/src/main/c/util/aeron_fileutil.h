@@ -44,6 +44,9 @@ typedef uint64_t (*aeron_usable_fs_space_func_t)(const char *path);
 
 uint64_t aeron_usable_fs_space(const char *path);
 
+/* huge page size of the hugetlbfs mount containing path, or 0 if it is not on hugetlbfs */
+uint64_t aeron_hugetlbfs_page_size(const char *path);
+
 #define AERON_LOG_META_DATA_SECTION_INDEX (AERON_LOGBUFFER_PARTITION_COUNT)
 
 typedef struct aeron_mapped_raw_log_stct
@@ -85,11 +88,19 @@ int aeron_publication_image_location(
     int32_t stream_id,
     int64_t correlation_id);
 
-typedef int (*aeron_map_raw_log_func_t)(aeron_mapped_raw_log_t *, const char *, bool, uint64_t);
+#define AERON_NUMA_NODE_NONE (-1)
+#define AERON_NUMA_MAX_NODES (64)
+
+typedef int (*aeron_map_raw_log_func_t)(aeron_mapped_raw_log_t *, const char *, bool, uint64_t, uint64_t, int32_t);
 typedef int (*aeron_map_raw_log_close_func_t)(aeron_mapped_raw_log_t *);
 
 int aeron_map_raw_log(
-    aeron_mapped_raw_log_t *mapped_raw_log, const char *path, bool use_sparse_files, uint64_t term_length);
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    bool use_sparse_files,
+    uint64_t term_length,
+    uint64_t page_size,
+    int32_t numa_node);
 int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log);
 
 #endif //AERON_AERON_FILEUTIL_H
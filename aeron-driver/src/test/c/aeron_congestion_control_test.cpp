@@ -0,0 +1,259 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_congestion_control.h"
+#include "aeron_driver_context.h"
+#include "concurrent/aeron_counters_manager.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define MTU_LENGTH (4096)
+#define INITIAL_WINDOW_LENGTH (TERM_LENGTH / 2)
+#define CHANNEL "aeron:udp?endpoint=localhost:40123"
+
+static int64_t now_ns = 0;
+
+static int64_t test_nano_clock()
+{
+    return now_ns;
+}
+
+class CubicCongestionControlTest : public testing::Test
+{
+public:
+    CubicCongestionControlTest() :
+        m_context(NULL),
+        m_strategy(NULL)
+    {
+    }
+
+    virtual void SetUp()
+    {
+        now_ns = 0;
+        m_metadata.fill(0);
+        m_values.fill(0);
+
+        ASSERT_EQ(aeron_counters_manager_init(
+            &m_counters_manager, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size()), 0);
+        ASSERT_EQ(aeron_driver_context_init(&m_context), 0);
+
+        m_context->nano_clock = test_nano_clock;
+        m_context->initial_window_length = INITIAL_WINDOW_LENGTH;
+
+        ASSERT_EQ(aeron_cubic_congestion_control_strategy_supplier(
+            &m_strategy, CHANNEL, 1001, 101, 1, TERM_LENGTH, MTU_LENGTH, m_context, &m_counters_manager), 0);
+    }
+
+    virtual void TearDown()
+    {
+        if (NULL != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_counters_manager_close(&m_counters_manager);
+        aeron_driver_context_close(m_context);
+    }
+
+    int32_t onTrackRebuild(bool *should_force_sm, bool loss_occurred)
+    {
+        return m_strategy->on_track_rebuild(m_strategy->state, should_force_sm, now_ns, 0, 0, 0, 0, 0, loss_occurred);
+    }
+
+protected:
+    static const size_t NUM_COUNTERS = 4;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values;
+    aeron_counters_manager_t m_counters_manager;
+    aeron_driver_context_t *m_context;
+    aeron_congestion_control_strategy_t *m_strategy;
+};
+
+TEST_F(CubicCongestionControlTest, shouldStartWithSingleMtuWindow)
+{
+    EXPECT_EQ(m_strategy->initial_window_length(m_strategy->state), MTU_LENGTH);
+}
+
+TEST_F(CubicCongestionControlTest, shouldMeasureRttOnlyWithNoOutstandingMeasurement)
+{
+    now_ns = 20 * 1000 * 1000L;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm(m_strategy->state, now_ns, 1000 * 1000L, NULL);
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+    now_ns += 500 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
+
+TEST_F(CubicCongestionControlTest, shouldMeasureRttAgainAfterMaxTimeoutWhenReplyIsLost)
+{
+    now_ns = 20 * 1000 * 1000L;
+    ASSERT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+
+    now_ns += 1000 * 1000 * 1000L + 1;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm(m_strategy->state, now_ns, 1000 * 1000L, NULL);
+    now_ns += 20 * 1000 * 1000L;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
+
+TEST(CubicCongestionControlSupplierTest, shouldFreeCountersWhenUnableToAllocateAllOfThem)
+{
+    std::array<std::uint8_t, AERON_COUNTERS_MANAGER_METADATA_LENGTH> metadata;
+    std::array<std::uint8_t, AERON_COUNTERS_MANAGER_VALUE_LENGTH> values;
+    aeron_counters_manager_t counters_manager;
+    aeron_driver_context_t *context = NULL;
+    aeron_congestion_control_strategy_t *strategy = NULL;
+
+    metadata.fill(0);
+    values.fill(0);
+    ASSERT_EQ(aeron_counters_manager_init(
+        &counters_manager, metadata.data(), metadata.size(), values.data(), values.size()), 0);
+    ASSERT_EQ(aeron_driver_context_init(&context), 0);
+    context->nano_clock = test_nano_clock;
+
+    EXPECT_EQ(aeron_cubic_congestion_control_strategy_supplier(
+        &strategy, CHANNEL, 1001, 101, 1, TERM_LENGTH, MTU_LENGTH, context, &counters_manager), -1);
+    EXPECT_EQ(strategy, (aeron_congestion_control_strategy_t *)NULL);
+    EXPECT_EQ(aeron_counters_manager_next_counter_id(&counters_manager), 0);
+
+    aeron_counters_manager_close(&counters_manager);
+    aeron_driver_context_close(context);
+}
+
+TEST_F(CubicCongestionControlTest, shouldGrowWindowWithoutLossUpToMaxWindow)
+{
+    bool should_force_sm = false;
+    int32_t window_length = MTU_LENGTH;
+
+    for (int i = 0; i < 100; i++)
+    {
+        now_ns += 100 * 1000 * 1000L;
+        window_length = onTrackRebuild(&should_force_sm, false);
+
+        EXPECT_FALSE(should_force_sm);
+    }
+
+    EXPECT_EQ(window_length, INITIAL_WINDOW_LENGTH);
+}
+
+TEST_F(CubicCongestionControlTest, shouldReduceWindowAndForceStatusMessageOnLoss)
+{
+    bool should_force_sm = false;
+
+    now_ns += 100 * 1000 * 1000L;
+    const int32_t window_before_loss = onTrackRebuild(&should_force_sm, false);
+
+    now_ns += 1000;
+    const int32_t window_after_loss = onTrackRebuild(&should_force_sm, true);
+
+    EXPECT_TRUE(should_force_sm);
+    EXPECT_LT(window_after_loss, window_before_loss);
+    EXPECT_GE(window_after_loss, MTU_LENGTH);
+}
+
+class StaticWindowCongestionControlTest : public testing::Test
+{
+public:
+    StaticWindowCongestionControlTest() :
+        m_context(NULL),
+        m_strategy(NULL)
+    {
+    }
+
+    virtual void SetUp()
+    {
+        now_ns = 0;
+        ASSERT_EQ(aeron_driver_context_init(&m_context), 0);
+
+        m_context->nano_clock = test_nano_clock;
+        m_context->rtt_measurement_interval_ns = 1000 * 1000 * 1000L;
+    }
+
+    virtual void TearDown()
+    {
+        if (NULL != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_driver_context_close(m_context);
+    }
+
+protected:
+    aeron_driver_context_t *m_context;
+    aeron_congestion_control_strategy_t *m_strategy;
+};
+
+TEST_F(StaticWindowCongestionControlTest, shouldMeasureRttAtConfiguredInterval)
+{
+    ASSERT_EQ(aeron_static_window_congestion_control_strategy_supplier(
+        &m_strategy, CHANNEL, 1001, 101, 1, TERM_LENGTH, MTU_LENGTH, m_context, NULL), 0);
+
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    now_ns += m_context->rtt_measurement_interval_ns + 1;
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+
+    m_strategy->on_rttm_sent(m_strategy->state, now_ns);
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns + 1));
+}
+
+TEST_F(StaticWindowCongestionControlTest, shouldNotMeasureRttWhenIntervalIsZero)
+{
+    m_context->rtt_measurement_interval_ns = 0;
+
+    ASSERT_EQ(aeron_static_window_congestion_control_strategy_supplier(
+        &m_strategy, CHANNEL, 1001, 101, 1, TERM_LENGTH, MTU_LENGTH, m_context, NULL), 0);
+
+    now_ns += 10 * 1000 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
+
+TEST_F(StaticWindowCongestionControlTest, shouldNotMeasureRttWithDefaultContext)
+{
+    aeron_driver_context_t *context = NULL;
+
+    ASSERT_EQ(aeron_driver_context_init(&context), 0);
+    ASSERT_EQ(aeron_static_window_congestion_control_strategy_supplier(
+        &m_strategy, CHANNEL, 1001, 101, 1, TERM_LENGTH, MTU_LENGTH, context, NULL), 0);
+    aeron_driver_context_close(context);
+
+    now_ns += 10 * 1000 * 1000 * 1000L;
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, now_ns));
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <util/aeron_cpu_set.h>
+}
+
+TEST(CpuSetTest, shouldParseCpuListOfSinglesAndRanges)
+{
+    aeron_cpu_set_t cpu_set;
+
+    ASSERT_EQ(aeron_cpu_set_parse(&cpu_set, "0,2,64-66"), 5);
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 0));
+    EXPECT_FALSE(aeron_cpu_set_is_set(&cpu_set, 1));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 2));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 64));
+    EXPECT_TRUE(aeron_cpu_set_is_set(&cpu_set, 66));
+    EXPECT_FALSE(aeron_cpu_set_is_set(&cpu_set, 67));
+}
+
+TEST(CpuSetTest, shouldCountOverlappingCpusOnce)
+{
+    aeron_cpu_set_t cpu_set;
+
+    ASSERT_EQ(aeron_cpu_set_parse(&cpu_set, "1-3,2"), 3);
+}
+
+TEST(CpuSetTest, shouldRejectMalformedCpuLists)
+{
+    aeron_cpu_set_t cpu_set;
+
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, ""), -1);
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, "a"), -1);
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, "3-1"), -1);
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, "1,,2"), -1);
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, "-1"), -1);
+    EXPECT_EQ(aeron_cpu_set_parse(&cpu_set, "1024"), -1);
+}
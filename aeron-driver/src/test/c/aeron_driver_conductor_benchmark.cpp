@@ -0,0 +1,270 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "aeron_driver_conductor.h"
+#include "util/aeron_error.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define BASE_STREAM_ID (1000)
+
+/* log buffers are never written by the conductor so reserve them without backing memory */
+static int benchmark_map_raw_log(
+    aeron_mapped_raw_log_t *log,
+    const char *path,
+    bool use_sparse_file,
+    uint64_t term_length,
+    uint64_t page_size,
+    int32_t numa_node)
+{
+    uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
+    void *addr = mmap(NULL, log_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (MAP_FAILED == addr)
+    {
+        return -1;
+    }
+
+    log->num_mapped_files = 0;
+    log->mapped_files[0].length = log_length;
+    log->mapped_files[0].addr = addr;
+
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        log->term_buffers[i].addr = (uint8_t *)addr + (i * term_length);
+        log->term_buffers[i].length = term_length;
+    }
+
+    log->log_meta_data.addr = (uint8_t *)addr + (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+
+    log->term_length = term_length;
+    return 0;
+}
+
+static int benchmark_map_raw_log_close(aeron_mapped_raw_log_t *log)
+{
+    return munmap(log->mapped_files[0].addr, log->mapped_files[0].length);
+}
+
+static uint64_t benchmark_usable_fs_space(const char *path)
+{
+    return UINT64_MAX;
+}
+
+class ConductorFixture
+{
+public:
+    ConductorFixture()
+    {
+        if (aeron_driver_context_init(&m_context) < 0)
+        {
+            throw std::runtime_error("could not init context: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->threading_mode = AERON_THREADING_MODE_SHARED;
+        m_context->cnc_map.length = aeron_cnc_length(m_context);
+        m_cnc = std::unique_ptr<uint8_t[]>(new uint8_t[m_context->cnc_map.length]);
+        m_context->cnc_map.addr = m_cnc.get();
+
+        memset(m_context->cnc_map.addr, 0, m_context->cnc_map.length);
+
+        aeron_driver_fill_cnc_metadata(m_context);
+
+        m_context->term_buffer_length = TERM_LENGTH;
+        m_context->ipc_term_buffer_length = TERM_LENGTH;
+        m_context->usable_fs_space_func = benchmark_usable_fs_space;
+        m_context->map_raw_log_func = benchmark_map_raw_log;
+        m_context->map_raw_log_close_func = benchmark_map_raw_log_close;
+
+        if (aeron_driver_conductor_init(&m_conductor, m_context) < 0)
+        {
+            throw std::runtime_error("could not init conductor: " + std::string(aeron_errmsg()));
+        }
+
+        m_context->conductor_proxy = &m_conductor.conductor_proxy;
+    }
+
+    ~ConductorFixture()
+    {
+        aeron_driver_conductor_on_close(&m_conductor);
+        m_context->cnc_map.addr = NULL;
+        aeron_driver_context_close(m_context);
+    }
+
+    int addIpcPublication(int64_t client_id, int64_t correlation_id, int32_t stream_id)
+    {
+        aeron_publication_command_t command;
+
+        command.correlated.client_id = client_id;
+        command.correlated.correlation_id = correlation_id;
+        command.stream_id = stream_id;
+        command.channel_length = 0;
+
+        return aeron_driver_conductor_on_add_ipc_publication(&m_conductor, &command, false);
+    }
+
+    int addIpcSubscription(int64_t client_id, int64_t correlation_id, int32_t stream_id)
+    {
+        aeron_subscription_command_t command;
+
+        command.correlated.client_id = client_id;
+        command.correlated.correlation_id = correlation_id;
+        command.registration_correlation_id = -1;
+        command.stream_id = stream_id;
+        command.channel_length = 0;
+
+        return aeron_driver_conductor_on_add_ipc_subscription(&m_conductor, &command);
+    }
+
+    int removePublication(int64_t client_id, int64_t correlation_id, int64_t registration_id)
+    {
+        aeron_remove_command_t command;
+
+        command.correlated.client_id = client_id;
+        command.correlated.correlation_id = correlation_id;
+        command.registration_id = registration_id;
+
+        return aeron_driver_conductor_on_remove_publication(&m_conductor, &command);
+    }
+
+    int removeSubscription(int64_t client_id, int64_t correlation_id, int64_t registration_id)
+    {
+        aeron_remove_command_t command;
+
+        command.correlated.client_id = client_id;
+        command.correlated.correlation_id = correlation_id;
+        command.registration_id = registration_id;
+
+        return aeron_driver_conductor_on_remove_subscription(&m_conductor, &command);
+    }
+
+    int64_t nextCorrelationId()
+    {
+        return m_next_correlation_id++;
+    }
+
+    aeron_driver_context_t *m_context = NULL;
+    std::unique_ptr<uint8_t[]> m_cnc;
+    aeron_driver_conductor_t m_conductor;
+    int64_t m_next_correlation_id = 1;
+};
+
+static void BM_AddRemoveSharedIpcPublication(benchmark::State &state)
+{
+    ConductorFixture fixture;
+    const int32_t num_publications = static_cast<int32_t>(state.range(0));
+    const int32_t stream_id = BASE_STREAM_ID + (num_publications / 2);
+    int64_t client_id = fixture.nextCorrelationId();
+    int64_t registration_id = 0;
+
+    for (int32_t i = 0; i < num_publications; i++)
+    {
+        int64_t correlation_id = fixture.nextCorrelationId();
+
+        if (fixture.addIpcPublication(client_id, correlation_id, BASE_STREAM_ID + i) < 0)
+        {
+            state.SkipWithError(aeron_errmsg());
+            return;
+        }
+
+        if (BASE_STREAM_ID + i == stream_id)
+        {
+            registration_id = correlation_id;
+        }
+    }
+
+    while (state.KeepRunning())
+    {
+        fixture.addIpcPublication(client_id, fixture.nextCorrelationId(), stream_id);
+        fixture.removePublication(client_id, fixture.nextCorrelationId(), registration_id);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+/* each publication holds a publisher limit counter so the default counters buffer bounds the range */
+BENCHMARK(BM_AddRemoveSharedIpcPublication)->RangeMultiplier(4)->Range(16, 2048);
+
+static void BM_AddRemoveIpcSubscription(benchmark::State &state)
+{
+    ConductorFixture fixture;
+    const int32_t num_subscriptions = static_cast<int32_t>(state.range(0));
+    int64_t client_id = fixture.nextCorrelationId();
+
+    for (int32_t i = 0; i < num_subscriptions; i++)
+    {
+        if (fixture.addIpcSubscription(client_id, fixture.nextCorrelationId(), BASE_STREAM_ID + i) < 0)
+        {
+            state.SkipWithError(aeron_errmsg());
+            return;
+        }
+    }
+
+    while (state.KeepRunning())
+    {
+        int64_t registration_id = fixture.nextCorrelationId();
+
+        fixture.addIpcSubscription(client_id, registration_id, BASE_STREAM_ID - 1);
+        fixture.removeSubscription(client_id, fixture.nextCorrelationId(), registration_id);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_AddRemoveIpcSubscription)->RangeMultiplier(4)->Range(16, 65536);
+
+static void BM_ClientKeepalive(benchmark::State &state)
+{
+    ConductorFixture fixture;
+    const int32_t num_clients = static_cast<int32_t>(state.range(0));
+    int64_t oldest_client_id = 0;
+
+    for (int32_t i = 0; i < num_clients; i++)
+    {
+        int64_t client_id = fixture.nextCorrelationId();
+
+        if (fixture.addIpcSubscription(client_id, fixture.nextCorrelationId(), BASE_STREAM_ID) < 0)
+        {
+            state.SkipWithError(aeron_errmsg());
+            return;
+        }
+
+        if (0 == i)
+        {
+            oldest_client_id = client_id;
+        }
+    }
+
+    /* the oldest client was the last one found by the previous scan over all clients */
+    int64_t client_id = oldest_client_id;
+
+    while (state.KeepRunning())
+    {
+        aeron_driver_conductor_on_client_keepalive(&fixture.m_conductor, client_id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ClientKeepalive)->RangeMultiplier(4)->Range(16, 65536);
+
+BENCHMARK_MAIN();
@@ -196,6 +196,76 @@ TEST_F(DriverConductorTest, shouldBeAbleToAddMultipleIpcSubscriptionsWithSameStr
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 4u);
 }
 
+TEST_F(DriverConductorTest, shouldKeepSharedIpcPublicationUntilEachAddIsRemoved)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_2, STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 2u);
+
+    aeron_ipc_publication_t *publication =
+        aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id_1);
+    ASSERT_NE(publication, (aeron_ipc_publication_t *)NULL);
+
+    ASSERT_EQ(removePublication(client_id, nextCorrelationId(), pub_id_1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_publications(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(publication->conductor_fields.refcnt, 1);
+    EXPECT_EQ(publication->conductor_fields.status, AERON_IPC_PUBLICATION_STATUS_ACTIVE);
+
+    ASSERT_EQ(removePublication(client_id, nextCorrelationId(), pub_id_1), 0);
+    ASSERT_EQ(removePublication(client_id, nextCorrelationId(), pub_id_1), 0);
+    doWork();
+    EXPECT_EQ(publication->conductor_fields.status, AERON_IPC_PUBLICATION_STATUS_INACTIVE);
+
+    int32_t num_errors = 0;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (AERON_RESPONSE_ON_ERROR == msgTypeId)
+        {
+            num_errors++;
+        }
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 2u);
+    EXPECT_EQ(num_errors, 1);
+}
+
+TEST_F(DriverConductorTest, shouldBeAbleToRemoveIpcSubscriptionsInAnyOrder)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_ids[8];
+
+    for (int64_t &sub_id : sub_ids)
+    {
+        sub_id = nextCorrelationId();
+        ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, -1), 0);
+    }
+    doWork();
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 8u);
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 8u);
+
+    for (int64_t sub_id : { sub_ids[0], sub_ids[7], sub_ids[3], sub_ids[1], sub_ids[6], sub_ids[2], sub_ids[5], sub_ids[4] })
+    {
+        ASSERT_EQ(removeSubscription(client_id, nextCorrelationId(), sub_id), 0);
+    }
+    doWork();
+
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        ASSERT_EQ(msgTypeId, AERON_RESPONSE_ON_OPERATION_SUCCESS);
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 8u);
+    EXPECT_EQ(aeron_driver_conductor_num_ipc_subscriptions(&m_conductor.m_conductor), 0u);
+}
+
 TEST_F(DriverConductorTest, shouldBeAbleToAddSingleIpcSubscriptionThenAddSingleIpcPublication)
 {
     int64_t client_id = nextCorrelationId();
@@ -546,3 +546,298 @@ TEST_F(DriverConductorTest, shouldRemoveSubscriptionFromImageWhenRemoveSubscript
 
     EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 2u);
 }
+
+TEST_F(DriverConductorTest, shouldSmoothRttAndRttVarianceOfImageAsPerRfc6298)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_handler), 1u);
+
+    aeron_receive_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    aeron_publication_image_t *image =
+        aeron_driver_conductor_find_publication_image(&m_conductor.m_conductor, endpoint, STREAM_ID_1);
+    ASSERT_NE(image, (aeron_publication_image_t *)NULL);
+
+    const int64_t now_ns = test_nano_clock();
+    struct sockaddr_storage addr = {};
+    aeron_rttm_header_t header = {};
+
+    header.reception_delta = 0;
+
+    /* first sample: SRTT = R, RTTVAR = R / 2 */
+    header.echo_timestamp = now_ns - 1000000;
+    EXPECT_EQ(aeron_publication_image_on_rttm(image, &header, &addr), 1);
+    EXPECT_EQ(aeron_publication_image_smoothed_rtt_ns(image), 1000000);
+    EXPECT_EQ(aeron_publication_image_rtt_variance_ns(image), 500000);
+
+    /* RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, SRTT = 7/8 SRTT + 1/8 R */
+    header.echo_timestamp = now_ns - 2000000;
+    EXPECT_EQ(aeron_publication_image_on_rttm(image, &header, &addr), 1);
+    EXPECT_EQ(aeron_publication_image_smoothed_rtt_ns(image), 1125000);
+    EXPECT_EQ(aeron_publication_image_rtt_variance_ns(image), 625000);
+
+    header.echo_timestamp = now_ns - 1000000;
+    header.reception_delta = 500000;
+    EXPECT_EQ(aeron_publication_image_on_rttm(image, &header, &addr), 1);
+    EXPECT_EQ(aeron_publication_image_smoothed_rtt_ns(image), 1046875);
+    EXPECT_EQ(aeron_publication_image_rtt_variance_ns(image), 625000);
+
+    /* a negative sample from clock skew leaves the estimates untouched */
+    header.echo_timestamp = now_ns + 1;
+    header.reception_delta = 0;
+    EXPECT_EQ(aeron_publication_image_on_rttm(image, &header, &addr), 0);
+    EXPECT_EQ(aeron_publication_image_smoothed_rtt_ns(image), 1046875);
+    EXPECT_EQ(aeron_publication_image_rtt_variance_ns(image), 625000);
+}
+
+static void appendRetransmitFrames(aeron_network_publication_t *publication, size_t count, int32_t frame_length)
+{
+    uint8_t *term = publication->mapped_raw_log.term_buffers[0].addr;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        aeron_data_header_t *header = (aeron_data_header_t *)(term + (i * (size_t)frame_length));
+
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->frame_header.frame_length = frame_length;
+        header->term_id = publication->initial_term_id;
+        header->term_offset = (int32_t)(i * (size_t)frame_length);
+    }
+
+    aeron_counter_set_ordered(publication->snd_pos_position.value_addr, (int64_t)(count * (size_t)frame_length));
+}
+
+TEST_F(DriverConductorTest, shouldMergeOverlappingDeferredResendsAndCountThoseDropped)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    const int32_t term_id = publication->initial_term_id;
+    const int64_t dropped_before = aeron_counter_get(publication->retransmits_dropped_counter);
+
+    appendRetransmitFrames(publication, 64, 64);
+    publication->retransmit_budget_remaining = 0;
+
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 0, 128), 0);
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 64, 128), 0);
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 192, 64), 0);
+
+    ASSERT_EQ(publication->pending_retransmits_length, 1u);
+    EXPECT_EQ(publication->pending_retransmits[0].term_offset, 0);
+    EXPECT_EQ(publication->pending_retransmits[0].length, 256u);
+
+    for (int32_t i = 1; i < AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS; i++)
+    {
+        EXPECT_EQ(aeron_network_publication_resend(publication, term_id, (i * 256) + 64, 64), 0);
+    }
+
+    EXPECT_EQ(publication->pending_retransmits_length, (size_t)AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS);
+    EXPECT_EQ(aeron_counter_get(publication->retransmits_dropped_counter), dropped_before);
+
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 4032, 64), 0);
+
+    EXPECT_EQ(publication->pending_retransmits_length, (size_t)AERON_NETWORK_PUBLICATION_MAX_PENDING_RETRANSMITS);
+    EXPECT_EQ(aeron_counter_get(publication->retransmits_dropped_counter), dropped_before + 1);
+}
+
+TEST_F(DriverConductorTest, shouldCountFramesResentAndDeferRemainderBeyondBudget)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    const int32_t term_id = publication->initial_term_id;
+    const int32_t frame_length = (int32_t)publication->mtu_length;
+    const int64_t sent_before = aeron_counter_get(publication->retransmits_sent_counter);
+
+    appendRetransmitFrames(publication, 10, frame_length);
+    publication->retransmit_budget_remaining = 8 * (size_t)frame_length;
+
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 0, 10 * (size_t)frame_length), 0);
+
+    EXPECT_EQ(aeron_counter_get(publication->retransmits_sent_counter), sent_before + 8);
+    EXPECT_EQ(publication->retransmit_budget_remaining, 0u);
+    ASSERT_EQ(publication->pending_retransmits_length, 1u);
+    EXPECT_EQ(publication->pending_retransmits[0].term_offset, 8 * frame_length);
+    EXPECT_EQ(publication->pending_retransmits[0].length, 2u * (size_t)frame_length);
+}
+
+TEST_F(DriverConductorTest, shouldDeferUnsentFramesWhenResendFails)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_send_channel_endpoint_t *endpoint =
+        aeron_driver_conductor_find_send_channel_endpoint(&m_conductor.m_conductor, CHANNEL_1);
+    aeron_network_publication_t *publication =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id);
+    ASSERT_NE(endpoint, (aeron_send_channel_endpoint_t *)NULL);
+    ASSERT_NE(publication, (aeron_network_publication_t *)NULL);
+
+    const int32_t term_id = publication->initial_term_id;
+    const int64_t sent_before = aeron_counter_get(publication->retransmits_sent_counter);
+    struct sockaddr_storage *remote_data = &endpoint->conductor_fields.udp_channel->remote_data;
+    const sa_family_t remote_family = remote_data->ss_family;
+
+    appendRetransmitFrames(publication, 4, 64);
+
+    /* an address of the wrong family fails the whole batch */
+    remote_data->ss_family = AF_UNIX;
+    EXPECT_EQ(aeron_network_publication_resend(publication, term_id, 0, 4 * 64), -1);
+    remote_data->ss_family = remote_family;
+
+    EXPECT_EQ(aeron_counter_get(publication->retransmits_sent_counter), sent_before);
+    ASSERT_EQ(publication->pending_retransmits_length, 1u);
+    EXPECT_EQ(publication->pending_retransmits[0].term_offset, 0);
+    EXPECT_EQ(publication->pending_retransmits[0].length, 4u * 64u);
+    EXPECT_EQ(publication->retransmit_budget_remaining, publication->retransmit_budget_length);
+}
+
+#define SHARD_0_CHANNEL "aeron:udp?endpoint=localhost:40001|shard=0"
+#define SHARD_1_CHANNEL "aeron:udp?endpoint=localhost:40002|shard=1"
+#define SHARD_OUT_OF_RANGE_CHANNEL "aeron:udp?endpoint=localhost:40003|shard=2"
+
+TEST_F(DriverConductorTest, shouldRouteReceiveChannelEndpointsToTheirReceiverShard)
+{
+    aeron_driver_context_t *context = m_context.m_context;
+    aeron_driver_receiver_t shard;
+
+    ASSERT_EQ(aeron_driver_receiver_shard_init(
+        &shard, context, &m_conductor.m_conductor.system_counters, &m_conductor.m_conductor.error_log), 0);
+    context->receiver_shard_count = 2;
+    context->receiver_shard_proxies[0] = &m_conductor.m_receiver.receiver_proxy;
+    context->receiver_shard_proxies[1] = &shard.receiver_proxy;
+
+    int64_t client_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), SHARD_0_CHANNEL, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), SHARD_1_CHANNEL, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, nextCorrelationId(), SHARD_OUT_OF_RANGE_CHANNEL, STREAM_ID_1, -1), 0);
+    doWork();
+
+    int32_t num_errors = 0;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (AERON_RESPONSE_ON_ERROR == msgTypeId)
+        {
+            num_errors++;
+        }
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 3u);
+    EXPECT_EQ(num_errors, 1);
+
+    aeron_receive_channel_endpoint_t *endpoint_0 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, SHARD_0_CHANNEL);
+    aeron_receive_channel_endpoint_t *endpoint_1 =
+        aeron_driver_conductor_find_receive_channel_endpoint(&m_conductor.m_conductor, SHARD_1_CHANNEL);
+
+    ASSERT_NE(endpoint_0, (aeron_receive_channel_endpoint_t *)NULL);
+    ASSERT_NE(endpoint_1, (aeron_receive_channel_endpoint_t *)NULL);
+    EXPECT_EQ(endpoint_0->receiver_proxy, &m_conductor.m_receiver.receiver_proxy);
+    EXPECT_EQ(endpoint_1->receiver_proxy, &shard.receiver_proxy);
+    EXPECT_TRUE(endpoint_1->has_shared_system_counters);
+    EXPECT_EQ(aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, SHARD_OUT_OF_RANGE_CHANNEL), (aeron_receive_channel_endpoint_t *)NULL);
+
+    aeron_driver_receiver_do_work(&m_conductor.m_receiver);
+    aeron_driver_receiver_do_work(&shard);
+
+    ASSERT_EQ(m_conductor.m_receiver.poller.transports.length, 1u);
+    ASSERT_EQ(shard.poller.transports.length, 1u);
+    EXPECT_EQ(m_conductor.m_receiver.poller.transports.array[0].transport, &endpoint_0->transport);
+    EXPECT_EQ(shard.poller.transports.array[0].transport, &endpoint_1->transport);
+
+    aeron_driver_receiver_on_close(&shard);
+}
+
+TEST_F(DriverConductorTest, shouldRouteSendChannelEndpointsToTheirSenderShard)
+{
+    aeron_driver_context_t *context = m_context.m_context;
+    aeron_driver_sender_t shard;
+
+    ASSERT_EQ(aeron_driver_sender_shard_init(
+        &shard, context, &m_conductor.m_conductor.system_counters, &m_conductor.m_conductor.error_log), 0);
+    context->sender_shard_count = 2;
+    context->sender_shard_proxies[0] = &m_conductor.m_sender.sender_proxy;
+    context->sender_shard_proxies[1] = &shard.sender_proxy;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_0 = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_0, SHARD_0_CHANNEL, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(client_id, pub_id_1, SHARD_1_CHANNEL, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkPublication(client_id, nextCorrelationId(), SHARD_OUT_OF_RANGE_CHANNEL, STREAM_ID_1, false), 0);
+    doWork();
+
+    int32_t num_errors = 0;
+    auto handler = [&](std::int32_t msgTypeId, AtomicBuffer& buffer, util::index_t offset, util::index_t length)
+    {
+        if (AERON_RESPONSE_ON_ERROR == msgTypeId)
+        {
+            num_errors++;
+        }
+    };
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(handler), 3u);
+    EXPECT_EQ(num_errors, 1);
+
+    aeron_send_channel_endpoint_t *endpoint_0 =
+        aeron_driver_conductor_find_send_channel_endpoint(&m_conductor.m_conductor, SHARD_0_CHANNEL);
+    aeron_send_channel_endpoint_t *endpoint_1 =
+        aeron_driver_conductor_find_send_channel_endpoint(&m_conductor.m_conductor, SHARD_1_CHANNEL);
+    aeron_network_publication_t *publication_0 =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_0);
+    aeron_network_publication_t *publication_1 =
+        aeron_driver_conductor_find_network_publication(&m_conductor.m_conductor, pub_id_1);
+
+    ASSERT_NE(endpoint_0, (aeron_send_channel_endpoint_t *)NULL);
+    ASSERT_NE(endpoint_1, (aeron_send_channel_endpoint_t *)NULL);
+    ASSERT_NE(publication_0, (aeron_network_publication_t *)NULL);
+    ASSERT_NE(publication_1, (aeron_network_publication_t *)NULL);
+    EXPECT_EQ(endpoint_0->sender_proxy, &m_conductor.m_sender.sender_proxy);
+    EXPECT_EQ(endpoint_1->sender_proxy, &shard.sender_proxy);
+    EXPECT_EQ(aeron_driver_sender_proxy_for_channel(
+        context, endpoint_1->conductor_fields.udp_channel), &shard.sender_proxy);
+    EXPECT_TRUE(publication_1->has_shared_system_counters);
+    EXPECT_EQ(aeron_driver_conductor_find_send_channel_endpoint(
+        &m_conductor.m_conductor, SHARD_OUT_OF_RANGE_CHANNEL), (aeron_send_channel_endpoint_t *)NULL);
+
+    aeron_driver_sender_do_work(&m_conductor.m_sender);
+    aeron_driver_sender_do_work(&shard);
+
+    ASSERT_EQ(m_conductor.m_sender.network_publicaitons.length, 1u);
+    ASSERT_EQ(shard.network_publicaitons.length, 1u);
+    EXPECT_EQ(m_conductor.m_sender.network_publicaitons.array[0].publication, publication_0);
+    EXPECT_EQ(shard.network_publicaitons.array[0].publication, publication_1);
+
+    context->sender_shard_count = 1;
+    EXPECT_EQ(aeron_driver_sender_proxy_for_channel(
+        context, endpoint_1->conductor_fields.udp_channel), context->sender_proxy);
+
+    aeron_driver_sender_on_close(&shard);
+}
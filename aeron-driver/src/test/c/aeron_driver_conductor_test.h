@@ -83,9 +83,14 @@ static int64_t test_epoch_clock()
 }
 
 static int test_malloc_map_raw_log(
-    aeron_mapped_raw_log_t *log, const char *path, bool use_sparse_file, uint64_t term_length)
+    aeron_mapped_raw_log_t *log,
+    const char *path,
+    bool use_sparse_file,
+    uint64_t term_length,
+    uint64_t page_size,
+    int32_t numa_node)
 {
-    uint64_t log_length = AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(term_length);
+    uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
 
     log->num_mapped_files = 0;
     log->mapped_files[0].length = 0;
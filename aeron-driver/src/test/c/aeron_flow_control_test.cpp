@@ -0,0 +1,121 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_flow_control.h"
+#include "aeron_driver_context.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define POSITION_BITS_TO_SHIFT (16)
+#define INITIAL_TERM_ID (0)
+#define WINDOW_LENGTH (TERM_LENGTH / 2)
+#define RECEIVER_TIMEOUT_NS (2 * 1000 * 1000 * 1000L)
+#define CHANNEL "aeron:udp?endpoint=224.20.30.39:54326|interface=localhost"
+
+class MinMulticastFlowControlTest : public testing::Test
+{
+public:
+    MinMulticastFlowControlTest() :
+        m_context(NULL),
+        m_strategy(NULL)
+    {
+    }
+
+    virtual void SetUp()
+    {
+        ASSERT_EQ(aeron_driver_context_init(&m_context), 0);
+        m_context->min_flow_control_receiver_timeout_ns = RECEIVER_TIMEOUT_NS;
+
+        ASSERT_EQ(aeron_min_multicast_flow_control_strategy_supplier(
+            &m_strategy, CHANNEL, 1001, 1, INITIAL_TERM_ID, TERM_LENGTH, m_context), 0);
+    }
+
+    virtual void TearDown()
+    {
+        if (NULL != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_driver_context_close(m_context);
+    }
+
+    int64_t onStatusMessage(int64_t receiver_id, int32_t term_offset, int64_t snd_lmt, int64_t now_ns)
+    {
+        aeron_status_message_header_t sm;
+
+        sm.frame_header.frame_length = sizeof(aeron_status_message_header_t);
+        sm.frame_header.type = AERON_HDR_TYPE_SM;
+        sm.session_id = 1;
+        sm.stream_id = 1001;
+        sm.consumption_term_id = INITIAL_TERM_ID;
+        sm.consumption_term_offset = term_offset;
+        sm.receiver_window = WINDOW_LENGTH;
+        sm.receiver_id = receiver_id;
+
+        return m_strategy->on_status_message(
+            m_strategy->state,
+            (const uint8_t *)&sm,
+            sizeof(sm),
+            NULL,
+            snd_lmt,
+            INITIAL_TERM_ID,
+            POSITION_BITS_TO_SHIFT,
+            now_ns);
+    }
+
+protected:
+    aeron_driver_context_t *m_context;
+    aeron_flow_control_strategy_t *m_strategy;
+};
+
+TEST_F(MinMulticastFlowControlTest, shouldPaceToSlowestReceiver)
+{
+    EXPECT_EQ(onStatusMessage(1, 4096, 0, 0), 4096 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(2, 1024, 0, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(1, 8192, 0, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, 0, 0), 1024 + WINDOW_LENGTH);
+}
+
+TEST_F(MinMulticastFlowControlTest, shouldNotReduceSenderLimit)
+{
+    EXPECT_EQ(onStatusMessage(1, 4096, 8192 + WINDOW_LENGTH, 0), 8192 + WINDOW_LENGTH);
+}
+
+TEST_F(MinMulticastFlowControlTest, shouldDropReceiverAfterTimeout)
+{
+    const int64_t now_ns = RECEIVER_TIMEOUT_NS / 2;
+
+    EXPECT_EQ(onStatusMessage(1, 1024, 0, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(onStatusMessage(2, 8192, 0, now_ns), 1024 + WINDOW_LENGTH);
+
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, RECEIVER_TIMEOUT_NS + 1, 0), 8192 + WINDOW_LENGTH);
+}
+
+TEST_F(MinMulticastFlowControlTest, shouldReturnSenderLimitWhenAllReceiversTimedOut)
+{
+    EXPECT_EQ(onStatusMessage(1, 1024, 0, 0), 1024 + WINDOW_LENGTH);
+    EXPECT_EQ(m_strategy->on_idle(m_strategy->state, RECEIVER_TIMEOUT_NS + 1, 2048), 2048);
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <aeron_idle_strategy.h>
+#include <aeron_position.h>
+}
+
+class IdleStrategyTest : public testing::Test
+{
+public:
+    IdleStrategyTest()
+    {
+        m_metadata.fill(0);
+        m_values.fill(0);
+        aeron_idle_strategy_backoff_state_init(&m_backoff, 2, 1, 1, 4, 8);
+    }
+
+    void idleTimes(aeron_idle_strategy_func_t idle, int times)
+    {
+        for (int i = 0; i < times; i++)
+        {
+            idle(&m_backoff, 0);
+        }
+    }
+
+protected:
+    static const size_t NUM_COUNTERS = 4;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values;
+    aeron_counters_manager_t m_manager;
+    aeron_idle_strategy_backoff_state_t m_backoff;
+};
+
+TEST_F(IdleStrategyTest, shouldBackoffFromSpinningToYieldingToParking)
+{
+    idleTimes(aeron_idle_strategy_backoff_idle, 2);
+    EXPECT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_SPINNING);
+
+    idleTimes(aeron_idle_strategy_backoff_idle, 1);
+    EXPECT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_YIELDING);
+
+    idleTimes(aeron_idle_strategy_backoff_idle, 1);
+    EXPECT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_PARKING);
+    EXPECT_EQ(m_backoff.park_period_ns, 2u);
+
+    idleTimes(aeron_idle_strategy_backoff_idle, 2);
+    EXPECT_EQ(m_backoff.park_period_ns, 4u);
+
+    aeron_idle_strategy_backoff_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_NOT_IDLE);
+    EXPECT_GT(*m_backoff.phase_time_ns[AERON_IDLE_STRATEGY_BACKOFF_PARKING], 0);
+}
+
+TEST_F(IdleStrategyTest, shouldIncreaseSpinsWhenWorkArrivesWhileYielding)
+{
+    idleTimes(aeron_idle_strategy_adaptive_idle, 3);
+    ASSERT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_YIELDING);
+
+    aeron_idle_strategy_adaptive_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.max_spins, 4u);
+
+    idleTimes(aeron_idle_strategy_adaptive_idle, 5);
+    aeron_idle_strategy_adaptive_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.max_spins, 8u);
+
+    idleTimes(aeron_idle_strategy_adaptive_idle, 9);
+    aeron_idle_strategy_adaptive_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.max_spins, 8u);
+}
+
+TEST_F(IdleStrategyTest, shouldDecreaseSpinsWhenWorkArrivesWhileParking)
+{
+    idleTimes(aeron_idle_strategy_adaptive_idle, 4);
+    ASSERT_EQ(m_backoff.phase, AERON_IDLE_STRATEGY_BACKOFF_PARKING);
+
+    aeron_idle_strategy_adaptive_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.max_spins, 1u);
+
+    idleTimes(aeron_idle_strategy_adaptive_idle, 3);
+    aeron_idle_strategy_adaptive_idle(&m_backoff, 1);
+    EXPECT_EQ(m_backoff.max_spins, 1u);
+}
+
+TEST_F(IdleStrategyTest, shouldAccumulatePhaseTimesIntoAllocatedCounters)
+{
+    ASSERT_EQ(aeron_counters_manager_init(
+        &m_manager, m_metadata.data(), m_metadata.size(), m_values.data(), m_values.size()), 0);
+    ASSERT_EQ(aeron_idle_strategy_counters_allocate(
+        aeron_idle_strategy_backoff_idle, &m_backoff, &m_manager, "receiver"), 0);
+
+    idleTimes(aeron_idle_strategy_backoff_idle, 5);
+    aeron_idle_strategy_backoff_idle(&m_backoff, 1);
+
+    const int64_t park_time_ns = *aeron_counter_addr(&m_manager, 2);
+
+    EXPECT_GT(park_time_ns, 0);
+    EXPECT_EQ(m_backoff.local_phase_time_ns[AERON_IDLE_STRATEGY_BACKOFF_PARKING], 0);
+
+    aeron_counter_metadata_descriptor_t *metadata =
+        (aeron_counter_metadata_descriptor_t *)(m_metadata.data() + (2 * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
+    int32_t idle_phase;
+    int32_t role_name_length;
+
+    memcpy(&idle_phase, metadata->key, sizeof(int32_t));
+    memcpy(&role_name_length, metadata->key + sizeof(int32_t), sizeof(int32_t));
+
+    EXPECT_EQ(metadata->type_id, AERON_COUNTER_AGENT_IDLE_TIME_TYPE_ID);
+    EXPECT_EQ(idle_phase, AERON_IDLE_STRATEGY_BACKOFF_PARKING);
+    EXPECT_EQ(std::string((char *)metadata->key + (2 * sizeof(int32_t)), (size_t)role_name_length), "receiver");
+    EXPECT_EQ(
+        std::string((char *)metadata->label, (size_t)metadata->label_length),
+        AERON_COUNTER_AGENT_IDLE_PARK_TIME_NAME ": receiver");
+
+    aeron_counters_manager_close(&m_manager);
+}
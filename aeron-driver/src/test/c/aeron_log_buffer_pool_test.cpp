@@ -0,0 +1,162 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <aeron_log_buffer_pool.h>
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define OTHER_TERM_LENGTH (128 * 1024)
+#define POOL_SIZE (2)
+
+class LogBufferPoolTest : public testing::Test
+{
+public:
+    LogBufferPoolTest()
+    {
+        char dir_template[] = "/tmp/aeron_log_buffer_pool_test_XXXXXX";
+
+        aeron_driver_context_init(&m_context);
+        snprintf(m_context->aeron_dir, AERON_MAX_PATH - 1, "%s", mkdtemp(dir_template));
+        m_context->term_buffer_length = TERM_LENGTH;
+        m_context->ipc_term_buffer_length = TERM_LENGTH;
+        m_context->log_buffer_pool_size = POOL_SIZE;
+        m_context->term_buffer_sparse_file = false;
+
+        aeron_log_buffer_pool_init(&m_pool, m_context);
+        m_context->log_buffer_pool = &m_pool;
+    }
+
+    virtual ~LogBufferPoolTest()
+    {
+        aeron_log_buffer_pool_on_close(&m_pool);
+        aeron_dir_delete(m_context->aeron_dir);
+        aeron_driver_context_close(m_context);
+    }
+
+    int fillPool()
+    {
+        int work_count = 0, total = 0;
+
+        while ((work_count = aeron_log_buffer_pool_do_work(&m_pool)) > 0)
+        {
+            total += work_count;
+        }
+
+        return total;
+    }
+
+    std::string logPath(const char *name)
+    {
+        return std::string(m_context->aeron_dir) + "/" + name;
+    }
+
+protected:
+    aeron_driver_context_t *m_context = NULL;
+    aeron_log_buffer_pool_t m_pool;
+};
+
+TEST_F(LogBufferPoolTest, shouldFillPoolUpToSizeForEachTermLength)
+{
+    EXPECT_EQ(fillPool(), POOL_SIZE);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_pool.partitions[0].available_queue), (uint64_t)POOL_SIZE);
+    EXPECT_EQ(m_pool.partitions[1].term_length, 0u);
+}
+
+TEST_F(LogBufferPoolTest, shouldMapRawLogByRenamingPooledFile)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    const std::string path = logPath("taken.logbuffer");
+
+    fillPool();
+
+    ASSERT_EQ(aeron_log_buffer_pool_map_raw_log(
+        m_context, &mapped_raw_log, path.c_str(), TERM_LENGTH, AERON_NUMA_NODE_NONE), 0);
+    EXPECT_EQ(access(path.c_str(), F_OK), 0);
+    EXPECT_EQ(mapped_raw_log.term_length, (size_t)TERM_LENGTH);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_pool.partitions[0].available_queue), (uint64_t)POOL_SIZE - 1);
+
+    mapped_raw_log.term_buffers[0].addr[TERM_LENGTH - 1] = 1;
+    mapped_raw_log.log_meta_data.addr[0] = 1;
+
+    EXPECT_EQ(fillPool(), 1);
+    EXPECT_EQ(aeron_map_raw_log_close(&mapped_raw_log), 0);
+}
+
+TEST_F(LogBufferPoolTest, shouldFallBackAndStartPoolingUnknownTermLength)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    const std::string path = logPath("other.logbuffer");
+
+    fillPool();
+
+    ASSERT_EQ(aeron_log_buffer_pool_map_raw_log(
+        m_context, &mapped_raw_log, path.c_str(), OTHER_TERM_LENGTH, AERON_NUMA_NODE_NONE), 0);
+    EXPECT_EQ(access(path.c_str(), F_OK), 0);
+    EXPECT_EQ(mapped_raw_log.term_length, (size_t)OTHER_TERM_LENGTH);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_pool.partitions[0].available_queue), (uint64_t)POOL_SIZE);
+    EXPECT_EQ(m_pool.partitions[1].term_length, (uint64_t)OTHER_TERM_LENGTH);
+
+    EXPECT_EQ(fillPool(), POOL_SIZE);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_pool.partitions[1].available_queue), (uint64_t)POOL_SIZE);
+    EXPECT_EQ(aeron_map_raw_log_close(&mapped_raw_log), 0);
+}
+
+TEST_F(LogBufferPoolTest, shouldPoolSameTermLengthSeparatelyForEachNumaNode)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    const std::string path = logPath("node.logbuffer");
+
+    fillPool();
+
+    ASSERT_EQ(aeron_log_buffer_pool_map_raw_log(m_context, &mapped_raw_log, path.c_str(), TERM_LENGTH, 0), 0);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_pool.partitions[0].available_queue), (uint64_t)POOL_SIZE);
+    EXPECT_EQ(m_pool.partitions[1].term_length, (uint64_t)TERM_LENGTH);
+    EXPECT_EQ(m_pool.partitions[1].numa_node, 0);
+
+    EXPECT_EQ(fillPool(), POOL_SIZE);
+    EXPECT_EQ(aeron_map_raw_log_close(&mapped_raw_log), 0);
+}
+
+TEST_F(LogBufferPoolTest, shouldPadLogLengthToFilePageSize)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    const std::string path = logPath("padded.logbuffer");
+    const uint64_t page_size = 2 * 1024 * 1024;
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(TERM_LENGTH, page_size);
+    struct stat sb;
+
+    ASSERT_EQ(aeron_map_raw_log(
+        &mapped_raw_log, path.c_str(), true, TERM_LENGTH, page_size, AERON_NUMA_NODE_NONE), 0);
+    ASSERT_EQ(stat(path.c_str(), &sb), 0);
+    EXPECT_EQ((uint64_t)sb.st_size, page_size);
+    EXPECT_EQ(log_length, page_size);
+    EXPECT_EQ(
+        mapped_raw_log.log_meta_data.addr,
+        mapped_raw_log.mapped_files[0].addr + log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    EXPECT_EQ(aeron_logbuffer_compute_log_length(TERM_LENGTH, AERON_PAGE_MIN_SIZE),
+        (uint64_t)AERON_LOGBUFFER_COMPUTE_LOG_LENGTH(TERM_LENGTH));
+    EXPECT_EQ(aeron_map_raw_log_close(&mapped_raw_log), 0);
+}
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -411,23 +412,28 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
         {
             EXPECT_EQ(term_offset, offset_of_message(1));
         }
-        else if (2 == called)
+        else if (2 == called || 4 == called)
         {
             EXPECT_EQ(term_offset, offset_of_message(3));
         }
+        else if (3 == called || 5 == called)
+        {
+            EXPECT_EQ(term_offset, offset_of_message(5));
+        }
     };
 
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(1));
     EXPECT_EQ(called, 0);
+    EXPECT_EQ(m_detector.active_gap_count, 3u);
     EXPECT_TRUE(loss_found);
 
     m_time = 40 * 1000 * 1000L;
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(1));
-    EXPECT_EQ(called, 1);
+    EXPECT_EQ(called, 3);
     EXPECT_FALSE(loss_found);
 
     insert_frame(offset_of_message(1));
@@ -436,17 +442,86 @@ TEST_F(LossDetectorTest, shouldHandleMoreThan2Gaps)
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(3));
-    EXPECT_EQ(called, 1);
-    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(called, 3);
+    EXPECT_EQ(m_detector.active_gap_count, 2u);
+    EXPECT_FALSE(loss_found);
 
     m_time = 80 * 1000 * 1000L;
     ASSERT_EQ(aeron_loss_detector_scan(
         &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
         offset_of_message(3));
-    EXPECT_EQ(called, 2);
+    EXPECT_EQ(called, 5);
     EXPECT_FALSE(loss_found);
 }
 
+TEST_F(LossDetectorTest, shouldNakAllGapsFoundInSingleScan)
+{
+    const int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 7);
+    bool loss_found;
+    std::vector<int32_t> offsets;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+    insert_frame(offset_of_message(6));
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, true, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_id, TERM_ID);
+        offsets.push_back(term_offset);
+
+        if (offset_of_message(3) == term_offset)
+        {
+            EXPECT_EQ(length, (size_t)(3 * ALIGNED_FRAME_LENGTH));
+        }
+        else
+        {
+            EXPECT_EQ(length, ALIGNED_FRAME_LENGTH);
+        }
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    ASSERT_EQ(offsets.size(), 2u);
+    EXPECT_EQ(offsets[0], offset_of_message(1));
+    EXPECT_EQ(offsets[1], offset_of_message(3));
+}
+
+TEST_F(LossDetectorTest, shouldBoundNumberOfTrackedGaps)
+{
+    const int num_messages = (2 * AERON_LOSS_DETECTOR_MAX_GAPS) + 3;
+    const int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * num_messages);
+    bool loss_found;
+    int called = 0;
+
+    for (int i = 0; i < num_messages; i += 2)
+    {
+        insert_frame(offset_of_message(i));
+    }
+
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, true, static_feedback_generator_20ms, LossDetectorTest::on_gap_detected, this), 0);
+
+    m_on_gap_detected = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        EXPECT_EQ(term_offset, offset_of_message((2 * called) + 1));
+        called++;
+    };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(loss_found);
+    EXPECT_EQ(called, AERON_LOSS_DETECTOR_MAX_GAPS);
+    EXPECT_EQ(m_detector.active_gap_count, (size_t)AERON_LOSS_DETECTOR_MAX_GAPS);
+}
+
 TEST_F(LossDetectorTest, shouldReplaceOldNakWithNewNak)
 {
     int64_t rebuild_position = 0;
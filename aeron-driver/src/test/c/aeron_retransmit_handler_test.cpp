@@ -41,8 +41,29 @@ class RetransmitHandlerTest : public testing::Test
 public:
     RetransmitHandlerTest() :
         m_time(0),
-        m_invalid_packet_counter(0)
+        m_invalid_packet_counter(0),
+        m_retransmits_merged_counter(0),
+        m_retransmits_lingered_counter(0),
+        m_retransmits_dropped_counter(0)
     {
+        m_handler.retransmit_actions.array = NULL;
+    }
+
+    virtual ~RetransmitHandlerTest()
+    {
+        aeron_retransmit_handler_close(&m_handler);
+    }
+
+    int init(size_t max_retransmit_actions = AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS)
+    {
+        return aeron_retransmit_handler_init(
+            &m_handler,
+            &m_invalid_packet_counter,
+            &m_retransmits_merged_counter,
+            &m_retransmits_lingered_counter,
+            &m_retransmits_dropped_counter,
+            max_retransmit_actions,
+            LINGER_TIMEOUT_20MS);
     }
 
     static int on_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
@@ -55,13 +76,16 @@ public:
 protected:
     int64_t m_time;
     int64_t m_invalid_packet_counter;
+    int64_t m_retransmits_merged_counter;
+    int64_t m_retransmits_lingered_counter;
+    int64_t m_retransmits_dropped_counter;
     aeron_retransmit_handler_t m_handler;
     std::function<int(int32_t,int32_t,size_t)> m_resend;
 };
 
 TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(init(), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -83,7 +107,7 @@ TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
 
 TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(init(), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -111,7 +135,7 @@ TEST_F(RetransmitHandlerTest, shouldNotRetransmitOnNakWhileInLinger)
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(init(), 0);
 
     const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length = ALIGNED_FRAME_LENGTH;
@@ -139,7 +163,7 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnNakAfterLinger)
 
 TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
 {
-    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(init(), 0);
 
     const int32_t nak_offset_1 = (ALIGNED_FRAME_LENGTH * 2);
     const size_t nak_length_1 = ALIGNED_FRAME_LENGTH;
@@ -172,3 +196,120 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
         &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
+
+TEST_F(RetransmitHandlerTest, shouldOnlyRetransmitUncoveredRangeOfOverlappingNak)
+{
+    ASSERT_EQ(init(), 0);
+
+    const int32_t nak_offset_1 = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length_1 = ALIGNED_FRAME_LENGTH * 2;
+    const int32_t nak_offset_2 = (ALIGNED_FRAME_LENGTH * 3);
+    const size_t nak_length_2 = ALIGNED_FRAME_LENGTH * 3;
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+
+        EXPECT_EQ(term_id, TERM_ID);
+        if (1 == called)
+        {
+            EXPECT_EQ(term_offset, nak_offset_1);
+            EXPECT_EQ(length, nak_length_1);
+        }
+        else if (2 == called)
+        {
+            EXPECT_EQ(term_offset, nak_offset_1 + (int32_t)nak_length_1);
+            EXPECT_EQ(length, (size_t)(ALIGNED_FRAME_LENGTH * 2));
+        }
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset_1, nak_length_1, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+    EXPECT_EQ(m_retransmits_merged_counter, 1);
+    EXPECT_EQ(m_retransmits_lingered_counter, 0);
+}
+
+TEST_F(RetransmitHandlerTest, shouldNotRetransmitNakCoveredByMultipleLingeringRanges)
+{
+    ASSERT_EQ(init(), 0);
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler,
+        TERM_ID,
+        ALIGNED_FRAME_LENGTH,
+        ALIGNED_FRAME_LENGTH,
+        TERM_LENGTH,
+        m_time,
+        RetransmitHandlerTest::on_resend,
+        this), 0);
+    EXPECT_EQ(called, 2u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, ALIGNED_FRAME_LENGTH * 2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+    EXPECT_EQ(m_retransmits_lingered_counter, 1);
+}
+
+TEST_F(RetransmitHandlerTest, shouldRetransmitSameRangeInDifferentTerm)
+{
+    ASSERT_EQ(init(), 0);
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+        return 0;
+    };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID + 1, 0, ALIGNED_FRAME_LENGTH, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldGrowActionsAndDropNaksBeyondMax)
+{
+    const size_t max_retransmit_actions = AERON_RETRANSMIT_HANDLER_MIN_RETRANSMIT_ACTIONS * 2;
+    ASSERT_EQ(init(max_retransmit_actions), 0);
+
+    size_t called = 0;
+    m_resend = [&](int32_t term_id, int32_t term_offset, size_t length)
+    {
+        called++;
+        return 0;
+    };
+
+    for (size_t i = 0; i < max_retransmit_actions + 1; i++)
+    {
+        EXPECT_EQ(aeron_retransmit_handler_on_nak(
+            &m_handler,
+            TERM_ID,
+            (int32_t)(i * 2 * ALIGNED_FRAME_LENGTH),
+            ALIGNED_FRAME_LENGTH,
+            TERM_LENGTH,
+            m_time,
+            RetransmitHandlerTest::on_resend,
+            this), 0);
+    }
+
+    EXPECT_EQ(called, max_retransmit_actions);
+    EXPECT_EQ(m_retransmits_dropped_counter, 1);
+
+    m_time = 30 * 1000 * 1000L;
+    EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time), (int)max_retransmit_actions);
+}
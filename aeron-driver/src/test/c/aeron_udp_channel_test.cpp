@@ -285,3 +285,26 @@ TEST_F(UdpChannelTest, shouldCanonicalizeForIpv6Multicast)
     ASSERT_EQ(parse_udp_channel("aeron:udp?interface=[::1]:54321/64|endpoint=[FF01::FD]:40456"), 0) << aeron_errmsg();
     EXPECT_STREQ(m_channel->canonical_form, "UDP-00000000000000000000000000000001-54321-ff0100000000000000000000000000fd-40456");
 }
+
+TEST_F(UdpChannelTest, shouldUseExplicitShardWhenInRange)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?shard=2|endpoint=localhost:40124"), 0) << aeron_errmsg();
+    EXPECT_EQ(aeron_udp_channel_shard_index(m_channel, 4), 2);
+    EXPECT_EQ(aeron_udp_channel_shard_index(m_channel, 1), 0);
+    EXPECT_EQ(aeron_udp_channel_shard_index(m_channel, 2), -1);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?shard=one|endpoint=localhost:40124"), 0) << aeron_errmsg();
+    EXPECT_EQ(aeron_udp_channel_shard_index(m_channel, 4), -1);
+}
+
+TEST_F(UdpChannelTest, shouldHashCanonicalFormToShardWhenNotExplicit)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:40124"), 0) << aeron_errmsg();
+    const int shard_index = aeron_udp_channel_shard_index(m_channel, 4);
+
+    EXPECT_GE(shard_index, 0);
+    EXPECT_LT(shard_index, 4);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=127.0.0.1:40124"), 0) << aeron_errmsg();
+    EXPECT_EQ(aeron_udp_channel_shard_index(m_channel, 4), shard_index);
+}
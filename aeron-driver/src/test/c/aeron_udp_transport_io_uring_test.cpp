@@ -0,0 +1,201 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include <media/aeron_udp_transport_io_uring.h>
+#include <util/aeron_error.h>
+}
+
+#if defined(HAVE_IO_URING)
+
+#if !defined(HAVE_RECVMMSG)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define BATCH_LENGTH (8)
+#define DATAGRAM_LENGTH (128)
+
+class UdpTransportIoUringTest : public testing::Test
+{
+public:
+    UdpTransportIoUringTest()
+    {
+        m_buffers.fill(0);
+    }
+
+    virtual void SetUp()
+    {
+        m_is_supported = aeron_udp_transport_io_uring_init(&m_io_uring) >= 0;
+
+        m_recv_fd = socket(AF_INET, SOCK_DGRAM, 0);
+        m_send_fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(m_recv_fd, 0);
+        ASSERT_GE(m_send_fd, 0);
+
+        int rcvbuf = 1024 * 1024;
+        setsockopt(m_recv_fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+        socklen_t addr_length = sizeof(m_recv_addr);
+
+        memset(&m_recv_addr, 0, sizeof(m_recv_addr));
+        m_recv_addr.sin_family = AF_INET;
+        m_recv_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        m_recv_addr.sin_port = 0;
+        ASSERT_EQ(bind(m_recv_fd, (struct sockaddr *)&m_recv_addr, sizeof(m_recv_addr)), 0);
+        ASSERT_EQ(getsockname(m_recv_fd, (struct sockaddr *)&m_recv_addr, &addr_length), 0);
+    }
+
+    virtual void TearDown()
+    {
+        if (m_is_supported)
+        {
+            aeron_udp_transport_io_uring_close(&m_io_uring);
+        }
+
+        close(m_recv_fd);
+        close(m_send_fd);
+    }
+
+    void prepareBatch(size_t vlen, bool is_connected = false)
+    {
+        memset(m_msgvec.data(), 0, sizeof(m_msgvec));
+
+        for (size_t i = 0; i < vlen; i++)
+        {
+            m_iov[i].iov_base = m_buffers.data() + (i * DATAGRAM_LENGTH);
+            m_iov[i].iov_len = DATAGRAM_LENGTH;
+            m_msgvec[i].msg_hdr.msg_name = is_connected ? NULL : &m_recv_addr;
+            m_msgvec[i].msg_hdr.msg_namelen = is_connected ? 0 : sizeof(m_recv_addr);
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+protected:
+    aeron_udp_transport_io_uring_t m_io_uring;
+    bool m_is_supported = false;
+    int m_recv_fd = -1;
+    int m_send_fd = -1;
+    struct sockaddr_in m_recv_addr;
+    std::array<uint8_t, BATCH_LENGTH * DATAGRAM_LENGTH> m_buffers;
+    std::array<struct iovec, BATCH_LENGTH> m_iov;
+    std::array<struct mmsghdr, BATCH_LENGTH> m_msgvec;
+};
+
+TEST_F(UdpTransportIoUringTest, shouldSubmitAndWaitForSendBatchInOneEnter)
+{
+    if (!m_is_supported)
+    {
+        std::cout << "io_uring not available, skipping: " << aeron_errmsg() << std::endl;
+        return;
+    }
+
+    for (int batch = 0; batch < 4; batch++)
+    {
+        prepareBatch(BATCH_LENGTH);
+
+        const uint64_t enter_count = m_io_uring.send_ring.enter_count;
+
+        ASSERT_EQ(aeron_udp_transport_io_uring_sendmmsg(
+            &m_io_uring, m_send_fd, m_msgvec.data(), BATCH_LENGTH), BATCH_LENGTH) << aeron_errmsg();
+        EXPECT_EQ(m_io_uring.send_ring.enter_count - enter_count, 1u);
+
+        for (size_t i = 0; i < BATCH_LENGTH; i++)
+        {
+            EXPECT_EQ(m_msgvec[i].msg_len, (unsigned int)DATAGRAM_LENGTH);
+        }
+    }
+
+    uint8_t datagram[DATAGRAM_LENGTH];
+    int received = 0;
+
+    while (recv(m_recv_fd, datagram, sizeof(datagram), MSG_DONTWAIT) == DATAGRAM_LENGTH)
+    {
+        received++;
+    }
+
+    EXPECT_EQ(received, 4 * BATCH_LENGTH);
+}
+
+TEST_F(UdpTransportIoUringTest, shouldWaitForSendsThatCannotCompleteInlineInOneEnter)
+{
+    if (!m_is_supported)
+    {
+        std::cout << "io_uring not available, skipping: " << aeron_errmsg() << std::endl;
+        return;
+    }
+
+    /* a datagram socket pair blocks the sender while the peer queue is full, so the sends complete asynchronously */
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, fds), 0);
+
+    uint8_t datagram[DATAGRAM_LENGTH];
+    int queued = 0;
+
+    memset(datagram, 0, sizeof(datagram));
+    while (send(fds[0], datagram, sizeof(datagram), MSG_DONTWAIT) == DATAGRAM_LENGTH)
+    {
+        queued++;
+    }
+
+    int drained = 0;
+    std::thread drainer(
+        [&]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            uint8_t buffer[DATAGRAM_LENGTH];
+            while (drained < queued + BATCH_LENGTH && recv(fds[1], buffer, sizeof(buffer), 0) == DATAGRAM_LENGTH)
+            {
+                drained++;
+            }
+        });
+
+    prepareBatch(BATCH_LENGTH, true);
+
+    const uint64_t enter_count = m_io_uring.send_ring.enter_count;
+
+    EXPECT_EQ(aeron_udp_transport_io_uring_sendmmsg(
+        &m_io_uring, fds[0], m_msgvec.data(), BATCH_LENGTH), BATCH_LENGTH) << aeron_errmsg();
+    EXPECT_EQ(m_io_uring.send_ring.enter_count - enter_count, 1u);
+
+    drainer.join();
+    EXPECT_EQ(drained, queued + BATCH_LENGTH);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#endif
@@ -0,0 +1,453 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netinet/udp.h>
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_transport_poller.h"
+#include "aeronmd.h"
+}
+
+#define NUM_MESSAGES (8)
+#define MESSAGE_LENGTH (64)
+#define POLL_ATTEMPTS (100000)
+
+class UdpTransportPollerTest : public testing::TestWithParam<bool>
+{
+public:
+    UdpTransportPollerTest()
+    {
+        m_msgvec.fill({});
+    }
+
+    virtual ~UdpTransportPollerTest()
+    {
+        if (m_poller_initialised)
+        {
+            aeron_udp_transport_poller_close(&m_poller);
+        }
+
+        aeron_udp_channel_transport_close(&m_send_transport);
+        aeron_udp_channel_transport_close(&m_recv_transport);
+    }
+
+    static void on_recv(
+        void *clientd,
+        void *transport_clientd,
+        uint8_t *buffer,
+        size_t length,
+        struct sockaddr_storage *addr,
+        struct timespec *timestamp)
+    {
+        auto *test = static_cast<UdpTransportPollerTest *>(clientd);
+
+        test->m_received.emplace_back(buffer, buffer + length);
+        test->m_received_timestamp_ns =
+            NULL != timestamp ? (timestamp->tv_sec * 1000000000L) + timestamp->tv_nsec : 0;
+        test->m_received_port = ntohs(((struct sockaddr_in *)addr)->sin_port);
+        test->m_received_transport_clientd = transport_clientd;
+    }
+
+    int bindLocalhost(aeron_udp_channel_transport_t *transport, struct sockaddr_in *addr)
+    {
+        struct sockaddr_storage bind_addr = {};
+        auto *in4 = (struct sockaddr_in *)&bind_addr;
+
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        in4->sin_port = 0;
+
+        if (aeron_udp_channel_transport_init(transport, &bind_addr, nullptr, 0, 0, 0, 0) < 0)
+        {
+            return -1;
+        }
+
+        socklen_t addr_len = sizeof(struct sockaddr_in);
+        return getsockname(transport->fd, (struct sockaddr *)addr, &addr_len);
+    }
+
+    bool init()
+    {
+        m_send_transport.fd = -1;
+        m_recv_transport.fd = -1;
+
+        if (aeron_udp_transport_poller_init(&m_poller, GetParam()) < 0)
+        {
+            return false;
+        }
+
+        m_poller_initialised = true;
+
+        EXPECT_EQ(bindLocalhost(&m_send_transport, &m_send_addr), 0);
+        EXPECT_EQ(bindLocalhost(&m_recv_transport, &m_recv_addr), 0);
+        m_send_transport.dispatch_clientd = nullptr;
+        m_recv_transport.dispatch_clientd = &m_recv_transport;
+
+        EXPECT_EQ(aeron_udp_transport_poller_add(&m_poller, &m_send_transport), 0);
+        EXPECT_EQ(aeron_udp_transport_poller_add(&m_poller, &m_recv_transport), 0);
+
+        return true;
+    }
+
+    void fillMessages(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            m_messages[i].fill((uint8_t)(i + 1));
+            m_iov[i].iov_base = m_messages[i].data();
+            m_iov[i].iov_len = m_messages[i].size();
+            m_msgvec[i].msg_hdr.msg_name = &m_recv_addr;
+            m_msgvec[i].msg_hdr.msg_namelen = sizeof(m_recv_addr);
+            m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+            m_msgvec[i].msg_hdr.msg_iovlen = 1;
+            m_msgvec[i].msg_len = 0;
+        }
+    }
+
+    void pollUntilReceived(size_t count)
+    {
+        for (int i = 0; i < POLL_ATTEMPTS && m_received.size() < count; i++)
+        {
+            ASSERT_GE(poll(), 0);
+        }
+    }
+
+    int poll()
+    {
+        struct mmsghdr msgvec[1];
+        struct iovec iov[1];
+        struct sockaddr_storage addr;
+
+        iov[0].iov_base = m_recv_buffer.data();
+        iov[0].iov_len = m_recv_buffer.size();
+        msgvec[0].msg_hdr.msg_name = &addr;
+        msgvec[0].msg_hdr.msg_namelen = sizeof(addr);
+        msgvec[0].msg_hdr.msg_iov = iov;
+        msgvec[0].msg_hdr.msg_iovlen = 1;
+        msgvec[0].msg_hdr.msg_control = m_recv_control.buffer;
+        msgvec[0].msg_hdr.msg_controllen = sizeof(m_recv_control);
+        msgvec[0].msg_hdr.msg_flags = 0;
+        msgvec[0].msg_len = 0;
+
+        return aeron_udp_transport_poller_poll(&m_poller, msgvec, 1, on_recv, this);
+    }
+
+protected:
+    aeron_udp_transport_poller_t m_poller = {};
+    aeron_udp_channel_transport_t m_send_transport = {};
+    aeron_udp_channel_transport_t m_recv_transport = {};
+    struct sockaddr_in m_send_addr = {};
+    struct sockaddr_in m_recv_addr = {};
+    bool m_poller_initialised = false;
+
+    std::array<struct mmsghdr, NUM_MESSAGES> m_msgvec;
+    std::array<struct iovec, NUM_MESSAGES> m_iov;
+    std::array<std::array<uint8_t, MESSAGE_LENGTH>, NUM_MESSAGES> m_messages;
+    std::array<uint8_t, 64 * 1024> m_recv_buffer;
+    aeron_udp_channel_transport_control_t m_recv_control;
+
+    std::vector<std::vector<uint8_t>> m_received;
+    uint16_t m_received_port = 0;
+    void *m_received_transport_clientd = nullptr;
+    int64_t m_received_timestamp_ns = 0;
+};
+
+TEST_P(UdpTransportPollerTest, shouldSendBatchAndPollMessagesInOrder)
+{
+    if (!init())
+    {
+        // io_uring may be unavailable at runtime, e.g. disabled by seccomp or kernel configuration
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    for (size_t i = 0; i < NUM_MESSAGES; i++)
+    {
+        m_messages[i].fill((uint8_t)(i + 1));
+        m_iov[i].iov_base = m_messages[i].data();
+        m_iov[i].iov_len = m_messages[i].size();
+        m_msgvec[i].msg_hdr.msg_name = &m_recv_addr;
+        m_msgvec[i].msg_hdr.msg_namelen = sizeof(m_recv_addr);
+        m_msgvec[i].msg_hdr.msg_iov = &m_iov[i];
+        m_msgvec[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), NUM_MESSAGES), NUM_MESSAGES);
+    for (size_t i = 0; i < NUM_MESSAGES; i++)
+    {
+        EXPECT_EQ(m_msgvec[i].msg_len, (unsigned int)MESSAGE_LENGTH);
+    }
+
+    for (int i = 0; i < POLL_ATTEMPTS && m_received.size() < NUM_MESSAGES; i++)
+    {
+        ASSERT_GE(poll(), 0);
+    }
+
+    ASSERT_EQ(m_received.size(), (size_t)NUM_MESSAGES);
+    for (size_t i = 0; i < NUM_MESSAGES; i++)
+    {
+        ASSERT_EQ(m_received[i].size(), (size_t)MESSAGE_LENGTH);
+        EXPECT_EQ(m_received[i][0], (uint8_t)(i + 1));
+    }
+
+    EXPECT_EQ(m_received_port, ntohs(m_send_addr.sin_port));
+    EXPECT_EQ(m_received_transport_clientd, &m_recv_transport);
+    EXPECT_EQ(m_received_timestamp_ns, 0);
+}
+
+TEST_P(UdpTransportPollerTest, shouldReportFramesSentBeforeFailedFrameInBatch)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    fillMessages(NUM_MESSAGES);
+    m_msgvec[2].msg_hdr.msg_namelen = 1;
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), NUM_MESSAGES), 2);
+    EXPECT_EQ(m_msgvec[0].msg_len, (unsigned int)MESSAGE_LENGTH);
+    EXPECT_EQ(m_msgvec[1].msg_len, (unsigned int)MESSAGE_LENGTH);
+
+    fillMessages(NUM_MESSAGES);
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), NUM_MESSAGES), NUM_MESSAGES);
+
+    pollUntilReceived(NUM_MESSAGES + 2);
+    ASSERT_EQ(m_received.size(), (size_t)NUM_MESSAGES + 2);
+    EXPECT_EQ(m_received[0][0], 1u);
+    EXPECT_EQ(m_received[1][0], 2u);
+    for (size_t i = 0; i < NUM_MESSAGES; i++)
+    {
+        EXPECT_EQ(m_received[i + 2][0], (uint8_t)(i + 1));
+    }
+}
+
+TEST_P(UdpTransportPollerTest, shouldFailBatchWhenFirstFrameFailsAndRecoverOnNextBatch)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    fillMessages(NUM_MESSAGES);
+    m_msgvec[0].msg_hdr.msg_namelen = 1;
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), NUM_MESSAGES), -1);
+
+    fillMessages(NUM_MESSAGES);
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), NUM_MESSAGES), NUM_MESSAGES);
+
+    pollUntilReceived(NUM_MESSAGES);
+    ASSERT_EQ(m_received.size(), (size_t)NUM_MESSAGES);
+    for (size_t i = 0; i < NUM_MESSAGES; i++)
+    {
+        EXPECT_EQ(m_received[i][0], (uint8_t)(i + 1));
+    }
+}
+
+TEST_P(UdpTransportPollerTest, shouldReportPersistentReceiveErrorOnceAndStopReceiving)
+{
+    if (!GetParam() || !init())
+    {
+        return;
+    }
+
+    int pipe_fds[2];
+    aeron_udp_channel_transport_t not_a_socket = {};
+
+    ASSERT_EQ(pipe(pipe_fds), 0);
+    not_a_socket.fd = pipe_fds[0];
+    ASSERT_EQ(aeron_udp_transport_poller_add(&m_poller, &not_a_socket), 0);
+
+    int errors = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        if (poll() < 0)
+        {
+            errors++;
+        }
+    }
+
+    EXPECT_EQ(errors, 1);
+
+    fillMessages(1);
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), 1), 1);
+    pollUntilReceived(1);
+    EXPECT_EQ(m_received.size(), 1u);
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&m_poller, &not_a_socket), 0);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+}
+
+TEST_P(UdpTransportPollerTest, shouldDispatchKernelReceiveTimestampWhenEnabled)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    ASSERT_EQ(aeron_udp_channel_transport_enable_timestamps(&m_recv_transport), 0);
+
+    const int64_t before_send_ns = aeron_epochnanoclock();
+    uint8_t message[MESSAGE_LENGTH] = {};
+    ASSERT_EQ(sendto(
+        m_send_transport.fd, message, sizeof(message), 0, (struct sockaddr *)&m_recv_addr, sizeof(m_recv_addr)),
+        (ssize_t)sizeof(message));
+
+    for (int i = 0; i < POLL_ATTEMPTS && m_received.empty(); i++)
+    {
+        ASSERT_GE(poll(), 0);
+    }
+
+    ASSERT_EQ(m_received.size(), 1u);
+    EXPECT_GE(m_received_timestamp_ns, before_send_ns);
+    EXPECT_LE(m_received_timestamp_ns, aeron_epochnanoclock());
+}
+
+#if defined(HAVE_UDP_GSO)
+TEST_P(UdpTransportPollerTest, shouldDispatchSegmentsOfGsoSendSeparately)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    ASSERT_EQ(aeron_udp_channel_transport_enable_gso(&m_send_transport), 0);
+    ASSERT_EQ(aeron_udp_channel_transport_enable_gro(&m_recv_transport), 0);
+
+    const size_t num_segments = 3;
+    aeron_udp_channel_transport_control_t control;
+    uint16_t segment_length = MESSAGE_LENGTH;
+
+    for (size_t i = 0; i < num_segments; i++)
+    {
+        m_messages[i].fill((uint8_t)(i + 1));
+        m_iov[i].iov_base = m_messages[i].data();
+        m_iov[i].iov_len = m_messages[i].size();
+    }
+
+    m_msgvec[0].msg_hdr.msg_name = &m_recv_addr;
+    m_msgvec[0].msg_hdr.msg_namelen = sizeof(m_recv_addr);
+    m_msgvec[0].msg_hdr.msg_iov = m_iov.data();
+    m_msgvec[0].msg_hdr.msg_iovlen = num_segments;
+    m_msgvec[0].msg_hdr.msg_control = control.buffer;
+    m_msgvec[0].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(segment_length));
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&m_msgvec[0].msg_hdr);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(segment_length));
+    memcpy(CMSG_DATA(cmsg), &segment_length, sizeof(segment_length));
+
+    ASSERT_EQ(aeron_udp_channel_transport_sendmmsg(&m_send_transport, m_msgvec.data(), 1), 1);
+
+    for (int i = 0; i < POLL_ATTEMPTS && m_received.size() < num_segments; i++)
+    {
+        ASSERT_GE(poll(), 0);
+    }
+
+    ASSERT_EQ(m_received.size(), num_segments);
+    for (size_t i = 0; i < num_segments; i++)
+    {
+        ASSERT_EQ(m_received[i].size(), (size_t)MESSAGE_LENGTH);
+        EXPECT_EQ(m_received[i][0], (uint8_t)(i + 1));
+        EXPECT_EQ(m_received[i][MESSAGE_LENGTH - 1], (uint8_t)(i + 1));
+    }
+}
+
+TEST_P(UdpTransportPollerTest, shouldSplitGroCoalescedDatagramOnDispatch)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    ASSERT_EQ(aeron_udp_channel_transport_enable_gro(&m_recv_transport), 0);
+
+    std::array<uint8_t, (MESSAGE_LENGTH * 2) + 16> coalesced;
+    aeron_udp_channel_transport_control_t control;
+    struct sockaddr_storage addr = {};
+    struct msghdr msghdr = {};
+    int gso_size = MESSAGE_LENGTH;
+
+    coalesced.fill(0);
+    msghdr.msg_name = &addr;
+    msghdr.msg_control = control.buffer;
+    msghdr.msg_controllen = CMSG_SPACE(sizeof(gso_size));
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msghdr);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_GRO;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+    memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+    EXPECT_EQ(aeron_udp_channel_transport_dispatch(
+        &m_recv_transport, &msghdr, coalesced.data(), coalesced.size(), on_recv, this), 3);
+
+    ASSERT_EQ(m_received.size(), 3u);
+    EXPECT_EQ(m_received[0].size(), (size_t)MESSAGE_LENGTH);
+    EXPECT_EQ(m_received[1].size(), (size_t)MESSAGE_LENGTH);
+    EXPECT_EQ(m_received[2].size(), 16u);
+}
+#endif
+
+TEST_P(UdpTransportPollerTest, shouldStopDispatchingAfterRemove)
+{
+    if (!init())
+    {
+        ASSERT_TRUE(GetParam());
+        return;
+    }
+
+    ASSERT_EQ(aeron_udp_transport_poller_remove(&m_poller, &m_recv_transport), 0);
+    EXPECT_EQ(m_poller.transports.length, 1u);
+    EXPECT_EQ(m_recv_transport.io_uring, nullptr);
+
+    uint8_t message[MESSAGE_LENGTH] = {};
+    ASSERT_EQ(sendto(
+        m_send_transport.fd, message, sizeof(message), 0, (struct sockaddr *)&m_recv_addr, sizeof(m_recv_addr)),
+        (ssize_t)sizeof(message));
+
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT_GE(poll(), 0);
+    }
+
+    EXPECT_EQ(m_received.size(), 0u);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    UdpTransportPollerParameterisedTest,
+    UdpTransportPollerTest,
+    testing::Values(false, true));
@@ -94,6 +94,22 @@ TEST_F(UriTest, shouldParseWithMultipleParams)
     EXPECT_EQ(std::string(m_uri.params.udp.additional_params.array[0].value), "4567");
 }
 
+TEST_F(UriTest, shouldParseGsoParamOverridingDefault)
+{
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=192.168.0.1:40456|gso=true", &m_uri), 0);
+    ASSERT_EQ(m_uri.type, AERON_URI_UDP);
+    EXPECT_EQ(std::string(m_uri.params.udp.gso_key), "true");
+    EXPECT_TRUE(aeron_uri_gso(&m_uri, false));
+    EXPECT_EQ(m_uri.params.udp.additional_params.length, 0u);
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=192.168.0.1:40456|gso=false", &m_uri), 0);
+    EXPECT_FALSE(aeron_uri_gso(&m_uri, true));
+
+    EXPECT_EQ(aeron_uri_parse("aeron:udp?endpoint=192.168.0.1:40456", &m_uri), 0);
+    EXPECT_TRUE(aeron_uri_gso(&m_uri, true));
+    EXPECT_FALSE(aeron_uri_gso(&m_uri, false));
+}
+
 class UriResolverTest : public testing::Test
 {
 public:
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Image.h>
+#include <FragmentAssembler.h>
+#include <concurrent/logbuffer/ExclusiveTermAppender.h>
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+static const std::int32_t TERM_LENGTH = LogBufferDescriptor::TERM_MIN_LENGTH;
+static const std::int32_t SESSION_ID = 7;
+static const std::int32_t STREAM_ID = 1001;
+
+typedef std::array<std::uint8_t, 1024> counters_buffer_t;
+typedef std::array<std::uint8_t, DataFrameHeader::LENGTH> header_buffer_t;
+
+static void noOpExceptionHandler(const std::exception&)
+{
+}
+
+/*
+ * Fills the first term of an in memory log with messages of a given length and polls the whole term per iteration
+ * so only the cost of delivering each fragment through the handler chain is measured.
+ */
+class ImageFixture
+{
+public:
+    ImageFixture(util::index_t messageLength) :
+        m_log(LogBufferDescriptor::computeLogLength(TERM_LENGTH) / sizeof(std::int64_t)),
+        m_logBuffers(std::make_shared<LogBuffers>(
+            reinterpret_cast<std::uint8_t *>(m_log.data()),
+            static_cast<util::index_t>(m_log.size() * sizeof(std::int64_t)))),
+        m_countersBuffer(m_counters),
+        m_subscriberPositionImpl(m_countersBuffer, 0)
+    {
+        m_counters.fill(0);
+
+        AtomicBuffer& metaDataBuffer = m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX);
+        AERON_DECL_ALIGNED(header_buffer_t defaultHeader, 16);
+        defaultHeader.fill(0);
+        AtomicBuffer defaultHeaderBuffer(defaultHeader);
+        defaultHeaderBuffer.putInt32(DataFrameHeader::SESSION_ID_FIELD_OFFSET, SESSION_ID);
+        defaultHeaderBuffer.putInt32(DataFrameHeader::STREAM_ID_FIELD_OFFSET, STREAM_ID);
+
+        HeaderWriter headerWriter(defaultHeaderBuffer);
+        ExclusiveTermAppender appender(m_logBuffers->atomicBuffer(0), metaDataBuffer, 0);
+        std::vector<std::uint8_t> message(static_cast<std::size_t>(messageLength), 1);
+        AtomicBuffer messageBuffer(message.data(), messageLength);
+        std::int32_t termOffset = 0;
+
+        do
+        {
+            termOffset = appender.appendUnfragmentedMessage(
+                0, termOffset, headerWriter, messageBuffer, 0, messageLength, DEFAULT_RESERVED_VALUE_SUPPLIER);
+
+            if (termOffset > 0)
+            {
+                m_fragmentsPerTerm++;
+            }
+        }
+        while (termOffset > 0 && termOffset < TERM_LENGTH);
+
+        m_image = std::unique_ptr<Image>(new Image(
+            SESSION_ID, 1, 2, "benchmark", m_subscriberPositionImpl, m_logBuffers, noOpExceptionHandler));
+    }
+
+    template <typename F>
+    inline int pollTerm(F&& handler)
+    {
+        m_subscriberPositionImpl.set(0);
+        return m_image->poll(handler, m_fragmentsPerTerm);
+    }
+
+    int fragmentsPerTerm() const
+    {
+        return m_fragmentsPerTerm;
+    }
+
+private:
+    std::vector<std::int64_t> m_log;
+    std::shared_ptr<LogBuffers> m_logBuffers;
+    AERON_DECL_ALIGNED(counters_buffer_t m_counters, 16);
+    AtomicBuffer m_countersBuffer;
+    UnsafeBufferPosition m_subscriberPositionImpl;
+    std::unique_ptr<Image> m_image;
+    int m_fragmentsPerTerm = 0;
+};
+
+static void BM_PollFragmentAssemblerStdFunction(benchmark::State &state)
+{
+    ImageFixture fixture(static_cast<util::index_t>(state.range(0)));
+    std::int64_t bytes = 0;
+
+    FragmentAssembler assembler(
+        [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            bytes += length;
+        });
+    fragment_handler_t handler = assembler.handler();
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(fixture.pollTerm(handler));
+    }
+
+    benchmark::DoNotOptimize(bytes);
+    state.SetItemsProcessed(state.iterations() * fixture.fragmentsPerTerm());
+}
+BENCHMARK(BM_PollFragmentAssemblerStdFunction)->Arg(32)->Arg(224)->Arg(992);
+
+static void BM_PollFragmentAssemblerInlined(benchmark::State &state)
+{
+    ImageFixture fixture(static_cast<util::index_t>(state.range(0)));
+    std::int64_t bytes = 0;
+
+    auto assembler = makeFragmentAssembler(
+        [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+        {
+            bytes += length;
+        });
+    auto handler = assembler.handler();
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(fixture.pollTerm(handler));
+    }
+
+    benchmark::DoNotOptimize(bytes);
+    state.SetItemsProcessed(state.iterations() * fixture.fragmentsPerTerm());
+}
+BENCHMARK(BM_PollFragmentAssemblerInlined)->Arg(32)->Arg(224)->Arg(992);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2014-2017 Real Logic Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <LogBuffers.h>
+#include <concurrent/logbuffer/ExclusiveTermAppender.h>
+#include <concurrent/logbuffer/TermReader.h>
+
+using namespace aeron;
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+static const std::int32_t TERM_LENGTH = 64 * 1024 * 1024;
+static const std::int32_t SESSION_ID = 7;
+static const std::int32_t STREAM_ID = 1001;
+static const char *LOG_DIR = "/dev/shm";
+
+typedef std::array<std::uint8_t, DataFrameHeader::LENGTH> header_buffer_t;
+
+static void noOpExceptionHandler(const std::exception&)
+{
+}
+
+/*
+ * A log file laid out the way the driver does for a given page size, with the term length and page size recorded in
+ * the meta data so LogBuffers pads and advises the mapping the same way as for a driver created log. With a page
+ * size above 4KB the terms are backed by transparent huge pages on tmpfs when shmem_enabled allows it, or by
+ * hugetlbfs pages when LOG_DIR is on hugetlbfs.
+ */
+class LogFixture
+{
+public:
+    LogFixture(std::int64_t pageSize, util::index_t messageLength) :
+        m_filename(std::string(LOG_DIR) + "/aeron-huge-pages-benchmark-" + std::to_string(::getpid()) + ".logbuffer"),
+        m_message(static_cast<std::size_t>(messageLength), 1),
+        m_messageBuffer(m_message.data(), messageLength),
+        m_header(0, TERM_LENGTH)
+    {
+        const std::int64_t logLength = LogBufferDescriptor::computeLogLength(TERM_LENGTH, pageSize);
+
+        {
+            MemoryMappedFile::ptr_t logFile =
+                MemoryMappedFile::createNew(m_filename.c_str(), 0, static_cast<std::size_t>(logLength));
+            AtomicBuffer metaDataBuffer(
+                logFile->getMemoryPtr() + (logLength - LogBufferDescriptor::LOG_META_DATA_LENGTH),
+                LogBufferDescriptor::LOG_META_DATA_LENGTH);
+
+            LogBufferDescriptor::termLength(metaDataBuffer, TERM_LENGTH);
+            LogBufferDescriptor::pageSize(metaDataBuffer, static_cast<std::int32_t>(pageSize));
+        }
+
+        m_logBuffers = std::make_shared<LogBuffers>(m_filename.c_str());
+
+        AERON_DECL_ALIGNED(header_buffer_t defaultHeader, 16);
+        defaultHeader.fill(0);
+        AtomicBuffer defaultHeaderBuffer(defaultHeader);
+        defaultHeaderBuffer.putInt32(DataFrameHeader::SESSION_ID_FIELD_OFFSET, SESSION_ID);
+        defaultHeaderBuffer.putInt32(DataFrameHeader::STREAM_ID_FIELD_OFFSET, STREAM_ID);
+
+        m_headerWriter = std::unique_ptr<HeaderWriter>(new HeaderWriter(defaultHeaderBuffer));
+        m_appender = std::unique_ptr<ExclusiveTermAppender>(new ExclusiveTermAppender(
+            m_logBuffers->atomicBuffer(0),
+            m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX),
+            0));
+    }
+
+    ~LogFixture()
+    {
+        m_appender.reset();
+        m_logBuffers.reset();
+        ::unlink(m_filename.c_str());
+    }
+
+    /*
+     * Append a full term then read it back, as a publisher and subscriber sharing an IPC log would.
+     */
+    inline std::int64_t appendAndReadTerm()
+    {
+        std::int32_t termOffset = 0;
+        std::int64_t bytesRead = 0;
+
+        m_appender->tailTermId(0);
+
+        do
+        {
+            termOffset = m_appender->appendUnfragmentedMessage(
+                0, termOffset, *m_headerWriter, m_messageBuffer, 0, m_messageBuffer.capacity(),
+                DEFAULT_RESERVED_VALUE_SUPPLIER);
+        }
+        while (termOffset > 0 && termOffset < TERM_LENGTH);
+
+        TermReader::ReadOutcome outcome{0, 0};
+        TermReader::read(
+            outcome,
+            m_logBuffers->atomicBuffer(0),
+            0,
+            [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+            {
+                bytesRead += length;
+            },
+            INT32_MAX,
+            m_header,
+            noOpExceptionHandler);
+
+        return bytesRead;
+    }
+
+private:
+    std::string m_filename;
+    std::vector<std::uint8_t> m_message;
+    AtomicBuffer m_messageBuffer;
+    Header m_header;
+    std::shared_ptr<LogBuffers> m_logBuffers;
+    std::unique_ptr<HeaderWriter> m_headerWriter;
+    std::unique_ptr<ExclusiveTermAppender> m_appender;
+};
+
+static void BM_AppendAndReadTerm(benchmark::State &state)
+{
+    LogFixture fixture(state.range(0), static_cast<util::index_t>(state.range(1)));
+    std::int64_t bytes = 0;
+
+    while (state.KeepRunning())
+    {
+        bytes += fixture.appendAndReadTerm();
+    }
+
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_AppendAndReadTerm)
+    ->Args({4 * 1024, 32})
+    ->Args({2 * 1024 * 1024, 32})
+    ->Args({4 * 1024, 992})
+    ->Args({2 * 1024 * 1024, 992})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();